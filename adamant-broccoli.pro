@@ -13,7 +13,10 @@ QMAKE_CXXFLAGS_RELEASE *= -O3 -march=native
 SOURCES += src/main.cpp \
     src/Calls/Call.cpp \
     src/Calls/CallGenerator.cpp \
+    src/Calls/CallTrace.cpp \
+    src/Calls/ConnectionIndex.cpp \
     src/Calls/Event.cpp \
+    src/Calls/EventCalendar.cpp \
     src/Devices/Amplifiers/Amplifier.cpp \
     src/Devices/Amplifiers/BoosterAmplifier.cpp \
     src/Devices/Amplifiers/EDFA.cpp \
@@ -24,13 +27,18 @@ SOURCES += src/main.cpp \
     src/Devices/Regenerator.cpp \
     src/Devices/Splitter.cpp \
     src/Devices/SSS.cpp \
+    src/GeneralClasses/BatchMeans.cpp \
     src/GeneralClasses/Gain.cpp \
     src/GeneralClasses/LinkSpectralDensity.cpp \
+    src/GeneralClasses/MetricsStream.cpp \
     src/GeneralClasses/ModulationScheme.cpp \
     src/GeneralClasses/Power.cpp \
+    src/GeneralClasses/Profiler.cpp \
+    src/GeneralClasses/RandomGenerator.cpp \
     src/GeneralClasses/Signal.cpp \
     src/GeneralClasses/SpectralDensity.cpp \
     src/GeneralClasses/TransmissionBitrate.cpp \
+    src/GeneralClasses/WarmupDetector.cpp \
     src/GeneralClasses/Transmittances/ConstantTransmittance.cpp \
     src/GeneralClasses/Transmittances/GaussianFilter.cpp \
     src/GeneralClasses/Transmittances/GaussianPassbandFilter.cpp \
@@ -46,9 +54,14 @@ SOURCES += src/main.cpp \
     src/GeneralPurposeAlgorithms/NSGA-II/NSGA2_Individual.cpp \
     src/GeneralPurposeAlgorithms/NSGA-II/NSGA2_Parameter.cpp \
     src/Structure/Link.cpp \
+    src/Structure/NetworkState.cpp \
     src/Structure/Node.cpp \
+    src/Structure/RoutingGraph.cpp \
     src/Structure/Slot.cpp \
+    src/Structure/SlotBitset.cpp \
     src/Structure/Topology.cpp \
+    src/Structure/TopologyGenerator.cpp \
+    src/Structure/TopologyPool.cpp \
     src/RMSA/RegeneratorAssignmentAlgorithms/FirstLongestReach.cpp \
     src/RMSA/RegeneratorAssignmentAlgorithms/FirstNarrowestSpectrum.cpp \
     src/RMSA/RegeneratorAssignmentAlgorithms/RegeneratorAssignmentAlgorithm.cpp \
@@ -92,8 +105,12 @@ SOURCES += src/main.cpp \
     src/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_Occupability.cpp \
     src/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_OrigDestIndex.cpp \
     src/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_Slots.cpp \
+    src/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeries.cpp \
     src/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeriesRouting.cpp \
     src/RMSA/RoutingAlgorithms/Costs/ShortestPath.cpp \
+    src/RMSA/RoutingAlgorithms/DynamicShortestPaths.cpp \
+    src/RMSA/RoutingAlgorithms/RouteTable.cpp \
+    src/RMSA/RoutingAlgorithms/ShortestPathSearch.cpp \
     src/RMSA/RoutingAlgorithms/RoutingAlgorithm.cpp \
     src/RMSA/RoutingAlgorithms/RoutingCost.cpp \
     src/RMSA/RoutingWavelengthAssignment.cpp \
@@ -109,11 +126,13 @@ SOURCES += src/main.cpp \
     src/RMSA/SpectrumAssignmentAlgorithms/RandomFit.cpp \
     src/RMSA/SpectrumAssignmentAlgorithms/SpectrumAssignmentAlgorithm.cpp \
     src/RMSA/TransparentSegment.cpp \
+    src/SimulationTypes/NetworkFork.cpp \
     src/SimulationTypes/NetworkSimulation.cpp \
     src/SimulationTypes/SimulationType.cpp \
     src/SimulationTypes/Simulation_FFE_Optimization.cpp \
     src/SimulationTypes/Simulation_NetworkLoad.cpp \
     src/SimulationTypes/Simulation_NSGA2_RegnPlac.cpp \
+    src/SimulationTypes/Simulation_PairedComparison.cpp \
     src/SimulationTypes/Simulation_PowerRatioThreshold.cpp \
     src/SimulationTypes/Simulation_PSROptimization.cpp \
     src/SimulationTypes/Simulation_RegeneratorNumber.cpp \
@@ -121,19 +140,39 @@ SOURCES += src/main.cpp \
     src/SimulationTypes/Simulation_TransparencyAnalysis.cpp \
     tests/Calls/CallTest.cpp \
     tests/Calls/CallGeneratorTest.cpp \
+    tests/Calls/CallTraceTest.cpp \
+    tests/Calls/ConnectionIndexTest.cpp \
     tests/Calls/EventTest.cpp \
+    tests/Calls/EventCalendarTest.cpp \
     tests/Devices/AmplifierTest.cpp \
     tests/Devices/FiberTest.cpp \
     tests/Devices/SplitterTest.cpp \
+    tests/GeneralClasses/BatchMeansTest.cpp \
     tests/GeneralClasses/GainTest.cpp \
     tests/GeneralClasses/ModulationSchemeTest.cpp \
     tests/GeneralClasses/PowerTest.cpp \
+    tests/GeneralClasses/ProfilerTest.cpp \
+    tests/GeneralClasses/RandomGeneratorTest.cpp \
+    tests/GeneralClasses/RingBufferTest.cpp \
     tests/GeneralClasses/TransmissionBitrateTest.cpp \
+    tests/GeneralClasses/WarmupDetectorTest.cpp \
     tests/GeneralPurposeAlgorithms/IntegrationMethods/TrapezoidalRuleTest.cpp \
+    tests/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeriesTest.cpp \
+    tests/RMSA/RoutingAlgorithms/DynamicShortestPathsTest.cpp \
+    tests/RMSA/RoutingAlgorithms/RouteTableTest.cpp \
+    tests/RMSA/RoutingAlgorithms/ShortestPathSearchTest.cpp \
+    tests/RMSA/RoutingAlgorithms/Algorithms/Yen_RoutingAlgorithmTest.cpp \
     tests/Structure/LinkTest.cpp \
     tests/Structure/NodeTest.cpp \
+    tests/Structure/RoutingGraphTest.cpp \
     tests/Structure/SlotTest.cpp \
+    tests/Structure/SlotBitsetTest.cpp \
     tests/Structure/TopologyTest.cpp \
+    tests/Structure/TopologyGeneratorTest.cpp \
+    tests/Structure/TopologyPoolTest.cpp \
+    tests/SimulationTypes/NetworkForkTest.cpp \
+    tests/SimulationTypes/NetworkSimulationTest.cpp \
+    tests/SimulationTypes/Simulation_PairedComparisonTest.cpp \
     tests/crosstalkTest.cpp \
     tests/GeneralClasses/Transmittances/TransmittanceTest.cpp \
     tests/GeneralClasses/SpectralDensityTest.cpp \
@@ -143,7 +182,10 @@ HEADERS += \
     include/Calls.h \
     include/Calls/Call.h \
     include/Calls/CallGenerator.h \
+    include/Calls/CallTrace.h \
+    include/Calls/ConnectionIndex.h \
     include/Calls/Event.h \
+    include/Calls/EventCalendar.h \
     include/Devices.h \
     include/Devices/Amplifiers.h \
     include/Devices/Amplifiers/Amplifier.h \
@@ -157,15 +199,21 @@ HEADERS += \
     include/Devices/SSS.h \
     include/Devices/Splitter.h \
     include/GeneralClasses.h \
+    include/GeneralClasses/BatchMeans.h \
+    include/GeneralClasses/BinaryStream.h \
     include/GeneralClasses/Gain.h \
     include/GeneralClasses/LinkSpectralDensity.h \
+    include/GeneralClasses/MetricsStream.h \
     include/GeneralClasses/ModulationScheme.h \
     include/GeneralClasses/PhysicalConstants.h \
     include/GeneralClasses/Power.h \
+    include/GeneralClasses/Profiler.h \
     include/GeneralClasses/RandomGenerator.h \
+    include/GeneralClasses/RingBuffer.h \
     include/GeneralClasses/Signal.h \
     include/GeneralClasses/SpectralDensity.h \
     include/GeneralClasses/TransmissionBitrate.h \
+    include/GeneralClasses/WarmupDetector.h \
     include/GeneralClasses/Transmittances/ConstantTransmittance.h \
     include/GeneralClasses/Transmittances/GaussianFilter.h \
     include/GeneralClasses/Transmittances/GaussianPassbandFilter.h \
@@ -186,9 +234,14 @@ HEADERS += \
     include/GeneralPurposeAlgorithms/PSO/PSO_Particle.h \
     include/Structure.h \
     include/Structure/Link.h \
+    include/Structure/NetworkState.h \
     include/Structure/Node.h \
+    include/Structure/RoutingGraph.h \
     include/Structure/Slot.h \
+    include/Structure/SlotBitset.h \
     include/Structure/Topology.h \
+    include/Structure/TopologyGenerator.h \
+    include/Structure/TopologyPool.h \
     include/RMSA.h \
     include/RMSA/RegeneratorAssignmentAlgorithms.h \
     include/RMSA/RegeneratorAssignmentAlgorithms/FirstLongestReach.h \
@@ -215,6 +268,9 @@ HEADERS += \
     include/RMSA/Route.h \
     include/RMSA/RoutingAlgorithms.h \
     include/RMSA/RoutingCosts.h \
+    include/RMSA/RoutingAlgorithms/DynamicShortestPaths.h \
+    include/RMSA/RoutingAlgorithms/RouteTable.h \
+    include/RMSA/RoutingAlgorithms/ShortestPathSearch.h \
     include/RMSA/RoutingAlgorithms/RoutingAlgorithm.h \
     include/RMSA/RoutingAlgorithms/RoutingCost.h \
     include/RMSA/RoutingAlgorithms/Algorithms/BellmanFord_RoutingAlgorithm.h \
@@ -242,6 +298,7 @@ HEADERS += \
     include/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_Occupability.h \
     include/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_OrigDestIndex.h \
     include/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_Slots.h \
+    include/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeries.h \
     include/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeriesRouting.h \
     include/RMSA/RoutingAlgorithms/Costs/ShortestPath.h \
     include/RMSA/RoutingWavelengthAssignment.h \
@@ -259,11 +316,13 @@ HEADERS += \
     include/RMSA/SpectrumAssignmentAlgorithms/SpectrumAssignmentAlgorithm.h \
     include/RMSA/TransparentSegment.h \
     include/SimulationTypes.h \
+    include/SimulationTypes/NetworkFork.h \
     include/SimulationTypes/NetworkSimulation.h \
     include/SimulationTypes/SimulationType.h \
     include/SimulationTypes/Simulation_FFE_Optimization.h \
     include/SimulationTypes/Simulation_NetworkLoad.h \
     include/SimulationTypes/Simulation_NSGA2_RegnPlac.h \
+    include/SimulationTypes/Simulation_PairedComparison.h \
     include/SimulationTypes/Simulation_PowerRatioThreshold.h \
     include/SimulationTypes/Simulation_PSROptimization.h \
     include/SimulationTypes/Simulation_RegeneratorNumber.h \
@@ -286,4 +345,34 @@ CONFIG(debug, debug|release) {
 DEFINES += RUN_TESTS RUN_ASSERTIONS
 }
 
+# Hot-path profiler: qmake CONFIG+=profiler, or CONFIG+=profiler_perf to also
+# read the hardware counters.
+profiler|profiler_perf {
+DEFINES += RUN_PROFILER
+}
+profiler_perf {
+DEFINES += RUN_PROFILER_PERF
+}
+
 INCLUDEPATH += include/
+
+# Microbenchmarks of the hot kernels: qmake CONFIG+=benchmark (preferably a
+# release build). Requires Google Benchmark, and must run from the repository
+# root, where the bundled topologies are found.
+benchmark {
+TARGET = adamant-broccoli-benchmark
+DEFINES -= RUN_TESTS
+SOURCES -= src/main.cpp
+SOURCES += benchmarks/main.cpp \
+    benchmarks/BenchmarkFixtures.cpp \
+    benchmarks/EventCalendarBenchmark.cpp \
+    benchmarks/NodeBenchmark.cpp \
+    benchmarks/RoutingBenchmark.cpp \
+    benchmarks/ScalingBenchmark.cpp \
+    benchmarks/SlotBitsetBenchmark.cpp \
+    benchmarks/SpectrumAssignmentBenchmark.cpp \
+    benchmarks/TopologyBenchmark.cpp \
+    benchmarks/TransparentSegmentBenchmark.cpp
+HEADERS += benchmarks/BenchmarkFixtures.h
+LIBS += -lbenchmark -lpthread
+}
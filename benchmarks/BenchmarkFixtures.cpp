@@ -0,0 +1,112 @@
+#include "BenchmarkFixtures.h"
+#include <Calls/Call.h>
+#include <Structure/Link.h>
+#include <Structure/Slot.h>
+#include <RMSA/RoutingAlgorithms/RoutingAlgorithm.h>
+#include <RMSA/SpectrumAssignmentAlgorithms/SpectrumAssignmentAlgorithm.h>
+#include <RMSA/TransparentSegment.h>
+#include <random>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+using namespace Benchmarks;
+
+std::shared_ptr<Topology> Benchmarks::create_Topology(
+    Topology::DefaultTopologies Top)
+{
+    //Each fixture parses its own topology, so that fixtures never share state
+    return Topology::create_DefaultTopology(Top);
+}
+
+std::string Benchmarks::get_TopologyName(Topology::DefaultTopologies Top)
+{
+    return Topology::DefaultTopologiesNames.left.at(Top);
+}
+
+std::vector<std::shared_ptr<Call>> Benchmarks::create_Calls(
+                                    std::shared_ptr<Topology> T, RandomGenerator &Stream)
+{
+    std::uniform_int_distribution<int> NodeDistribution(0, T->Nodes.size() - 1);
+    std::uniform_int_distribution<int> BitrateDistribution(0,
+            TransmissionBitrate::DefaultBitrates.size() - 1);
+
+    std::vector<std::shared_ptr<Call>> Calls;
+    for (unsigned c = 0; c < NumCalls; c++)
+        {
+        int Origin = NodeDistribution(Stream);
+        int Destination = NodeDistribution(Stream);
+        while (Origin == Destination)
+            {
+            Destination = NodeDistribution(Stream);
+            }
+
+        Calls.push_back(std::make_shared<Call>(T->Nodes[Origin], T->Nodes[Destination],
+                                               TransmissionBitrate::DefaultBitrates[BitrateDistribution(Stream)],
+                                               *ModulationScheme::DefaultSchemes.rbegin()));
+        }
+
+    return Calls;
+}
+
+std::vector<std::vector<std::weak_ptr<Link>>> Benchmarks::create_Routes(
+    std::shared_ptr<Topology> T, std::vector<std::shared_ptr<Call>> &Calls)
+{
+    using namespace RMSA::ROUT;
+
+    auto R_Alg = RoutingAlgorithm::create_RoutingAlgorithm(
+                     RoutingAlgorithm::dijkstra, RoutingCost::SP, T, false);
+
+    std::vector<std::vector<std::weak_ptr<Link>>> Routes;
+    for (auto &C : Calls)
+        {
+        Routes.push_back(R_Alg->route(C).front());
+        }
+
+    return Routes;
+}
+
+std::vector<mapSlots> Benchmarks::assign_Slots(std::shared_ptr<Topology> T,
+        std::vector<std::shared_ptr<Call>> &Calls,
+        std::vector<std::vector<std::weak_ptr<Link>>> &Routes)
+{
+    using namespace RMSA::SA;
+
+    auto SA_Alg = SpectrumAssignmentAlgorithm::create_SpectrumAssignmentAlgorithm(
+                      SpectrumAssignmentAlgorithm::FF, T);
+
+    std::vector<mapSlots> Slots;
+    for (unsigned c = 0; c < Calls.size(); c++)
+        {
+        Slots.push_back(SA_Alg->assignSlots(Calls[c],
+                                            RMSA::TransparentSegment(Routes[c], Calls[c]->Scheme)));
+        }
+
+    return Slots;
+}
+
+void Benchmarks::fill_Spectrum(std::shared_ptr<Topology> T, double Occupancy,
+                               RandomGenerator &Stream)
+{
+    std::bernoulli_distribution isUsed(Occupancy);
+
+    for (auto &link : T->Links)
+        {
+        for (auto &slot : link.second->Slots)
+            {
+            if (isUsed(Stream))
+                {
+                slot->useSlot();
+                }
+            }
+        }
+}
+
+size_t Benchmarks::get_HeapUsage()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,74 @@
+#ifndef BENCHMARKFIXTURES_H
+#define BENCHMARKFIXTURES_H
+
+#include <memory>
+#include <vector>
+#include <Structure/Topology.h>
+#include <GeneralClasses/RandomGenerator.h>
+#include <GeneralClasses/Signal.h>
+
+class Call;
+
+/**
+ * @brief The Benchmarks namespace contains the fixtures shared by the
+ * microbenchmarks of the simulator's hot kernels.
+ *
+ * The bundled topologies are read from data/topologies, so the benchmarks must
+ * run from the root of the repository. Every fixture draws its random numbers
+ * from a fixed RandomGenerator, so that two runs measure the same work.
+ */
+namespace Benchmarks
+{
+#define X(a,b,c) + 1
+/**
+ * @brief NumTopologies is the number of bundled topologies.
+ */
+constexpr int NumTopologies = 0 DEFAULT_TOPOLOGIES;
+#undef X
+
+/**
+ * @brief NumCalls is the number of call requests each benchmark cycles over.
+ */
+constexpr unsigned NumCalls = 256;
+
+/**
+ * @brief create_Topology loads a fresh instance of a bundled topology.
+ */
+std::shared_ptr<Topology> create_Topology(Topology::DefaultTopologies Top);
+/**
+ * @brief get_TopologyName returns the name of a bundled topology.
+ */
+std::string get_TopologyName(Topology::DefaultTopologies Top);
+
+/**
+ * @brief create_Calls creates NumCalls call requests between random nodes, with
+ * random bitrates, and with the most efficient default modulation scheme.
+ */
+std::vector<std::shared_ptr<Call>> create_Calls(std::shared_ptr<Topology> T,
+                                RandomGenerator &Stream);
+/**
+ * @brief create_Routes returns the shortest path of each call.
+ */
+std::vector<std::vector<std::weak_ptr<Link>>> create_Routes(
+    std::shared_ptr<Topology> T, std::vector<std::shared_ptr<Call>> &Calls);
+/**
+ * @brief assign_Slots assigns, with the First Fit algorithm, the slots of each
+ * call over its route. The slots are not used, so the topology is unchanged.
+ */
+std::vector<mapSlots> assign_Slots(std::shared_ptr<Topology> T,
+                                   std::vector<std::shared_ptr<Call>> &Calls,
+                                   std::vector<std::vector<std::weak_ptr<Link>>> &Routes);
+/**
+ * @brief fill_Spectrum occupies each slot of each link with probability
+ * \a Occupancy.
+ */
+void fill_Spectrum(std::shared_ptr<Topology> T, double Occupancy,
+                   RandomGenerator &Stream);
+/**
+ * @brief get_HeapUsage returns the number of bytes allocated on the heap, or 0
+ * if the C library can not tell it.
+ */
+size_t get_HeapUsage();
+}
+
+#endif // BENCHMARKFIXTURES_H
@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+#include "BenchmarkFixtures.h"
+#include <Calls/EventCalendar.h>
+#include <random>
+
+/**
+ * Hold model: each iteration pops the earliest event and pushes a later one,
+ * so the calendar keeps a constant number of pending events.
+ * Argument: number of pending events.
+ */
+static void BM_EventCalendarHold(benchmark::State &State)
+{
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    std::exponential_distribution<double> Interval(1);
+
+    EventCalendar Calendar;
+    Calendar.reserve(State.range(0));
+    for (unsigned e = 0; e < (unsigned) State.range(0); e++)
+        {
+        Calendar.push(Event(Interval(Stream), Event::CallEnding, e));
+        }
+
+    for (auto _ : State)
+        {
+        Event evt = Calendar.top();
+        Calendar.pop();
+        evt.t += Interval(Stream);
+        Calendar.push(evt);
+        }
+
+    State.SetItemsProcessed(State.iterations());
+}
+
+BENCHMARK(BM_EventCalendarHold)->RangeMultiplier(8)->Range(64, 1 << 16);
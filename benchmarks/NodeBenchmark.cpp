@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+#include "BenchmarkFixtures.h"
+#include <Structure/Link.h>
+#include <Structure/Node.h>
+#include <Calls/Call.h>
+
+extern bool considerFilterImperfection;
+
+/**
+ * Bypasses the signal of NumCalls random requests through the first link of
+ * their shortest paths and the node after it, cycling over them. With the
+ * filter imperfection, Node::bypass evaluates the crosstalk from every other
+ * incoming link of the node, so the difference between both arguments is
+ * dominated by Node::evalCrosstalk.
+ * Arguments: whether the filter imperfection is considered, and topology.
+ */
+static void BM_NodeCrosstalk(benchmark::State &State)
+{
+    considerFilterImperfection = State.range(0);
+    auto Top = (Topology::DefaultTopologies) State.range(1);
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto T = Benchmarks::create_Topology(Top);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+    auto Routes = Benchmarks::create_Routes(T, Calls);
+    auto Slots = Benchmarks::assign_Slots(T, Calls, Routes);
+
+    unsigned c = 0;
+    for (auto _ : State)
+        {
+        auto FirstLink = Routes[c].front().lock();
+        Signal S(Slots[c]);
+        FirstLink->bypass(S);
+        benchmark::DoNotOptimize(FirstLink->Destination.lock()->bypass(S));
+        c = (c + 1) % Benchmarks::NumCalls;
+        }
+
+    considerFilterImperfection = false;
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(std::string(State.range(0) ? "filter" : "nofilter") + "/" +
+                   Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_NodeCrosstalk)->ArgsProduct(
+    {
+    {0, 1},
+    benchmark::CreateDenseRange(0, Benchmarks::NumTopologies - 1, 1)
+    });
@@ -0,0 +1,253 @@
+#include <benchmark/benchmark.h>
+#include "BenchmarkFixtures.h"
+#include <Structure/Link.h>
+#include <Structure/Slot.h>
+#include <Structure/TopologyGenerator.h>
+#include <RMSA/RoutingAlgorithms/RoutingAlgorithm.h>
+#include <RMSA/RoutingAlgorithms/Algorithms/Dijkstra_RoutingAlgorithm.h>
+#include <RMSA/RoutingAlgorithms/Algorithms/Yen_RoutingAlgorithm.h>
+#include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeriesRouting.h>
+#include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs.h>
+#include <chrono>
+
+using namespace RMSA::ROUT;
+
+/**
+ * Routes NumCalls random requests, cycling over them. Yen's algorithm searches
+ * the routes of every call, without a route table.
+ * Arguments: routing algorithm, routing cost and topology.
+ *
+ * The power series routing costs and the AWR are measured by
+ * BM_PowerSeriesRouting, since they need coefficients.
+ */
+static void BM_Routing(benchmark::State &State)
+{
+    auto Alg = (RoutingAlgorithm::RoutingAlgorithms) State.range(0);
+    auto Cost = (RoutingCost::RoutingCosts) State.range(1);
+    auto Top = (Topology::DefaultTopologies) State.range(2);
+
+    Yen_RoutingAlgorithm::kShortestPaths = 3;
+    Yen_RoutingAlgorithm::useRouteTable = false;
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto T = Benchmarks::create_Topology(Top);
+    auto R_Alg = RoutingAlgorithm::create_RoutingAlgorithm(Alg, Cost, T, false);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+
+    unsigned c = 0;
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(R_Alg->route(Calls[c]));
+        c = (c + 1) % Benchmarks::NumCalls;
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(RoutingAlgorithm::RoutingAlgorithmNicknames.left.at(Alg) + "/" +
+                   RoutingCost::RoutingCostsNicknames.left.at(Cost) + "/" +
+                   Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_Routing)->ArgsProduct(
+    {
+    benchmark::CreateDenseRange(RoutingAlgorithm::bellmanford,
+    RoutingAlgorithm::yen, 1),
+    {RoutingCost::SP, RoutingCost::MH, RoutingCost::LORa, RoutingCost::LORc},
+    benchmark::CreateDenseRange(0, Benchmarks::NumTopologies - 1, 1)
+    });
+
+/**
+ * Routes with Yen's algorithm looking up a route table, and computes the route
+ * table, which is counted in the BuildTime counter, in seconds.
+ * Arguments: static routing cost and topology.
+ */
+static void BM_RouteTable(benchmark::State &State)
+{
+    auto Cost = (RoutingCost::RoutingCosts) State.range(0);
+    auto Top = (Topology::DefaultTopologies) State.range(1);
+
+    Yen_RoutingAlgorithm::kShortestPaths = 3;
+    Yen_RoutingAlgorithm::useRouteTable = true;
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto T = Benchmarks::create_Topology(Top);
+    auto R_Alg = RoutingAlgorithm::create_RoutingAlgorithm(RoutingAlgorithm::yen,
+                 Cost, T, false);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+
+    auto Start = std::chrono::steady_clock::now();
+    RouteTable Table(T, Cost, 3);
+    State.counters["BuildTime"] = std::chrono::duration<double>
+                                  (std::chrono::steady_clock::now() - Start).count();
+    R_Alg->route(Calls[0]);
+
+    unsigned c = 0;
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(R_Alg->route(Calls[c]));
+        c = (c + 1) % Benchmarks::NumCalls;
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(RoutingCost::RoutingCostsNicknames.left.at(Cost) + "/" +
+                   Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_RouteTable)->ArgsProduct(
+    {
+    {RoutingCost::SP, RoutingCost::MH},
+    benchmark::CreateDenseRange(0, Benchmarks::NumTopologies - 1, 1)
+    });
+
+/**
+ * Routes with Dijkstra over a topology where every slot was used with
+ * probability 1/2, so that the costs that depend on the spectrum occupation
+ * read a fragmented spectrum.
+ * Arguments: routing cost and topology.
+ */
+static void BM_RoutingLoaded(benchmark::State &State)
+{
+    auto Cost = (RoutingCost::RoutingCosts) State.range(0);
+    auto Top = (Topology::DefaultTopologies) State.range(1);
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto T = Benchmarks::create_Topology(Top);
+    auto R_Alg = RoutingAlgorithm::create_RoutingAlgorithm(RoutingAlgorithm::dijkstra,
+                 Cost, T, false);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+
+    std::bernoulli_distribution isUsed(0.5);
+    for (auto &link : T->Links)
+        {
+        for (auto &slot : link.second->Slots)
+            {
+            if (isUsed(Stream))
+                {
+                slot->useSlot();
+                }
+            }
+        }
+
+    unsigned c = 0;
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(R_Alg->route(Calls[c]));
+        c = (c + 1) % Benchmarks::NumCalls;
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(RoutingCost::RoutingCostsNicknames.left.at(Cost) + "/" +
+                   Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_RoutingLoaded)->ArgsProduct(
+    {
+    {RoutingCost::LORa, RoutingCost::LORc},
+    benchmark::CreateDenseRange(0, Benchmarks::NumTopologies - 1, 1)
+    });
+
+/**
+ * Routes with Dijkstra over grids of growing size, searching from the origin
+ * only or from both ends.
+ * Arguments: number of nodes and whether the search is bidirectional.
+ */
+static void BM_DijkstraScaling(benchmark::State &State)
+{
+    unsigned int NumNodes = State.range(0);
+    Dijkstra_RoutingAlgorithm::useBidirectionalSearch = State.range(1);
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto T = TopologyGenerator(TopologyGenerator::Grid, NumNodes).create();
+    auto R_Alg = RoutingAlgorithm::create_RoutingAlgorithm(RoutingAlgorithm::dijkstra,
+                 RoutingCost::SP, T, false);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+
+    unsigned c = 0;
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(R_Alg->route(Calls[c]));
+        c = (c + 1) % Benchmarks::NumCalls;
+        }
+
+    Dijkstra_RoutingAlgorithm::useBidirectionalSearch = false;
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(State.range(1) ? "bidirectional" : "unidirectional");
+}
+
+BENCHMARK(BM_DijkstraScaling)->ArgsProduct(
+    {
+    {64, 256, 1024, 4096},
+    {0, 1}
+    });
+
+/**
+ * Routes with Dijkstra's algorithm under a PSR variant, over a half occupied
+ * topology. The power series has the availability, contiguity and link length
+ * costs, with exponents from 0 to 3, and arbitrary coefficients.
+ * Arguments: PSR variant and topology.
+ */
+static void BM_PowerSeriesRouting(benchmark::State &State)
+{
+    auto Variant = (PSR::PowerSeriesRouting::Variants) State.range(0);
+    auto Top = (Topology::DefaultTopologies) State.range(1);
+    const int NMin = 0, NMax = 3;
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto T = Benchmarks::create_Topology(Top);
+    Benchmarks::fill_Spectrum(T, 0.5, Stream);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+
+    std::vector<std::shared_ptr<PSR::Cost>> Costs;
+    for (auto cost : {PSR::Cost::availability, PSR::Cost::contiguity, PSR::Cost::linklength})
+        {
+        Costs.push_back(PSR::Cost::createCost(cost, NMin, NMax, T));
+        }
+    auto RCost = PSR::PowerSeriesRouting::createPSR(T, Costs, Variant);
+
+    //As many coefficients as the PSR optimization gives to each variant
+    unsigned int NumTerms = std::pow(NMax - NMin + 1, Costs.size());
+    unsigned int NumCoefficients = 0;
+    switch (Variant)
+        {
+        case PSR::PowerSeriesRouting::Variant_AWR:
+            NumCoefficients = Costs.size() - 1;
+            break;
+        case PSR::PowerSeriesRouting::Variant_LocalPSR:
+            NumCoefficients = NumTerms * T->Nodes.size() * (T->Nodes.size() - 1);
+            break;
+        case PSR::PowerSeriesRouting::Variant_MatricialPSR:
+            NumCoefficients = NumTerms;
+            break;
+        case PSR::PowerSeriesRouting::Variant_TensorialPSR:
+            NumCoefficients = Costs.size() * (NMax - NMin + 1);
+            break;
+        }
+    std::uniform_real_distribution<double> CoefficientDistribution(0, 1);
+    std::vector<double> Coefficients;
+    for (unsigned int c = 0; c < NumCoefficients; c++)
+        {
+        Coefficients.push_back(CoefficientDistribution(Stream));
+        }
+    RCost->initCoefficients(Coefficients);
+
+    auto R_Alg = RoutingAlgorithm::create_RoutingAlgorithm(RoutingAlgorithm::dijkstra,
+                 RoutingCost::SP, T, false);
+    R_Alg->RCost = RCost;
+
+    unsigned c = 0;
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(R_Alg->route(Calls[c]));
+        c = (c + 1) % Benchmarks::NumCalls;
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(PSR::PowerSeriesRouting::VariantNicknames.left.at(Variant) + "/" +
+                   Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_PowerSeriesRouting)->ArgsProduct(
+    {
+    benchmark::CreateDenseRange(PSR::PowerSeriesRouting::Variant_AWR,
+    PSR::PowerSeriesRouting::Variant_TensorialPSR, 1),
+    benchmark::CreateDenseRange(0, Benchmarks::NumTopologies - 1, 1)
+    });
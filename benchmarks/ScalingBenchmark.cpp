@@ -0,0 +1,238 @@
+#include <benchmark/benchmark.h>
+#include "BenchmarkFixtures.h"
+#include <deque>
+#include <Calls/Call.h>
+#include <Structure/Link.h>
+#include <Structure/RoutingGraph.h>
+#include <Structure/Slot.h>
+#include <Structure/TopologyGenerator.h>
+#include <RMSA/RoutingAlgorithms/RoutingAlgorithm.h>
+#include <RMSA/RoutingAlgorithms/Algorithms/Dijkstra_RoutingAlgorithm.h>
+#include <RMSA/RoutingAlgorithms/Algorithms/Yen_RoutingAlgorithm.h>
+#include <RMSA/SpectrumAssignmentAlgorithms/SpectrumAssignmentAlgorithm.h>
+#include <RMSA/TransparentSegment.h>
+
+using namespace RMSA;
+
+/**
+ * Hold model over a generated topology: each iteration routes a random call
+ * with the shortest path cost, assigns its slots over the first route where
+ * they fit and uses them, and releases the oldest call once there are as many
+ * active calls as nodes. The time per item is the time to establish a call.
+ * Arguments: topology model, number of nodes, routing algorithm and spectrum
+ * assignment algorithm.
+ *
+ * The HeapBytes counter is the memory taken by the topology and by the
+ * algorithms, and Blocking is the fraction of calls that found no slots.
+ */
+static void BM_Scaling(benchmark::State &State)
+{
+    auto Model = (TopologyGenerator::TopologyModels) State.range(0);
+    unsigned NumNodes = State.range(1);
+    auto R_Alg = (ROUT::RoutingAlgorithm::RoutingAlgorithms) State.range(2);
+    auto SA_Alg = (SA::SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithms)
+                  State.range(3);
+
+    ROUT::Yen_RoutingAlgorithm::kShortestPaths = 3;
+    //Precomputing the routes of every pair would dominate at these sizes
+    ROUT::Yen_RoutingAlgorithm::useRouteTable = false;
+
+    size_t HeapUsage = Benchmarks::get_HeapUsage();
+    auto T = TopologyGenerator(Model, NumNodes).create();
+    auto Routing = ROUT::RoutingAlgorithm::create_RoutingAlgorithm(R_Alg,
+                   ROUT::RoutingCost::SP, T, false);
+    auto Assignment =
+        SA::SpectrumAssignmentAlgorithm::create_SpectrumAssignmentAlgorithm(SA_Alg, T);
+    T->get_RoutingGraph();
+    HeapUsage = Benchmarks::get_HeapUsage() - HeapUsage;
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+
+    std::deque<std::vector<std::weak_ptr<Slot>>> ActiveCalls;
+    unsigned long NumBlocked = 0;
+    unsigned c = 0;
+
+    for (auto _ : State)
+        {
+        auto &C = Calls[c];
+        c = (c + 1) % Benchmarks::NumCalls;
+
+        std::vector<std::weak_ptr<Slot>> UsedSlots;
+        for (auto &route : Routing->route(C))
+            {
+            if (route.empty())
+                {
+                continue;
+                }
+
+            auto Slots = Assignment->assignSlots(C, TransparentSegment(route, C->Scheme));
+            for (auto &link : Slots)
+                {
+                for (auto &slot : link.second)
+                    {
+                    slot.lock()->useSlot();
+                    UsedSlots.push_back(slot);
+                    }
+                }
+
+            if (!Slots.empty())
+                {
+                break;
+                }
+            }
+
+        NumBlocked += UsedSlots.empty();
+        ActiveCalls.push_back(std::move(UsedSlots));
+
+        if (ActiveCalls.size() > NumNodes)
+            {
+            for (auto &slot : ActiveCalls.front())
+                {
+                slot.lock()->freeSlot();
+                }
+            ActiveCalls.pop_front();
+            }
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.counters["HeapBytes"] = HeapUsage;
+    State.counters["Blocking"] = 1.0 * NumBlocked / State.iterations();
+    State.SetLabel(TopologyGenerator::TopologyModelsNicknames.left.at(Model) + "/" +
+                   ROUT::RoutingAlgorithm::RoutingAlgorithmNicknames.left.at(R_Alg) + "/" +
+                   SA::SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithmNicknames.left.at(
+                       SA_Alg));
+}
+
+//Every routing algorithm over every model, with First Fit.
+BENCHMARK(BM_Scaling)->ArgsProduct(
+    {
+    {
+#define X(a,b,c) TopologyGenerator::a,
+        TOPOLOGY_MODELS
+#undef X
+    },
+    {50, 200, 1000},
+    benchmark::CreateDenseRange(ROUT::RoutingAlgorithm::bellmanford,
+    ROUT::RoutingAlgorithm::yen, 1),
+    {SA::SpectrumAssignmentAlgorithm::FF}
+    })->Unit(benchmark::kMicrosecond);
+
+//Every spectrum assignment algorithm but the FFE, with Dijkstra over Waxman.
+BENCHMARK(BM_Scaling)->ArgsProduct(
+    {
+    {TopologyGenerator::Waxman},
+    {50, 200, 1000},
+    {ROUT::RoutingAlgorithm::dijkstra},
+    {
+        SA::SpectrumAssignmentAlgorithm::BF, SA::SpectrumAssignmentAlgorithm::EF,
+        SA::SpectrumAssignmentAlgorithm::LU, SA::SpectrumAssignmentAlgorithm::MU,
+        SA::SpectrumAssignmentAlgorithm::RF
+    }
+    })->Unit(benchmark::kMicrosecond);
+
+/**
+ * Hold model as in BM_Scaling, routing with Dijkstra under the LORa cost, that
+ * changes with the occupation of the links, either searching every route or
+ * reading it from repaired shortest path trees.
+ * Arguments: number of nodes of a Waxman topology, number of nodes from which
+ * the calls depart (every node if zero) and whether the trees are used.
+ *
+ * A tree is repaired for the links changed since its origin was last routed,
+ * so the trees pay off when there are few origins for the calls.
+ */
+static void BM_DynamicRouting(benchmark::State &State)
+{
+    unsigned NumNodes = State.range(0);
+    unsigned NumOrigins = State.range(1);
+    ROUT::Dijkstra_RoutingAlgorithm::useDynamicTrees = State.range(2);
+
+    auto T = TopologyGenerator(TopologyGenerator::Waxman, NumNodes).create();
+    auto Routing = ROUT::RoutingAlgorithm::create_RoutingAlgorithm(
+                       ROUT::RoutingAlgorithm::dijkstra, ROUT::RoutingCost::LORa, T, false);
+    auto Assignment = SA::SpectrumAssignmentAlgorithm::create_SpectrumAssignmentAlgorithm(
+                          SA::SpectrumAssignmentAlgorithm::FF, T);
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+    for (unsigned i = 0; NumOrigins != 0 && i < Calls.size(); i++)
+        {
+        Calls[i]->Origin = T->Nodes[i % NumOrigins];
+        if (Calls[i]->Origin.lock() == Calls[i]->Destination.lock())
+            {
+            Calls[i]->Origin = T->Nodes[(i + 1) % NumOrigins];
+            }
+        }
+
+    std::deque<std::vector<std::weak_ptr<Slot>>> ActiveCalls;
+    unsigned c = 0;
+
+    auto notify = [&](const std::vector<std::weak_ptr<Slot>> &Slots)
+        {
+        for (unsigned s = 0; s < Slots.size(); s++)
+            {
+            //The slots of a link are contiguous
+            Link *Owner = Slots[s].lock()->Owner;
+            if (s == 0 || Owner != Slots[s - 1].lock()->Owner)
+                {
+                Routing->notify_LinkChanged(Owner->Index);
+                }
+            }
+        };
+
+    //Establishes a call, releasing the oldest one once there are as many active
+    //calls as nodes
+    auto establish = [&]()
+        {
+        auto &C = Calls[c];
+        c = (c + 1) % Benchmarks::NumCalls;
+
+        std::vector<std::weak_ptr<Slot>> UsedSlots;
+        auto route = Routing->route(C).front();
+        if (!route.empty())
+            {
+            for (auto &link : Assignment->assignSlots(C, TransparentSegment(route, C->Scheme)))
+                {
+                for (auto &slot : link.second)
+                    {
+                    slot.lock()->useSlot();
+                    UsedSlots.push_back(slot);
+                    }
+                }
+            }
+        notify(UsedSlots);
+        ActiveCalls.push_back(std::move(UsedSlots));
+
+        if (ActiveCalls.size() > NumNodes)
+            {
+            for (auto &slot : ActiveCalls.front())
+                {
+                slot.lock()->freeSlot();
+                }
+            notify(ActiveCalls.front());
+            ActiveCalls.pop_front();
+            }
+        };
+
+    //Only the steady state is measured, after the trees were built
+    for (unsigned i = 0; i < Benchmarks::NumCalls; i++)
+        {
+        establish();
+        }
+
+    for (auto _ : State)
+        {
+        establish();
+        }
+
+    ROUT::Dijkstra_RoutingAlgorithm::useDynamicTrees = false;
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(State.range(2) ? "trees" : "search");
+}
+
+BENCHMARK(BM_DynamicRouting)->ArgsProduct(
+    {
+    {50, 200, 1000},
+    {0, 4},
+    {0, 1}
+    })->Unit(benchmark::kMicrosecond);
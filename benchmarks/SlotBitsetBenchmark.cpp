@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+#include <Structure/SlotBitset.h>
+#include <random>
+
+/**
+ * Runs the first fit search, the contiguity measure and the availability over
+ * a grid with a fifth of its slots occupied at random.
+ * Arguments: number of slots and number of required slots. The widths 200 and
+ * 500 are not specialised, and measure the generic queries.
+ */
+static void BM_SlotBitsetQueries(benchmark::State &State)
+{
+    unsigned NumSlots = State.range(0);
+    unsigned Length = State.range(1);
+
+    std::mt19937 Generator(0);
+    std::bernoulli_distribution isFree(0.8);
+    SlotBitset Bits(NumSlots);
+    for (unsigned s = 0; s < NumSlots; s++)
+        {
+        if (isFree(Generator))
+            {
+            Bits.set(s);
+            }
+        }
+
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(Bits.find_FirstRun(Length));
+        benchmark::DoNotOptimize(Bits.get_NumPositions(Length));
+        benchmark::DoNotOptimize(Bits.count());
+        }
+
+    State.SetItemsProcessed(State.iterations());
+}
+
+BENCHMARK(BM_SlotBitsetQueries)->ArgsProduct(
+    {
+        {64, 128, 200, 320, 384, 500}, {4, 16}
+    });
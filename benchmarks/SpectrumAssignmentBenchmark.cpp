@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include "BenchmarkFixtures.h"
+#include <RMSA/SpectrumAssignmentAlgorithms/SpectrumAssignmentAlgorithm.h>
+#include <RMSA/TransparentSegment.h>
+#include <Calls/Call.h>
+
+using namespace RMSA::SA;
+
+/**
+ * Assigns the slots of NumCalls random requests over their shortest paths,
+ * cycling over them. The slots are not used, so the occupancy stays constant.
+ * Arguments: spectrum assignment algorithm, occupancy (in percent) and topology.
+ *
+ * The FFE is not measured, since it needs a previously optimized slot order.
+ */
+static void BM_SpectrumAssignment(benchmark::State &State)
+{
+    auto Alg = (SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithms)
+               State.range(0);
+    double Occupancy = State.range(1) / 100.0;
+    auto Top = (Topology::DefaultTopologies) State.range(2);
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto T = Benchmarks::create_Topology(Top);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+    auto Routes = Benchmarks::create_Routes(T, Calls);
+    auto SA_Alg = SpectrumAssignmentAlgorithm::create_SpectrumAssignmentAlgorithm(
+                      Alg, T);
+    Benchmarks::fill_Spectrum(T, Occupancy, Stream);
+
+    std::vector<RMSA::TransparentSegment> Segments;
+    for (unsigned c = 0; c < Benchmarks::NumCalls; c++)
+        {
+        Segments.push_back(RMSA::TransparentSegment(Routes[c], Calls[c]->Scheme));
+        }
+
+    unsigned c = 0;
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(SA_Alg->assignSlots(Calls[c], Segments[c]));
+        c = (c + 1) % Benchmarks::NumCalls;
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithmNicknames.left.at(
+                       Alg) + "/" + std::to_string(State.range(1)) + "%/" +
+                   Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_SpectrumAssignment)->ArgsProduct(
+    {
+    {
+        SpectrumAssignmentAlgorithm::BF, SpectrumAssignmentAlgorithm::EF,
+        SpectrumAssignmentAlgorithm::FF, SpectrumAssignmentAlgorithm::LU,
+        SpectrumAssignmentAlgorithm::MU, SpectrumAssignmentAlgorithm::RF
+    },
+    {0, 25, 50, 75},
+    benchmark::CreateDenseRange(0, Benchmarks::NumTopologies - 1, 1)
+    });
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include "BenchmarkFixtures.h"
+#include <cstdio>
+#include <Structure/TopologyGenerator.h>
+#include <Structure/Link.h>
+#include <Structure/Slot.h>
+#include <Structure/TopologyPool.h>
+#include <SimulationTypes/NetworkFork.h>
+
+/**
+ * Copies a topology, as every sweep point, particle and individual does before
+ * simulating over it.
+ * Argument: topology.
+ */
+static void BM_TopologyCopy(benchmark::State &State)
+{
+    auto Top = (Topology::DefaultTopologies) State.range(0);
+    auto T = Benchmarks::create_Topology(Top);
+    T->set_avgSpanLength(80);
+
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(std::make_shared<Topology>(*T));
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_TopologyCopy)->DenseRange(0, Benchmarks::NumTopologies - 1);
+
+/**
+ * Acquires a copy of a topology from a pool, as the particles and individuals
+ * do, uses a slot of each link and releases it.
+ * Argument: topology.
+ */
+static void BM_TopologyAcquire(benchmark::State &State)
+{
+    auto Top = (Topology::DefaultTopologies) State.range(0);
+    auto T = Benchmarks::create_Topology(Top);
+    T->set_avgSpanLength(80);
+    TopologyPool Pool(T);
+
+    for (auto _ : State)
+        {
+        auto Copy = Pool.acquire();
+        for (auto &link : Copy->Links)
+            {
+            link.second->Slots.front()->useSlot();
+            }
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_TopologyAcquire)->DenseRange(0, Benchmarks::NumTopologies - 1);
+
+/**
+ * Loads a generated Waxman topology from a text file and from a binary file.
+ * Arguments: number of nodes and whether the file is binary.
+ */
+static void BM_TopologyLoad(benchmark::State &State)
+{
+    unsigned NumNodes = State.range(0);
+    bool isBinary = State.range(1);
+    const std::string FileName = "BM_TopologyLoad.topology";
+
+    auto T = TopologyGenerator(TopologyGenerator::Waxman, NumNodes).create();
+    std::remove(FileName.c_str());
+    isBinary ? T->save_Binary(FileName) : T->save(FileName);
+
+    for (auto _ : State)
+        {
+        benchmark::DoNotOptimize(std::make_shared<Topology>(FileName));
+        }
+
+    std::remove(FileName.c_str());
+    State.SetItemsProcessed(State.iterations() * T->Links.size());
+    State.SetLabel(isBinary ? "binary" : "text");
+}
+
+BENCHMARK(BM_TopologyLoad)->ArgsProduct({{100, 1000, 5000}, {0, 1}})
+->Unit(benchmark::kMillisecond);
+
+/**
+ * Forks the state of a topology and implements a connection on the fork, as a
+ * lookahead RMSA does for every candidate decision, instead of copying the
+ * topology.
+ * Argument: topology.
+ */
+static void BM_NetworkFork(benchmark::State &State)
+{
+    auto Top = (Topology::DefaultTopologies) State.range(0);
+    auto T = Benchmarks::create_Topology(Top);
+    auto Root = std::make_shared<Simulations::NetworkFork>(T, 0);
+
+    Simulations::NetworkFork::Connection C;
+    C.Slots = {{0, 0}, {0, 1}};
+
+    for (auto _ : State)
+        {
+        auto Fork = Root->fork();
+        Fork->implement(C, 1);
+        benchmark::DoNotOptimize(Fork);
+        }
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_NetworkFork)->DenseRange(0, Benchmarks::NumTopologies - 1);
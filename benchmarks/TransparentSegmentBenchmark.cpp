@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+#include "BenchmarkFixtures.h"
+#include <RMSA/TransparentSegment.h>
+#include <Calls/Call.h>
+
+extern bool considerFilterImperfection;
+
+/**
+ * Evaluates the signal of NumCalls random requests after their shortest paths,
+ * cycling over them. Each iteration creates the signal and bypasses it through
+ * the segment, as the QoT check of the RMSA does.
+ * Arguments: whether the filter imperfection is considered, and topology.
+ */
+static void BM_TransparentSegmentBypass(benchmark::State &State)
+{
+    considerFilterImperfection = State.range(0);
+    auto Top = (Topology::DefaultTopologies) State.range(1);
+
+    RandomGenerator Stream(0, 0, RandomGenerator::CallsStream);
+    auto T = Benchmarks::create_Topology(Top);
+    auto Calls = Benchmarks::create_Calls(T, Stream);
+    auto Routes = Benchmarks::create_Routes(T, Calls);
+    auto Slots = Benchmarks::assign_Slots(T, Calls, Routes);
+
+    std::vector<RMSA::TransparentSegment> Segments;
+    for (unsigned c = 0; c < Benchmarks::NumCalls; c++)
+        {
+        Segments.push_back(RMSA::TransparentSegment(Routes[c], Calls[c]->Scheme));
+        }
+
+    unsigned c = 0;
+    for (auto _ : State)
+        {
+        Segments[c].opticalPathSpecDensity.clear();
+        benchmark::DoNotOptimize(Segments[c].bypass(Signal(Slots[c])));
+        c = (c + 1) % Benchmarks::NumCalls;
+        }
+
+    considerFilterImperfection = false;
+
+    State.SetItemsProcessed(State.iterations());
+    State.SetLabel(std::string(State.range(0) ? "filter" : "nofilter") + "/" +
+                   Benchmarks::get_TopologyName(Top));
+}
+
+BENCHMARK(BM_TransparentSegmentBypass)->ArgsProduct(
+    {
+    {0, 1},
+    benchmark::CreateDenseRange(0, Benchmarks::NumTopologies - 1, 1)
+    });
@@ -0,0 +1,12 @@
+#include <benchmark/benchmark.h>
+
+//Globals otherwise defined by the simulator's main.cpp
+namespace Simulations
+{
+bool parallelism_enabled = false;
+}
+
+bool considerAseNoise = false;
+bool considerFilterImperfection = false;
+
+BENCHMARK_MAIN();
@@ -3,7 +3,10 @@
 
 #include <Calls/Call.h>
 #include <Calls/CallGenerator.h>
+#include <Calls/CallTrace.h>
+#include <Calls/ConnectionIndex.h>
 #include <Calls/Event.h>
+#include <Calls/EventCalendar.h>
 
 #endif // CALLS_H
 
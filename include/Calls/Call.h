@@ -6,7 +6,11 @@
 #include <GeneralClasses/ModulationScheme.h>
 
 class Node;
-class Event;
+
+namespace RMSA
+{
+class Route;
+}
 
 /**
  * @brief The Call class is the standard object representing a connection
@@ -59,13 +63,13 @@ public:
          ModulationScheme Scheme);
 
     /**
-     * @brief CallRequisition is a pointer to the requisition event.
+     * @brief ArrivalTime is the instant of the call requisition.
      */
-    std::weak_ptr<Event> CallRequisition;
+    double ArrivalTime;
     /**
-     * @brief CallEnding is a pointer to the ending event.
+     * @brief EndingTime is the instant when the call ends, if implemented.
      */
-    std::weak_ptr<Event> CallEnding;
+    double EndingTime;
     /**
      * @brief Origin is a pointer to the origin node.
      */
@@ -97,6 +101,11 @@ public:
      * @brief blockingReason specifies the reason why the call was blocked.
      */
     uint8_t blockingReason;
+    /**
+     * @brief route is a pointer to the Route used to stablish the Call.
+     * If did not succeeded to stablish, then this is a pointer to nullptr.
+     */
+    std::shared_ptr<RMSA::Route> route;
 };
 
 #endif // CALL_H
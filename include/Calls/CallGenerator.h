@@ -3,13 +3,15 @@
 
 #include <memory>
 #include <random>
-#include <queue>
+#include <deque>
 #include <Structure/Topology.h>
 #include <GeneralClasses/TransmissionBitrate.h>
+#include <GeneralClasses/RandomGenerator.h>
+#include <Calls/Call.h>
+#include <Calls/EventCalendar.h>
+#include <Calls/CallTrace.h>
 
-class Event;
 class Topology;
-class Call;
 
 /**
  * @brief The CallGenerator class implements methods to continuously generate
@@ -19,41 +21,37 @@ class Call;
  * distribution and the call duration and arrival times are chosen with
  * exponential distributions, the former with parameter mu and the latter
  * with parameter 1/h.
+ *
+ * The generated calls are stored in a pool owned by the generator, and their
+ * slots are recycled as soon as they are released. The pointers returned by
+ * generate_Call() and get_Call() do not own the calls: they remain valid until
+ * release_Call() is called over the call, or until the generator is destroyed.
+ *
+ * The generated calls can be recorded to a CallTrace with record_Trace(). With
+ * replay_Trace(), the calls are read from a CallTrace instead of being sampled.
  */
 class CallGenerator
 {
-private:
-    /**
-     * @brief The EventCompare struct is used to compare two events. Associated
-     * with the priority_queue, this comparison organizes the events in increasing
-     * order of their occurral times.
-     */
-    struct EventCompare
-    {
-        bool operator()(const std::shared_ptr<Event> a,
-                        const std::shared_ptr<Event> b) const;
-    };
-
 public:
     /**
      * @brief CallGenerator is the standard constructor for a CallGenerator.
      * @param T is the topology over which the calls are generated.
      * @param h is the parameter for the call interarrival time distribution.
      * @param Bitrates is a vector with the possible transmission bitrates.
+     * @param Stream is the random stream used to generate the calls.
      */
     CallGenerator(std::shared_ptr<Topology> T, double h,
                   std::vector<TransmissionBitrate> Bitrates
-                  = TransmissionBitrate::DefaultBitrates);
+                  = TransmissionBitrate::DefaultBitrates,
+                  RandomGenerator Stream = RandomGenerator());
 
     /**
-     * @brief Events is a priority queue.
+     * @brief Events is the event calendar.
      *
      * The Events of the topology are stored here in increasing order of their
      * ocurring times.
      */
-    std::priority_queue <std::shared_ptr<Event>,
-        std::vector<std::shared_ptr<Event>>,
-        EventCompare> Events;
+    EventCalendar Events;
 
     /**
      * @brief T is the Topology over which the calls are generated.
@@ -76,20 +74,76 @@ public:
      * @brief Bitrates is a vector containing the possible bitrates.
      */
     std::vector<TransmissionBitrate> Bitrates;
+    /**
+     * @brief Stream is the random stream used to generate the calls.
+     */
+    RandomGenerator Stream;
     /**
      * @brief generate_Call chooses at random an origin, a destination, a bitrate
      * and creates a call. Its arrival time and duration are chosen with the
      * exponential distributions determined by \a h and \a mu.
      *
-     * @return a shared_ptr to a Call.
+     * Only the call requisition is scheduled. The call ending must be scheduled
+     * with schedule_CallEnding() if the call gets implemented.
+     *
+     * @return a non-owning shared_ptr to a Call, or nullptr if the replayed
+     * trace is over.
      */
     std::shared_ptr<Call> generate_Call();
+    /**
+     * @brief get_Call returns the call whose index is \a index.
+     * @param index is the index of the call, as stored in its events.
+     * @return a non-owning shared_ptr to a Call.
+     */
+    std::shared_ptr<Call> get_Call(unsigned index);
+    /**
+     * @brief schedule_CallEnding schedules the ending of the call whose index
+     * is \a index.
+     * @param index is the index of the call, as stored in its events.
+     */
+    void schedule_CallEnding(unsigned index);
+    /**
+     * @brief release_Call returns the call whose index is \a index to the pool,
+     * so that its slot can be reused by a new call.
+     * @param index is the index of the call, as stored in its events.
+     */
+    void release_Call(unsigned index);
     /**
      * @brief set_Load is used to set a new value to the network load of this
      * Generator.
      * @param load is the new load, in Erlangs.
      */
     void set_Load(double load);
+    /**
+     * @brief record_Trace records every call generated from now on.
+     * @param FileName is the name of the trace file.
+     */
+    void record_Trace(std::string FileName);
+    /**
+     * @brief replay_Trace reads the calls from a trace, instead of sampling them.
+     * @param FileName is the name of the trace file.
+     */
+    void replay_Trace(std::string FileName);
+    /**
+     * @brief Trace is the trace being recorded or replayed, if any.
+     */
+    std::shared_ptr<CallTrace> Trace;
+
+    /**
+     * @brief save_State writes the state of this generator into a binary stream:
+     * the simulation time, the random stream, the pending events and every call
+     * in the pool, with the resources used by the implemented ones.
+     *
+     * Only the slots, links, nodes and regenerators of the routes are written, as
+     * that is all that is needed to drop a call. Traces being recorded cannot be
+     * resumed, so the state can not be saved while recording.
+     */
+    void save_State(std::ostream &Out);
+    /**
+     * @brief load_State restores the state written by save_State(). The topology
+     * T must be equal to the one of the generator that saved the state.
+     */
+    void load_State(std::istream &In);
 
 private:
     //Distributions
@@ -98,6 +152,10 @@ private:
     std::exponential_distribution<double> ExponentialDistributionMu;
     std::exponential_distribution<double> ExponentialDistributionH;
 
+    //Call pool. A deque never relocates its elements when growing.
+    std::deque<Call> CallPool;
+    std::vector<unsigned> FreeCalls;
+
 };
 
 #endif // CALLGENERATOR_H
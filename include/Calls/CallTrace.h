@@ -0,0 +1,142 @@
+#ifndef CALLTRACE_H
+#define CALLTRACE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include <GeneralClasses/TransmissionBitrate.h>
+
+class Topology;
+
+/**
+ * @brief The CallTrace class stores a stream of call requests in a compact
+ * binary file.
+ *
+ * A trace can be recorded by a CallGenerator while it samples calls, and then
+ * replayed by other CallGenerators as their source of calls. Traces can also be
+ * imported from CSV connection logs with import_CSV().
+ *
+ * The file has a fixed size header followed by the records. Recording uses
+ * buffered writes, while replaying memory-maps the file.
+ */
+class CallTrace
+{
+public:
+    /**
+     * @brief The Trace_Mode enum is used to specify whether the trace is being
+     * recorded or replayed.
+     */
+    enum Trace_Mode
+    {
+        Recording, /*!< Calls are written to the trace. */
+        Replaying /*!< Calls are read from the trace. */
+    };
+
+    /**
+     * @brief The CallRecord struct is the binary representation of a call
+     * request.
+     */
+    struct CallRecord
+    {
+        double ArrivalTime; /*!< Instant of the call requisition. */
+        double HoldingTime; /*!< Duration of the call. */
+        uint16_t Origin; /*!< Index of the origin node in Topology::Nodes. */
+        uint16_t Destination; /*!< Index of the destination node in Topology::Nodes. */
+        uint16_t Bitrate; /*!< Index of the bitrate in the generator bitrates. */
+        uint16_t Reserved;
+    };
+
+    /**
+     * @brief CallTrace opens a trace file. A trace to be replayed is rejected
+     * if its header is invalid or announces more records than the file holds.
+     * @param FileName is the name of the trace file.
+     * @param Mode is whether the trace will be recorded or replayed.
+     */
+    CallTrace(std::string FileName, Trace_Mode Mode);
+    ~CallTrace();
+    CallTrace(const CallTrace &) = delete;
+    CallTrace &operator=(const CallTrace &) = delete;
+
+    /**
+     * @brief write appends a record to a trace being recorded.
+     */
+    void write(const CallRecord &Record);
+    /**
+     * @brief read returns the next record of a trace being replayed.
+     * @return a pointer to the next record, or nullptr if the trace is over.
+     */
+    const CallRecord *read();
+    /**
+     * @brief rewind restarts replaying the trace from its first record.
+     */
+    void rewind();
+    /**
+     * @brief get_Position returns the index of the next record to be replayed.
+     */
+    uint64_t get_Position() const;
+    /**
+     * @brief set_Position sets the index of the next record to be replayed.
+     */
+    void set_Position(uint64_t Position);
+    /**
+     * @brief close finishes the recording or releases the mapped file.
+     */
+    void close();
+
+    /**
+     * @brief get_NumRecords returns the number of records on the trace.
+     */
+    uint64_t get_NumRecords() const;
+    /**
+     * @brief Mode is whether the trace is being recorded or replayed.
+     */
+    const Trace_Mode Mode;
+
+    /**
+     * @brief import_CSV converts a CSV connection log into a trace.
+     *
+     * Each line must contain the arrival time, the holding time, the origin and
+     * destination node IDs and the bitrate, in bits per second, separated by
+     * commas. Lines that do not start with a number, such as headers, are
+     * ignored. Arrival times must be non-decreasing. If a line is invalid, the
+     * import is aborted, naming the line, and no trace is left behind.
+     *
+     * @param CSVFileName is the name of the CSV file.
+     * @param TraceFileName is the name of the trace file to be created.
+     * @param T is the Topology whose nodes appear on the log.
+     * @param Bitrates is the vector of bitrates used by the CallGenerator.
+     * @return the number of imported calls.
+     */
+    static uint64_t import_CSV(std::string CSVFileName, std::string TraceFileName,
+                               std::shared_ptr<Topology> T,
+                               std::vector<TransmissionBitrate> Bitrates
+                               = TransmissionBitrate::DefaultBitrates);
+
+private:
+    struct TraceHeader
+    {
+        char Magic[8];
+        uint32_t Version;
+        uint32_t RecordSize;
+        uint64_t NumRecords;
+    };
+
+    static const char TraceMagic[8];
+    static constexpr uint32_t TraceVersion = 1;
+
+    std::string FileName;
+    uint64_t NumRecords;
+
+    //Recording
+    std::ofstream OutFile;
+
+    //Replaying
+    void *Mapping;
+    size_t MappingSize;
+    const CallRecord *Records;
+    uint64_t NextRecord;
+};
+
+#endif // CALLTRACE_H
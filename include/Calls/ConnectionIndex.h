@@ -0,0 +1,105 @@
+#ifndef CONNECTIONINDEX_H
+#define CONNECTIONINDEX_H
+
+#include <vector>
+
+namespace RMSA
+{
+class Route;
+}
+
+/**
+ * @brief The ConnectionIndex class is a reverse index from the links and nodes
+ * of a topology to the active connections that traverse them.
+ *
+ * The connections are identified by the index of their Call in the
+ * CallGenerator's call pool. Each link and node keeps an unordered list of the
+ * connections traversing it, and each connection remembers its position in each
+ * of these lists, so that inserting and erasing a connection take time
+ * proportional to the length of its route, regardless of how many connections
+ * are active.
+ */
+class ConnectionIndex
+{
+public:
+    /**
+     * @brief ConnectionIndex is the standard constructor for an empty index.
+     * @param NumLinks is the number of links of the topology.
+     * @param NumNodes is the number of nodes of the topology.
+     */
+    ConnectionIndex(unsigned NumLinks = 0, unsigned NumNodes = 0);
+
+    /**
+     * @brief reset empties the index, and sizes it for a topology with
+     * \a NumLinks links and \a NumNodes nodes.
+     */
+    void reset(unsigned NumLinks, unsigned NumNodes);
+    /**
+     * @brief insert adds the connection \a Call, implemented over \a route, to
+     * the lists of the links and nodes of the route.
+     */
+    void insert(unsigned Call, const RMSA::Route &route);
+    /**
+     * @brief erase removes the connection \a Call from the index, if present.
+     */
+    void erase(unsigned Call);
+    /**
+     * @brief contains returns true iff the connection \a Call is indexed.
+     */
+    bool contains(unsigned Call) const;
+
+    /**
+     * @brief get_LinkConnections returns the connections that traverse the link
+     * with index \a LinkIndex, in no particular order.
+     */
+    std::vector<unsigned> get_LinkConnections(unsigned LinkIndex) const;
+    /**
+     * @brief get_NodeConnections returns the connections that traverse the node
+     * with index \a NodeIndex, including those that start or end on it, in no
+     * particular order.
+     */
+    std::vector<unsigned> get_NodeConnections(unsigned NodeIndex) const;
+    /**
+     * @brief get_NumConnections returns the number of indexed connections.
+     */
+    unsigned long get_NumConnections() const
+    {
+        return NumConnections;
+    }
+
+private:
+    /**
+     * @brief The Entry struct is a connection on the list of a link or node.
+     * Membership is the position of the list in the memberships of the call.
+     */
+    struct Entry
+    {
+        unsigned Call;
+        unsigned Membership;
+    };
+    /**
+     * @brief The Membership struct is a list in which a connection is, and its
+     * position in that list.
+     */
+    struct Membership
+    {
+        unsigned List;
+        unsigned Position;
+    };
+
+    void add(unsigned List, unsigned Call);
+    std::vector<unsigned> get_Connections(unsigned List) const;
+
+    unsigned NumLinks;
+    unsigned long NumConnections;
+    /**
+     * @brief Lists has the list of each link, followed by the list of each node.
+     */
+    std::vector<std::vector<Entry>> Lists;
+    /**
+     * @brief Memberships has, for each call index, the lists the call is in.
+     */
+    std::vector<std::vector<Membership>> Memberships;
+};
+
+#endif // CONNECTIONINDEX_H
@@ -1,18 +1,14 @@
 #ifndef EVENT_H
 #define EVENT_H
 
-#include <memory>
-
-class Call;
-
-namespace RMSA
-{
-class Route;
-}
-
 /**
  * @brief The Event class represents an event that happened in the network. Is
- * either a call requisition or a call ending.
+ * either a call requisition or a call ending, or the failure or repair of a link
+ * or node.
+ *
+ * Events are small value types: they refer to their owner Call through its
+ * index in the CallGenerator's call pool, and to the failed or repaired element
+ * through its index in the NetworkState.
  */
 class Event
 {
@@ -20,22 +16,28 @@ public:
     /**
     * @brief The Event_Type enum is used to specify the type of event.
     *
-    * Each call generates two events, a CallRequisition on its start and a
-    * CallEnding on its ending.
+    * Each call generates a CallRequisition on its start. A CallEnding is only
+    * scheduled if the call was implemented. The failures and repairs are
+    * scheduled by the NetworkSimulation.
     */
     enum Event_Type
     {
         CallRequisition, /*!< Event on the starting call. */
-        CallEnding /*!< Event on the ending call. */
+        CallEnding, /*!< Event on the ending call. */
+        LinkFailure, /*!< Event on the failing link. */
+        LinkRepair, /*!< Event on the repaired link. */
+        NodeFailure, /*!< Event on the failing node. */
+        NodeRepair /*!< Event on the repaired node. */
     };
 
     /**
      * @brief Event is the constructor of a Event.
      * @param t is the instant of ocurral of the Event.
      * @param Type is the type of Event.
-     * @param Parent if a pointer to the owner Call of this Event.
+     * @param Parent is the index of the owner Call of this Event, or of the
+     * link or node that fails or is repaired.
      */
-    Event(double t, Event_Type Type, std::shared_ptr<Call> Parent);
+    Event(double t, Event_Type Type, unsigned Parent);
 
     /**
      * @brief operator > is used to compare the ocurral instants of two events.
@@ -62,14 +64,10 @@ public:
      */
     Event_Type Type;
     /**
-     * @brief Parent is a pointer to the Call that owns this Event.
-     */
-    std::shared_ptr<Call> Parent;
-    /**
-     * @brief route is a pointer to the Route used to stablish the Parent Call.
-     * If did not succeeded to stablish, then this is a pointer to nullptr.
+     * @brief Parent is the index of the Call that owns this Event, or the index
+     * of the link or node that fails or is repaired.
      */
-    std::shared_ptr<RMSA::Route> route;
+    unsigned Parent;
 };
 
 #endif // EVENT_H
@@ -0,0 +1,77 @@
+#ifndef EVENTCALENDAR_H
+#define EVENTCALENDAR_H
+
+#include <vector>
+#include <cstddef>
+#include <Calls/Event.h>
+
+/**
+ * @brief The EventCalendar class stores the pending events of a simulation in
+ * increasing order of their occurral times.
+ *
+ * The events are stored by value in a 4-ary min-heap. This keeps the heap
+ * shallow and the children of a node on the same cache line, while avoiding any
+ * allocation after the underlying vector reaches its steady-state size.
+ */
+class EventCalendar
+{
+public:
+    /**
+     * @brief EventCalendar is the standard constructor for an empty calendar.
+     */
+    EventCalendar();
+
+    /**
+     * @brief push inserts an Event into the calendar.
+     * @param evt is the Event.
+     */
+    void push(const Event &evt);
+    /**
+     * @brief pop removes the earliest Event from the calendar.
+     */
+    void pop();
+    /**
+     * @brief top returns the earliest Event of the calendar.
+     * @return the earliest Event of the calendar.
+     */
+    const Event &top() const
+    {
+        return Heap.front();
+    }
+    /**
+     * @brief empty is true iff there are no pending events.
+     */
+    bool empty() const
+    {
+        return Heap.empty();
+    }
+    /**
+     * @brief size returns the number of pending events.
+     */
+    std::size_t size() const
+    {
+        return Heap.size();
+    }
+    /**
+     * @brief clear removes every pending event, keeping the allocated storage.
+     */
+    void clear();
+    /**
+     * @brief reserve preallocates storage for \a n events.
+     */
+    void reserve(std::size_t n);
+    /**
+     * @brief get_Events returns the pending events, in heap order. Pushing them
+     * into an empty calendar, in this order, rebuilds the very same calendar.
+     */
+    const std::vector<Event> &get_Events() const
+    {
+        return Heap;
+    }
+
+private:
+    static constexpr std::size_t Arity = 4;
+    std::vector<Event> Heap;
+};
+
+#endif // EVENTCALENDAR_H
@@ -1,13 +1,18 @@
 #ifndef GENERALCLASSES_H
 #define GENERALCLASSES_H
 
+#include <GeneralClasses/BatchMeans.h>
 #include <GeneralClasses/Gain.h>
+#include <GeneralClasses/MetricsStream.h>
 #include <GeneralClasses/ModulationScheme.h>
 #include <GeneralClasses/PhysicalConstants.h>
 #include <GeneralClasses/Power.h>
+#include <GeneralClasses/Profiler.h>
 #include <GeneralClasses/RandomGenerator.h>
+#include <GeneralClasses/RingBuffer.h>
 #include <GeneralClasses/Signal.h>
 #include <GeneralClasses/TransmissionBitrate.h>
+#include <GeneralClasses/WarmupDetector.h>
 
 #endif // GENERALCLASSES_H
 
@@ -0,0 +1,91 @@
+#ifndef BATCHMEANS_H
+#define BATCHMEANS_H
+
+#include <vector>
+#include <iosfwd>
+
+/**
+ * @brief The BatchMeans class implements an online batch means estimator.
+ *
+ * The observations are grouped in consecutive batches. The sample variance of
+ * the batch means is used to build a Student's t confidence interval for the
+ * mean of a correlated sequence of observations.
+ *
+ * The number of batches is kept bounded: once \a MaxBatches batches are
+ * complete, each pair of consecutive batches is merged and the batch size is
+ * doubled.
+ */
+class BatchMeans
+{
+public:
+    /**
+     * @brief BatchMeans is the standard constructor for a BatchMeans.
+     * @param BatchSize is the initial number of observations per batch.
+     * @param MaxBatches is the maximum number of complete batches. Must be even.
+     */
+    BatchMeans(unsigned long BatchSize = 1000, unsigned MaxBatches = 64);
+
+    /**
+     * @brief add adds a new observation.
+     * @param x is the observation.
+     * @return true iff this observation completed a batch.
+     */
+    bool add(double x);
+    /**
+     * @brief reset discards every observation, and restores the initial batch
+     * size.
+     */
+    void reset();
+
+    /**
+     * @brief get_Mean returns the mean of every observation.
+     * @return the mean of every observation.
+     */
+    double get_Mean() const;
+    /**
+     * @brief get_HalfWidth returns the half-width of the confidence interval of
+     * the mean, estimated with the complete batches.
+     * @param ConfidenceLevel is the confidence level, in (0, 1).
+     * @return the half-width of the confidence interval, or infinity if there
+     * are less than two complete batches.
+     */
+    double get_HalfWidth(double ConfidenceLevel) const;
+    /**
+     * @brief get_NumBatches returns the number of complete batches.
+     * @return the number of complete batches.
+     */
+    unsigned get_NumBatches() const;
+    /**
+     * @brief get_NumObservations returns the number of observations.
+     * @return the number of observations.
+     */
+    unsigned long get_NumObservations() const;
+    /**
+     * @brief get_BatchSize returns the current number of observations per batch.
+     * @return the current number of observations per batch.
+     */
+    unsigned long get_BatchSize() const;
+
+    /**
+     * @brief save_State writes the state of this estimator into a binary stream.
+     */
+    void save_State(std::ostream &Stream) const;
+    /**
+     * @brief load_State restores the state written by save_State().
+     */
+    void load_State(std::istream &Stream);
+
+private:
+    unsigned long InitialBatchSize;
+    unsigned long BatchSize;
+    unsigned MaxBatches;
+
+    unsigned long NumObservations;
+    double Sum;
+
+    unsigned long CurrentBatchCount;
+    double CurrentBatchSum;
+    std::vector<double> BatchSums;
+};
+
+#endif // BATCHMEANS_H
@@ -0,0 +1,124 @@
+#ifndef BINARYSTREAM_H
+#define BINARYSTREAM_H
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief The BinaryStream namespace contains helpers to write and read raw
+ * values to and from binary streams, as used by the simulation checkpoints.
+ *
+ * Only trivially copyable values are allowed, and they are stored in the native
+ * byte order, so a binary file is only meant to be read back on the machine
+ * that wrote it.
+ */
+namespace BinaryStream
+{
+/**
+ * @brief hash returns the 64-bit FNV-1a hash of \a Size bytes of \a Data.
+ * @param Hash is the hash of the preceding bytes, if the hash is continued.
+ */
+inline uint64_t hash(const void *Data, size_t Size,
+                     uint64_t Hash = 14695981039346656037ULL)
+{
+    const unsigned char *Bytes = static_cast<const unsigned char *>(Data);
+    for (size_t i = 0; i < Size; i++)
+        {
+        Hash = (Hash ^ Bytes[i]) * 1099511628211ULL;
+        }
+    return Hash;
+}
+
+/**
+ * @brief write writes the raw bytes of \a Value into \a Stream.
+ */
+template<class T>
+inline void write(std::ostream &Stream, const T &Value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable types can be written.");
+    Stream.write(reinterpret_cast<const char *>(&Value), sizeof(T));
+}
+
+/**
+ * @brief read reads the raw bytes of \a Value from \a Stream.
+ */
+template<class T>
+inline void read(std::istream &Stream, T &Value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable types can be read.");
+    Stream.read(reinterpret_cast<char *>(&Value), sizeof(T));
+}
+
+/**
+ * @brief write writes the size of \a Values, followed by its elements.
+ */
+template<class T>
+inline void write(std::ostream &Stream, const std::vector<T> &Values)
+{
+    write(Stream, (uint64_t) Values.size());
+    for (auto &Value : Values)
+        {
+        write(Stream, (T) Value);
+        }
+}
+
+/**
+ * @brief read reads a vector written by write().
+ */
+template<class T>
+inline void read(std::istream &Stream, std::vector<T> &Values)
+{
+    uint64_t Size;
+    read(Stream, Size);
+
+    //A damaged size ends the read at the end of the stream, instead of
+    //exhausting the memory
+    Values.clear();
+    Values.reserve(std::min<uint64_t>(Size, 1 << 20));
+    for (uint64_t i = 0; i < Size && Stream; i++)
+        {
+        T Value;
+        read(Stream, Value);
+        Values.push_back(Value);
+        }
+}
+
+/**
+ * @brief write specialization for std::vector<bool>, stored one byte per element.
+ */
+inline void write(std::ostream &Stream, const std::vector<bool> &Values)
+{
+    write(Stream, (uint64_t) Values.size());
+    for (bool Value : Values)
+        {
+        write(Stream, (uint8_t) Value);
+        }
+}
+
+/**
+ * @brief read specialization for std::vector<bool>.
+ */
+inline void read(std::istream &Stream, std::vector<bool> &Values)
+{
+    uint64_t Size;
+    read(Stream, Size);
+
+    Values.clear();
+    Values.reserve(std::min<uint64_t>(Size, 1 << 20));
+    for (uint64_t i = 0; i < Size && Stream; i++)
+        {
+        uint8_t Value;
+        read(Stream, Value);
+        Values.push_back(Value);
+        }
+}
+}
+
+#endif // BINARYSTREAM_H
@@ -28,6 +28,10 @@ public:
      * @brief Gain is the copy constructor of Gain.
      */
     Gain(const Gain &);
+    /**
+     * @brief operator = is the copy assignment of Gain.
+     */
+    Gain &operator=(const Gain &) = default;
 
     /**
      * @brief operator - returns the symmetrical Gain.
@@ -6,18 +6,76 @@
 #include <Structure/Slot.h>
 #include <vector>
 #include <memory>
-#include <map>
 
+/**
+ * @brief The LinkSpectralDensity class holds the power spectral density of the
+ * signals in every slot of a link.
+ *
+ * The samples of all slots are stored in a single contiguous row, with
+ * Slot::samplesPerSlot samples per slot, so that the spectral density of a set
+ * of contiguous slots is a single view into it. It is only allocated when the
+ * filter imperfection is considered.
+ */
 class LinkSpectralDensity
 {
 public:
-    LinkSpectralDensity(std::vector<std::shared_ptr<Slot>>);
-    std::vector<std::shared_ptr<Slot>> LinkSlots;
-    void updateLink(SpectralDensity, std::vector<std::weak_ptr<Slot>>);
-    std::vector<std::shared_ptr<SpectralDensity>> S;
-    static unsigned long numFrequencySamples;
+    /**
+     * @brief LinkSpectralDensity is the standard constructor. Every slot starts
+     * with zero spectral density.
+     * @param NumSlots is the number of slots in the link.
+     */
+    LinkSpectralDensity(unsigned int NumSlots);
+
+    /**
+     * @brief updateLink copies the spectral density of a signal into the slots it
+     * occupies.
+     * @param thisSpecDensity is the spectral density of the signal.
+     * @param Slots are the contiguous slots occupied by the signal.
+     */
+    void updateLink(const SpectralDensity &thisSpecDensity,
+                    const std::vector<std::weak_ptr<Slot>> &Slots);
+    /**
+     * @brief slice returns the spectral density over a set of contiguous slots.
+     */
     std::shared_ptr<SpectralDensity> slice
-    (std::vector<std::weak_ptr<Slot>> usedSlots);
+    (const std::vector<std::weak_ptr<Slot>> &usedSlots) const;
+    /**
+     * @brief clear_Slot zeroes the spectral density of a slot.
+     */
+    void clear_Slot(unsigned int numSlot);
+
+    /**
+     * @brief get_Samples returns a pointer to the Slot::samplesPerSlot samples of
+     * a slot. The samples of the next slots follow contiguously.
+     */
+    double *get_Samples(unsigned int numSlot)
+    {
+        return Samples.memptr() + numSlot * Slot::samplesPerSlot;
+    }
+    const double *get_Samples(unsigned int numSlot) const
+    {
+        return Samples.memptr() + numSlot * Slot::samplesPerSlot;
+    }
+    /**
+     * @brief get_DensityScaling returns the gains and losses over the signal in a
+     * slot.
+     */
+    Gain get_DensityScaling(unsigned int numSlot) const
+    {
+        return DensityScaling[numSlot];
+    }
+    /**
+     * @brief set_DensityScaling sets the gains and losses over the signal in a
+     * slot.
+     */
+    void set_DensityScaling(unsigned int numSlot, Gain G)
+    {
+        DensityScaling[numSlot] = G;
+    }
+
+private:
+    arma::rowvec Samples;
+    std::vector<Gain> DensityScaling;
 };
 
 #endif // LINKSPECTRALDENSITY_H
@@ -0,0 +1,84 @@
+#ifndef METRICSSTREAM_H
+#define METRICSSTREAM_H
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <GeneralClasses/RingBuffer.h>
+
+/**
+ * @brief The MetricsStream class writes a time series of the metrics of a
+ * running simulation into a CSV file.
+ *
+ * The simulation pushes samples into a lock-free RingBuffer, and a background
+ * thread writes them into the file, so the simulation never waits on I/O. If
+ * the writer falls so far behind that the buffer fills up, new samples are
+ * dropped and counted instead. The file is flushed after each batch of samples,
+ * so it can be followed while the simulation runs.
+ */
+class MetricsStream
+{
+public:
+    /**
+     * @brief The Sample struct holds the metrics of a simulation at an instant.
+     */
+    struct Sample
+    {
+        double SimulationTime; //!< Simulated time of the sample.
+        unsigned long NumCalls; //!< Number of call requests counted so far.
+        /**
+         * @brief IntervalBlockingProbability is the call blocking probability
+         * among the call requests since the previous sample.
+         */
+        double IntervalBlockingProbability;
+        double LinkUtilisation; //!< Fraction of the slots currently in use.
+        unsigned long ActiveCalls; //!< Number of calls currently implemented.
+        unsigned long RegeneratorsInUse; //!< Number of regenerators currently in use.
+    };
+
+    /**
+     * @brief DefaultCapacity is the default number of samples the buffer holds.
+     */
+    static constexpr std::size_t DefaultCapacity = 4096;
+
+    /**
+     * @brief MetricsStream opens the file and starts the writer thread.
+     * @param FileName is the file where the samples are written.
+     * @param Capacity is the number of samples the buffer holds.
+     * @param Append is true if the samples are appended to an existing file.
+     * Otherwise, the file is replaced, starting with a header.
+     */
+    MetricsStream(std::string FileName, std::size_t Capacity = DefaultCapacity,
+                  bool Append = false);
+    /**
+     * @brief ~MetricsStream writes the remaining samples and stops the writer
+     * thread.
+     */
+    ~MetricsStream();
+    MetricsStream(const MetricsStream &) = delete;
+    MetricsStream &operator=(const MetricsStream &) = delete;
+
+    /**
+     * @brief push hands a sample to the writer thread, without blocking. Must
+     * always be called from the same thread.
+     * @return false if the buffer is full, in which case the sample is dropped.
+     */
+    bool push(const Sample &S);
+    /**
+     * @brief get_NumDroppedSamples returns the number of samples dropped because
+     * the buffer was full.
+     */
+    unsigned long get_NumDroppedSamples() const;
+
+private:
+    RingBuffer<Sample> Buffer;
+    std::ofstream File;
+    std::atomic<bool> isClosing;
+    std::atomic<unsigned long> NumDroppedSamples;
+    std::thread Writer;
+
+    void write_Samples();
+};
+
+#endif // METRICSSTREAM_H
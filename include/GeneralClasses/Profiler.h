@@ -0,0 +1,159 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <boost/bimap.hpp>
+
+/**
+ * @brief The Profiler class collects the time spent on each phase of the call
+ * processing, such as routing or spectrum assignment.
+ *
+ * The phases are instrumented with the PROFILE_PHASE macro, which only expands
+ * to a ScopedTimer if the simulator is compiled with RUN_PROFILER (qmake
+ * CONFIG+=profiler). Otherwise, the instrumentation costs nothing.
+ *
+ * Each phase has a latency histogram with logarithmic buckets: bucket i counts
+ * the occurrences that took less than 2^i nanoseconds (and at least 2^(i-1)).
+ * If compiled with RUN_PROFILER_PERF (qmake CONFIG+=profiler_perf), hardware
+ * counters are also read with perf_event_open at the beginning and at the end
+ * of every phase. That costs two system calls per phase, so the latencies are
+ * then inflated. The statistics are kept per thread, and merged by dump_JSON().
+ *
+ * Phases may be nested (e.g. the QoT evaluations inside the regenerator
+ * assignment), in which case the time of the inner phase is also counted in the
+ * outer one.
+ */
+class Profiler
+{
+public:
+#define PROFILER_PHASES \
+    X(EventQueue, "Event Queue", "eventqueue") \
+    X(Routing, "Routing", "routing") \
+    X(SpectrumAssignment, "Spectrum Assignment", "spectrumassignment") \
+    X(QualityOfTransmission, "Quality of Transmission", "qot") \
+    X(RegeneratorAssignment, "Regenerator Assignment", "regeneratorassignment") \
+    X(SlotUse, "Slot Use", "slotuse") \
+    X(SlotFree, "Slot Free", "slotfree") //X Macros
+
+#define X(a,b,c) a,
+    /**
+     * @brief The Phase enum lists the instrumented phases of the call processing.
+     */
+    enum Phase
+    {
+        PROFILER_PHASES
+        NumPhases
+    };
+#undef X
+
+#define PROFILER_HARDWARE_COUNTERS \
+    X(Cycles, "cycles") \
+    X(Instructions, "instructions") \
+    X(CacheMisses, "cache_misses") \
+    X(BranchMisses, "branch_misses") //X Macros
+
+#define X(a,b) a,
+    /**
+     * @brief The Hardware_Counter enum lists the hardware counters read when
+     * compiled with RUN_PROFILER_PERF.
+     */
+    enum Hardware_Counter
+    {
+        PROFILER_HARDWARE_COUNTERS
+        NumHardwareCounters
+    };
+#undef X
+
+    typedef boost::bimap<Phase, std::string> PhaseNicknameBimap;
+    static PhaseNicknameBimap PhaseNicknames;
+    typedef boost::bimap<Phase, std::string> PhaseNameBimap;
+    static PhaseNameBimap PhaseNames;
+
+    /**
+     * @brief NumBuckets is the number of buckets of each latency histogram. The
+     * last bucket also counts every longer occurrence.
+     */
+    static constexpr unsigned NumBuckets = 40;
+
+    /**
+     * @brief The PhaseStatistics struct holds the statistics of a phase.
+     */
+    struct PhaseStatistics
+    {
+        uint64_t Count;
+        uint64_t TotalTime; //!< In nanoseconds.
+        uint64_t MinTime; //!< In nanoseconds.
+        uint64_t MaxTime; //!< In nanoseconds.
+        uint64_t Histogram[NumBuckets];
+        uint64_t HardwareCounters[NumHardwareCounters];
+    };
+
+    /**
+     * @brief The ScopedTimer class times a phase from its construction until its
+     * destruction.
+     */
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer(Phase P);
+        ~ScopedTimer();
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        Phase P;
+        std::chrono::steady_clock::time_point Start;
+        uint64_t StartCounters[NumHardwareCounters];
+    };
+
+    /**
+     * @brief record adds an occurrence of a phase to the statistics of the calling
+     * thread.
+     * @param P is the phase.
+     * @param Time is the duration of the occurrence, in nanoseconds.
+     * @param Counters is the increment of each hardware counter, or nullptr.
+     */
+    static void record(Phase P, uint64_t Time, const uint64_t *Counters = nullptr);
+    /**
+     * @brief get_Statistics returns the statistics of a phase, merged over every
+     * thread.
+     */
+    static PhaseStatistics get_Statistics(Phase P);
+    /**
+     * @brief get_Bucket returns the histogram bucket of a duration.
+     * @param Time is the duration, in nanoseconds.
+     */
+    static unsigned get_Bucket(uint64_t Time);
+    /**
+     * @brief dump_JSON writes the statistics of every phase, merged over every
+     * thread, into a JSON file.
+     */
+    static void dump_JSON(std::string FileName);
+    /**
+     * @brief reset discards the statistics of every thread.
+     */
+    static void reset();
+    /**
+     * @brief read_HardwareCounters reads the hardware counters of the calling
+     * thread.
+     * @return false if the counters are not available.
+     */
+    static bool read_HardwareCounters(uint64_t Counters[NumHardwareCounters]);
+};
+
+#define PROFILER_CONCATENATE_IMPL(a, b) a##b
+#define PROFILER_CONCATENATE(a, b) PROFILER_CONCATENATE_IMPL(a, b)
+
+#ifdef RUN_PROFILER
+/**
+ * @brief PROFILE_PHASE times the rest of the enclosing scope as the given phase.
+ */
+#define PROFILE_PHASE(Phase) \
+    Profiler::ScopedTimer PROFILER_CONCATENATE(ProfilerTimer_, __LINE__)(Profiler::Phase)
+#else
+#define PROFILE_PHASE(Phase)
+#endif
+
+#endif // PROFILER_H
@@ -2,12 +2,123 @@
 #define RANDOMGENERATOR
 
 #include <random>
+#include <cstdint>
 
 /**
- * @brief random_generator is the random engine used to generate random numbers,
- * with several probabilist distributions, through the whole simulator.
+ * @brief The RandomGenerator class is a counter-based random engine, that
+ * implements the Philox4x32-10 generator.
+ *
+ * Each engine outputs the encryption of a 128-bit counter with a 64-bit key.
+ * The counter is formed by a 64-bit position and by two 32-bit stream
+ * identifiers (the sweep point and the replication), while the key is formed by
+ * the master seed and by a substream identifier. Therefore, the streams are
+ * reproducible and independent from each other, regardless of the order in which
+ * they are used or of the thread that uses them, and jumping ahead in a stream
+ * has constant cost.
+ *
+ * This class satisfies the UniformRandomBitGenerator requirements, so it can be
+ * used with the distributions in \<random\>.
  */
-static std::default_random_engine random_generator(0);
+class RandomGenerator
+{
+public:
+    /**
+     * @brief result_type is the type of the generated numbers.
+     */
+    typedef uint32_t result_type;
 
-#endif // RANDOMGENERATOR
+    /**
+     * @brief The Substream enum is used to separate the streams used by the
+     * different components of a same simulation.
+     */
+    enum Substream
+    {
+        CallsStream, /*!< Used by the CallGenerator. */
+        SpectrumAssignmentStream, /*!< Used by the spectrum assignment algorithms. */
+        RegeneratorPlacementStream, /*!< Used by the regenerator placement algorithms. */
+        OptimizerStream, /*!< Used by the optimization algorithms. */
+        TopologyStream /*!< Used by the topology generators. */
+    };
+
+    /**
+     * @brief RandomGenerator is the standard constructor for a RandomGenerator.
+     * @param SweepPoint identifies the point of the parameter sweep.
+     * @param Replication identifies the replication of the point.
+     * @param Sub identifies the component that uses the stream.
+     * @param Seed is the master seed.
+     */
+    RandomGenerator(uint32_t SweepPoint = 0, uint32_t Replication = 0,
+                    Substream Sub = CallsStream, uint64_t Seed = MasterSeed);
+
+    /**
+     * @brief operator () returns the next random number of the stream.
+     */
+    result_type operator()()
+    {
+        if (Index == 4)
+            {
+            generate_Block();
+            }
+        return Output[Index++];
+    }
+    /**
+     * @brief min is the smallest value that can be generated.
+     */
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+    /**
+     * @brief max is the largest value that can be generated.
+     */
+    static constexpr result_type max()
+    {
+        return UINT32_MAX;
+    }
+
+    /**
+     * @brief discard jumps ahead \a n numbers in the stream.
+     */
+    void discard(uint64_t n);
+    /**
+     * @brief get_Position returns how many numbers were generated by the stream.
+     */
+    uint64_t get_Position() const;
+    /**
+     * @brief set_Position moves the stream to the position \a n.
+     */
+    void set_Position(uint64_t n);
+
+    /**
+     * @brief MasterSeed is the seed used by default by every stream.
+     */
+    static uint64_t MasterSeed;
+
+    /**
+     * @brief philox applies the Philox4x32-10 bijection over a counter.
+     * @param Counter is the 128-bit counter. It is overwritten with the result.
+     * @param Key is the 64-bit key.
+     */
+    static void philox(uint32_t Counter[4], const uint32_t Key[2]);
 
+private:
+    uint32_t Key[2];
+    uint32_t StreamID[2];
+    uint64_t Block;
+    uint32_t Output[4];
+    unsigned Index;
+
+    void generate_Block();
+};
+
+/**
+ * @brief random_generator is the random engine used by the serial parts of the
+ * optimization algorithms.
+ *
+ * Code that can run inside a parallel region must use its own RandomGenerator,
+ * such as the ones owned by CallGenerator, SpectrumAssignmentAlgorithm and
+ * RegeneratorPlacementAlgorithm.
+ */
+extern RandomGenerator random_generator;
+
+#endif // RANDOMGENERATOR
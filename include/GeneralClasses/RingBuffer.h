@@ -0,0 +1,94 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The RingBuffer class is a bounded lock-free queue with a single
+ * producer thread and a single consumer thread.
+ *
+ * Neither push() nor pop() ever blocks: they fail if the buffer is respectively
+ * full or empty. The capacity is rounded up to a power of two, and the producer
+ * and consumer indexes lie on different cache lines, so that each thread only
+ * writes to its own line.
+ */
+template<class T>
+class RingBuffer
+{
+public:
+    /**
+     * @brief RingBuffer is the standard constructor for an empty RingBuffer.
+     * @param Capacity is the minimum number of elements the buffer can hold.
+     */
+    RingBuffer(std::size_t Capacity) : Head(0), Tail(0)
+    {
+        std::size_t Size = 1;
+        while (Size < Capacity)
+            {
+            Size <<= 1;
+            }
+
+        Elements.resize(Size);
+        Mask = Size - 1;
+    }
+    RingBuffer(const RingBuffer &) = delete;
+    RingBuffer &operator=(const RingBuffer &) = delete;
+
+    /**
+     * @brief push inserts an element at the end of the buffer. Must only be
+     * called by the producer thread.
+     * @return false if the buffer is full, in which case nothing is inserted.
+     */
+    bool push(const T &Element)
+    {
+        std::size_t CurrentTail = Tail.load(std::memory_order_relaxed);
+        if (CurrentTail - Head.load(std::memory_order_acquire) > Mask)
+            {
+            return false;
+            }
+
+        Elements[CurrentTail & Mask] = Element;
+        Tail.store(CurrentTail + 1, std::memory_order_release);
+        return true;
+    }
+    /**
+     * @brief pop removes the element at the beginning of the buffer. Must only be
+     * called by the consumer thread.
+     * @param Element receives the removed element.
+     * @return false if the buffer is empty, in which case Element is unchanged.
+     */
+    bool pop(T &Element)
+    {
+        std::size_t CurrentHead = Head.load(std::memory_order_relaxed);
+        if (CurrentHead == Tail.load(std::memory_order_acquire))
+            {
+            return false;
+            }
+
+        Element = Elements[CurrentHead & Mask];
+        Head.store(CurrentHead + 1, std::memory_order_release);
+        return true;
+    }
+    /**
+     * @brief capacity returns the number of elements the buffer can hold.
+     */
+    std::size_t capacity() const
+    {
+        return Mask + 1;
+    }
+
+private:
+    static constexpr std::size_t CacheLineSize = 64;
+
+    std::vector<T> Elements;
+    std::size_t Mask;
+    char HeadPadding[CacheLineSize];
+    std::atomic<std::size_t> Head; //!< Next element to pop. Written by the consumer.
+    char TailPadding[CacheLineSize];
+    std::atomic<std::size_t> Tail; //!< Next position to push. Written by the producer.
+    char EndPadding[CacheLineSize];
+};
+
+#endif // RINGBUFFER_H
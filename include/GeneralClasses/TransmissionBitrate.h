@@ -31,6 +31,11 @@ public:
      * @brief TransmissionBitrate is the copy constructor.
      */
     TransmissionBitrate(const TransmissionBitrate &);
+    /**
+     * @brief operator = is the copy assignment, so that a TransmissionBitrate
+     * can be reassigned, as the Calls recycled by the CallGenerator are.
+     */
+    TransmissionBitrate &operator=(const TransmissionBitrate &) = default;
     /**
      * @brief get_Bitrate returns the value of the bitrate, in bits per second.
      * @return the value of the bitrate, in bits per second.
@@ -0,0 +1,86 @@
+#ifndef WARMUPDETECTOR_H
+#define WARMUPDETECTOR_H
+
+#include <vector>
+#include <iosfwd>
+
+/**
+ * @brief The WarmupDetector class detects the end of the initial transient of
+ * a sequence of observations, using the MSER-5 rule.
+ *
+ * The observations are grouped in batches of \a BatchSize observations. The
+ * truncation point is the number of batches d that minimizes the MSER statistic
+ *
+ * MSER(d) = sum_{j > d} (Z_j - mean_d(Z))^2 / (m - d)^2,
+ *
+ * where Z_j are the m batch means. The detection is only accepted if the
+ * minimum is in the first half of the sequence, otherwise it is retried after
+ * the number of batches doubles.
+ */
+class WarmupDetector
+{
+public:
+    /**
+     * @brief WarmupDetector is the standard constructor for a WarmupDetector.
+     * @param BatchSize is the number of observations per batch.
+     * @param MinNumBatches is the number of batches of the first detection
+     * attempt.
+     */
+    WarmupDetector(unsigned BatchSize = 5, unsigned MinNumBatches = 100);
+
+    /**
+     * @brief add adds a new observation.
+     * @return true iff the steady state was detected with this observation.
+     */
+    bool add(double x);
+    /**
+     * @brief force ends the detection, truncating at the current observation.
+     */
+    void force();
+    /**
+     * @brief reset discards every observation.
+     */
+    void reset();
+
+    /**
+     * @brief hasDetected is true iff the steady state has been detected.
+     */
+    bool hasDetected() const;
+    /**
+     * @brief get_TruncationPoint returns the number of observations that belong
+     * to the initial transient.
+     * @return the number of observations that belong to the initial transient.
+     */
+    unsigned long get_TruncationPoint() const;
+    /**
+     * @brief get_NumObservations returns the number of observations.
+     * @return the number of observations.
+     */
+    unsigned long get_NumObservations() const;
+
+    /**
+     * @brief save_State writes the state of this estimator into a binary stream.
+     */
+    void save_State(std::ostream &Stream) const;
+    /**
+     * @brief load_State restores the state written by save_State().
+     */
+    void load_State(std::istream &Stream);
+
+private:
+    unsigned BatchSize;
+    unsigned MinNumBatches;
+
+    bool detected;
+    unsigned long NumObservations;
+    unsigned long TruncationPoint;
+    unsigned long NextCheck;
+
+    unsigned CurrentBatchCount;
+    double CurrentBatchSum;
+    std::vector<double> Batches;
+
+    bool evaluate();
+};
+
+#endif // WARMUPDETECTOR_H
@@ -3,6 +3,7 @@
 
 #include <boost/bimap.hpp>
 #include <iostream>
+#include <GeneralClasses/RandomGenerator.h>
 
 extern bool considerAseNoise;
 extern bool considerFilterImperfection;
@@ -62,6 +63,11 @@ public:
      * @brief T is a pointer to the Topology.
      */
     std::shared_ptr<Topology> T;
+    /**
+     * @brief Stream is the random stream used to break ties between candidate
+     * nodes.
+     */
+    RandomGenerator Stream;
     /**
      * @brief placeRegenerators places the regenerators over the network.
      */
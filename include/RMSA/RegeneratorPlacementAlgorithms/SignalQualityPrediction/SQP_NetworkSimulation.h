@@ -19,11 +19,9 @@ public:
                           long unsigned NumMaxCalls,
                           SignalQualityPrediction *SQP);
 
-    void run();
-
 private:
     SignalQualityPrediction *SQP;
-    void implement_call(std::shared_ptr<Event> evt);
+    void implement_call(const Event &evt);
 
     std::vector<long int> NodeUsage;
 };
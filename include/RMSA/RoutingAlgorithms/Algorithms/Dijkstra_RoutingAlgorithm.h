@@ -3,10 +3,22 @@
 
 #include "../RoutingAlgorithm.h"
 
+class RoutingGraph;
+
 namespace RMSA
 {
 namespace ROUT
 {
+class DynamicShortestPaths;
+
+/**
+ * @brief The Dijkstra_RoutingAlgorithm class searches for the shortest route of
+ * a call, with a ShortestPathSearch.
+ *
+ * If useDynamicTrees is set, the routes over the topology are read instead from
+ * shortest path trees kept by a DynamicShortestPaths, and repaired as the links
+ * notified by notify_LinkChanged() change cost.
+ */
 class Dijkstra_RoutingAlgorithm : public RoutingAlgorithm
 {
 public:
@@ -14,10 +26,34 @@ public:
                               RoutingCost::RoutingCosts RoutCost,
                               bool runLoad);
     std::vector<std::vector<std::weak_ptr<Link>>> route(std::shared_ptr<Call> C);
+    /**
+     * @brief route searches for a route over \a G, which may read a state other
+     * than the one of the topology, such as a NetworkFork.
+     */
+    std::vector<std::vector<std::weak_ptr<Link>>> route(std::shared_ptr<Call> C,
+            const RoutingGraph &G);
+
+    /**
+     * @brief useBidirectionalSearch is true iff the route is searched from both
+     * of its ends. It usually settles fewer nodes, but among several shortest
+     * routes it may find another one.
+     */
+    static bool useBidirectionalSearch;
+    /**
+     * @brief useDynamicTrees is true iff the routes over the topology are read
+     * from shortest path trees repaired as the link costs change. Every change of
+     * the links must then be notified.
+     */
+    static bool useDynamicTrees;
+
+    void notify_LinkChanged(unsigned int LinkIndex);
 
     void load() {}
     void save(std::string name);
     void print();
+
+private:
+    std::shared_ptr<DynamicShortestPaths> Trees;
 };
 }
 }
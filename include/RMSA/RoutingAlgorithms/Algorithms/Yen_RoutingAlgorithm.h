@@ -2,32 +2,95 @@
 #define YEN_ROUTINGALGORITHM_H
 
 #include "../RoutingAlgorithm.h"
-#include "include/RMSA/RoutingAlgorithms/Algorithms/Dijkstra_RoutingAlgorithm.h"
+#include "include/RMSA/RoutingAlgorithms/RouteTable.h"
+
+class RoutingGraph;
 
 namespace RMSA
 {
 namespace ROUT
 {
+/**
+ * @brief The Yen_RoutingAlgorithm class searches for the k shortest routes of a
+ * call, with Yen's algorithm.
+ *
+ * If the routing cost is static and useRouteTable is set, the routes of every
+ * pair of nodes are computed once, in a RouteTable, and then only looked up.
+ * A call whose routes in the table traverse an inactive node or link is routed
+ * as usual.
+ *
+ * The search never changes the topology: the nodes and links excluded from each
+ * spur path are masked in arrays owned by the query, and the link costs are
+ * evaluated once per query. Thus several threads can route over the same
+ * topology, as long as its RoutingGraph has been built, and algorithms with
+ * different k can coexist. The spur paths of each iteration are searched in
+ * parallel when the graph is large enough.
+ */
 class Yen_RoutingAlgorithm : public RoutingAlgorithm
 {
 public:
+    /**
+     * @brief Yen_RoutingAlgorithm is the standard constructor.
+     * @param k is the number of shortest paths searched by this algorithm. The
+     * call to load() replaces it by the number read from the user.
+     */
     Yen_RoutingAlgorithm(std::shared_ptr<Topology> T,
                          RoutingCost::RoutingCosts Cost,
-                         bool runLoad);
+                         bool runLoad, unsigned int k = kShortestPaths);
     std::vector<std::vector<std::weak_ptr<Link>>> route(std::shared_ptr<Call> C);
+    /**
+     * @brief search runs Yen's algorithm, without looking up the route table.
+     */
+    std::vector<std::vector<std::weak_ptr<Link>>> search(std::shared_ptr<Call> C);
 
     void load();
     void save(std::string);
     void print();
     /**
-     * @brief kShortestPaths is the number of shortest paths that will be searched
-     * by the KSP Algorithms, like Yen on Eppstein,  if one of them is choosed.
+     * @brief k is the number of shortest paths searched by this algorithm.
+     */
+    unsigned int k;
+    /**
+     * @brief kShortestPaths is the number of shortest paths defined in load(),
+     * given to k by the new algorithms.
      */
     static unsigned int kShortestPaths;
+    /**
+     * @brief hasLoaded is true iff kShortestPaths has already been read, so
+     * that load() asks for it only once.
+     */
     static bool hasLoaded;
+    /**
+     * @brief useRouteTable is true iff the routes are looked up in a RouteTable
+     * when the routing cost is static.
+     */
+    static bool useRouteTable;
+
+    /**
+     * @brief MinParallelWork is the minimum number of links times spur nodes
+     * for the spur paths to be searched in parallel.
+     */
+    static constexpr unsigned int MinParallelWork = 4096;
 
 private:
-    std::shared_ptr<RoutingAlgorithm> Dijkstra;
+    std::shared_ptr<const RouteTable> Table;
+
+    /**
+     * @brief find_ShortestPath finds the shortest path between two nodes of \a
+     * G, with link costs \a Costs, that avoids the masked nodes and links.
+     * @return the link indices of the path, empty if there is none.
+     */
+    static std::vector<unsigned int> find_ShortestPath(const RoutingGraph &G,
+            const std::vector<double> &Costs, const std::vector<bool> &MaskedNodes,
+            const std::vector<bool> &MaskedLinks, unsigned int Origin,
+            unsigned int Destination);
+
+    /**
+     * @brief route_FromTable looks up the routes of \a C in the route table.
+     * @return false iff a route traverses an inactive node or link.
+     */
+    bool route_FromTable(const std::shared_ptr<Call> &C,
+                         std::vector<std::vector<std::weak_ptr<Link>>> &Routes);
 };
 }
 }
@@ -18,6 +18,12 @@ public:
     LengthOccupationRoutingAvailability(std::shared_ptr<Topology> T);
 
     double get_Cost(std::weak_ptr<Link> link, std::shared_ptr<Call> C);
+    double get_Cost(const RoutingGraph &G, unsigned int LinkIndex,
+                    const std::shared_ptr<Call> &C);
+    CallClass get_CallClass(const std::shared_ptr<Call> &) const
+    {
+        return CallClass(-1, -1, 0, 0);
+    }
     std::vector<std::vector<std::weak_ptr<Link>>> route(std::shared_ptr<Call> C);
     void load()
     {
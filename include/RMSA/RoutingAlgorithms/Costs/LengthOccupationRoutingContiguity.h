@@ -18,6 +18,9 @@ public:
     LengthOccupationRoutingContiguity(std::shared_ptr<Topology> T);
 
     double get_Cost(std::weak_ptr<Link> link, std::shared_ptr<Call> C);
+    double get_Cost(const RoutingGraph &G, unsigned int LinkIndex,
+                    const std::shared_ptr<Call> &C);
+    CallClass get_CallClass(const std::shared_ptr<Call> &C) const;
 
     void load()
     {
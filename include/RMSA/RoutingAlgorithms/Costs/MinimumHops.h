@@ -17,6 +17,16 @@ public:
     MinimumHops(std::shared_ptr<Topology> T);
 
     double get_Cost(std::weak_ptr<Link> link, std::shared_ptr<Call>);
+    double get_Cost(const RoutingGraph &G, unsigned int LinkIndex,
+                    const std::shared_ptr<Call> &C);
+    CallClass get_CallClass(const std::shared_ptr<Call> &) const
+    {
+        return CallClass(-1, -1, 0, 0);
+    }
+    bool isStatic() const
+    {
+        return true;
+    }
     void load()
     {
         RoutingCost::load();
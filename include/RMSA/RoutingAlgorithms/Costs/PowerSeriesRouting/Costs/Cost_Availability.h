@@ -2,6 +2,7 @@
 #define COST_AVAILABILITY
 
 #include "Cost.h"
+#include <vector>
 
 namespace RMSA
 {
@@ -32,7 +33,10 @@ private:
 
     arma::mat cache;
 
-    std::map<unsigned int, double> unitCache;
+    /**
+     * @brief unitCache has the unit cost of each number of slots.
+     */
+    std::vector<double> unitCache;
 };
 
 }
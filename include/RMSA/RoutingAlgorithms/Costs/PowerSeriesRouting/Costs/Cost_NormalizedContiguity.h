@@ -2,6 +2,7 @@
 #define COST_NORMALIZEDCONTIGUITY_H
 
 #include "Cost.h"
+#include <vector>
 #include "GeneralClasses/TransmissionBitrate.h"
 #include "GeneralClasses/ModulationScheme.h"
 #include <map>
@@ -35,7 +36,10 @@ public:
 private:
     void createCache();
     arma::mat cache;
-    std::map<unsigned int, double> unitCache;
+    /**
+     * @brief unitCache has the unit cost of each number of slots.
+     */
+    std::vector<double> unitCache;
 };
 
 }
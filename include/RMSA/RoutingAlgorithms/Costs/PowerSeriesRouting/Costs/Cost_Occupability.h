@@ -2,6 +2,7 @@
 #define COST_OCCUPABILITY_H
 
 #include "Cost.h"
+#include <vector>
 
 namespace RMSA
 {
@@ -29,7 +30,10 @@ public:
 private:
     void createCache();
     arma::mat cache;
-    std::map<unsigned int, double> unitCache;
+    /**
+     * @brief unitCache has the unit cost of each number of slots.
+     */
+    std::vector<double> unitCache;
 };
 
 }
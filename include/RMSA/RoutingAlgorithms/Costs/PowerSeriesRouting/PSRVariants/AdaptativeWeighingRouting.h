@@ -13,6 +13,10 @@ namespace PSR
  * @brief The AdaptativeWeighingRouting class represents the Adaptative
  * Weighing Routing algorithm. It is a type of PSR algorithm. Its cost is a power
  * series with only exponent 1.
+ *
+ * The coefficients are the angles of the vector of weights of the costs in
+ * spherical coordinates. The weights are calculated the first time a cost is
+ * calculated after the coefficients are set.
  */
 class AdaptativeWeighingRouting : public PowerSeriesRouting
 {
@@ -21,6 +25,10 @@ public:
     AdaptativeWeighingRouting(std::shared_ptr<Topology> T,
                               std::vector<std::shared_ptr<PSR::Cost>> Costs);
     double get_Cost(std::weak_ptr<Link> link, std::shared_ptr<Call> C);
+
+private:
+    std::vector<double> Weights;
+    void calculate_Weights();
 };
 }
 }
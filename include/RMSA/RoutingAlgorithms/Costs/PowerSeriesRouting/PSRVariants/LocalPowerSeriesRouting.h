@@ -2,6 +2,7 @@
 #define LOCALPOWERSERIESROUTING_H
 
 #include "../PowerSeriesRouting.h"
+#include "../PowerSeries.h"
 #include <vector>
 #include <map>
 
@@ -26,8 +27,12 @@ public:
     double get_Cost(std::weak_ptr<Link> link, std::shared_ptr<Call> C);
 
 private:
-    void calculateCoefficients(std::pair<int, int>);
-    std::map<std::pair<int, int>, arma::mat> coef_matrices;
+    /**
+     * @brief calculateSeries compiles the power series of a source destination
+     * pair, from its coefficients.
+     */
+    PowerSeries calculateSeries(std::pair<int, int>);
+    std::map<std::pair<int, int>, PowerSeries> Series;
     std::vector<std::pair<int, int>> origDestPairs;
 };
 }
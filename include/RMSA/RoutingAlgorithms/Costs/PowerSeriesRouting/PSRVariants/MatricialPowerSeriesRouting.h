@@ -2,6 +2,7 @@
 #define MATRICIALPOWERSERIESROUTING_H
 
 #include "../PowerSeriesRouting.h"
+#include "../PowerSeries.h"
 
 namespace RMSA
 {
@@ -12,6 +13,9 @@ namespace PSR
 /**
  * @brief The MatricialPowerSeriesRouting class is the standard Power Series Routing
  * algorithm. Its cost is a truncated power series of carefully chosen costs.
+ *
+ * The coefficients are compiled into a PowerSeries the first time a cost is
+ * calculated after they are set.
  */
 class MatricialPowerSeriesRouting : public PowerSeriesRouting
 {
@@ -21,7 +25,8 @@ public:
                                 std::vector<std::shared_ptr<PSR::Cost>> Costs);
     double get_Cost(std::weak_ptr<Link> link, std::shared_ptr<Call> C);
 
-    std::map<std::vector<double>, double> cache;
+private:
+    PowerSeries Series;
 };
 }
 }
@@ -2,6 +2,7 @@
 #define TENSORIALPOWERSERIESROUTING_H
 
 #include "../PowerSeriesRouting.h"
+#include "../PowerSeries.h"
 
 namespace RMSA
 {
@@ -14,6 +15,9 @@ namespace PSR
  * algorithm. Differently from MatricialPowerSeriesRouting, this PSR uses the
  * Krönecker product to produce, from a reduced set of coefficients, the large set
  * required to calculate the power series.
+ *
+ * Since the coefficients of the series are a Kronecker product, the series is
+ * the product of a PowerSeries of each cost, which is how it is calculated.
  */
 class TensorialPowerSeriesRouting : public PowerSeriesRouting
 {
@@ -25,8 +29,11 @@ public:
     double get_Cost(std::weak_ptr<Link> link, std::shared_ptr<Call> C);
 
 private:
-    arma::mat coefs_matrix;
-    void calculate_CoefsMatrix();
+    /**
+     * @brief Factors has the power series of each cost.
+     */
+    std::vector<PowerSeries> Factors;
+    void calculate_Factors();
 };
 }
 }
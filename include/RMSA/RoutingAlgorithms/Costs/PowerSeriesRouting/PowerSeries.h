@@ -0,0 +1,64 @@
+#ifndef POWERSERIES_H
+#define POWERSERIES_H
+
+#include <vector>
+
+namespace RMSA
+{
+namespace ROUT
+{
+namespace PSR
+{
+/**
+ * @brief The PowerSeries class is a truncated power series of several
+ * variables, compiled from the coefficients of a PSR so that it is evaluated
+ * directly on the unit costs of a link.
+ *
+ * The series is the sum, over each combination of exponents from NMin to NMax
+ * of its variables, of a coefficient times the product of the variables raised
+ * to those exponents. The coefficients are in the order of the Kronecker
+ * product of the vectors with the powers of each variable, the exponent of the
+ * last variable varying the fastest. The series is evaluated by nested Horner
+ * schemes, over a scratch buffer of each thread, so it may be evaluated by
+ * several threads at once.
+ */
+class PowerSeries
+{
+public:
+    /**
+     * @brief PowerSeries is the constructor of an empty series, whose value is 0.
+     */
+    PowerSeries();
+    /**
+     * @brief PowerSeries is the standard constructor.
+     * @param Coefficients points to the (NMax - NMin + 1)^NumVariables
+     * coefficients, in the order of the Kronecker product.
+     * @param NumVariables is the number of variables.
+     * @param NMin is the minimum exponent.
+     * @param NMax is the maximum exponent.
+     */
+    PowerSeries(const double *Coefficients, unsigned int NumVariables, int NMin,
+                int NMax);
+
+    /**
+     * @brief evaluate returns the value of the series.
+     * @param Variables points to the values of the variables.
+     */
+    double evaluate(const double *Variables) const;
+
+    /**
+     * @brief get_NumTerms returns the number of coefficients of a series.
+     */
+    static unsigned int get_NumTerms(unsigned int NumVariables, int NMin, int NMax);
+
+private:
+    std::vector<double> Coefficients;
+    unsigned int NumVariables;
+    int NMin;
+    unsigned int N;
+};
+}
+}
+}
+
+#endif // POWERSERIES_H
@@ -71,6 +71,17 @@ protected:
     arma::mat coefficients;
     int NMin, NMax;
 
+    /**
+     * @brief get_UnitCosts returns the unit costs of the link, in the order of
+     * Costs. The vector is reused by the next call from the same thread.
+     */
+    const std::vector<double> &get_UnitCosts(std::weak_ptr<Link> link,
+            std::shared_ptr<Call> C);
+
+    /**
+     * @brief firstTimeRun is false until a variant prepares its evaluation of the
+     * cost, and is reset whenever the coefficients change.
+     */
     bool firstTimeRun;
     static bool hasLoaded;
 
@@ -0,0 +1,172 @@
+#ifndef DYNAMICSHORTESTPATHS_H
+#define DYNAMICSHORTESTPATHS_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "RoutingCost.h"
+
+class Call;
+class RoutingGraph;
+class Topology;
+
+namespace RMSA
+{
+namespace ROUT
+{
+/**
+ * @brief The DynamicShortestPaths class keeps the shortest path trees of a
+ * topology under a routing cost, and repairs them as the link costs change,
+ * instead of searching every route from scratch.
+ *
+ * There is one tree per origin node and RoutingCost::CallClass, built by a
+ * ShortestPathSearch the first time a call of the class is routed from the
+ * origin. The links whose cost may have changed are notified with
+ * notify_LinkChanged() and appended to a log. Before a tree is read, the links
+ * logged since it was last read are evaluated again, and the tree is repaired
+ * in a single batch, in the style of Ramalingam and Reps: the distances of the
+ * subtree hanging from each tree link whose cost changed are shifted by the
+ * change, which keeps them the lengths of actual paths, or the subtree is
+ * detached if the link is blocked. Then only the nodes that find a shorter path
+ * through the shifted nodes, or through the links whose cost decreased, are
+ * settled again by Dijkstra's algorithm. The nodes are only settled until the destination of the call is, the
+ * others remaining pending in the tree until a farther destination is asked.
+ *
+ * The costs must not be negative. Among several shortest routes, a repaired
+ * tree may keep another one than a search from scratch. An object must only be
+ * used by one thread at a time.
+ */
+class DynamicShortestPaths
+{
+public:
+    /**
+     * @brief DynamicShortestPaths is the standard constructor for a
+     * DynamicShortestPaths without trees.
+     * @param T is the topology.
+     * @param RCost is the routing cost.
+     */
+    DynamicShortestPaths(std::shared_ptr<Topology> T,
+                         std::shared_ptr<RoutingCost> RCost);
+
+    /**
+     * @brief find_Path finds the shortest path of the call \a C.
+     * @param Path receives the link indices of the path, empty if there is none.
+     * @return true iff there is a path.
+     */
+    bool find_Path(const std::shared_ptr<Call> &C, std::vector<unsigned int> &Path);
+
+    /**
+     * @brief notify_LinkChanged must be called when the cost of the link with
+     * index LinkIndex may have changed, as when its slots are used or freed, or
+     * when it or its destination node fails or is repaired.
+     */
+    void notify_LinkChanged(unsigned int LinkIndex);
+
+    /**
+     * @brief get_NumTrees returns the number of trees kept.
+     */
+    unsigned int get_NumTrees() const
+    {
+        return Trees.size();
+    }
+    /**
+     * @brief get_NumRepairedNodes returns the number of nodes settled again by
+     * the repairs of the trees, since they were built.
+     */
+    unsigned long get_NumRepairedNodes() const
+    {
+        return NumRepairedNodes;
+    }
+
+private:
+    /**
+     * @brief The Tree struct is a shortest path tree, with the link costs it was
+     * computed with.
+     */
+    struct Tree
+    {
+        /**
+         * @brief Representative is a call of the class of the tree.
+         */
+        std::shared_ptr<Call> Representative;
+        std::vector<double> Distance;
+        /**
+         * @brief Precedent has the index of the link to each node, or -1.
+         */
+        std::vector<int> Precedent;
+        std::vector<double> LinkCost;
+        /**
+         * @brief Pending is a binary heap with the nodes whose distance changed but
+         * that were not settled again, with their distances.
+         */
+        std::vector<std::pair<double, unsigned int>> Pending;
+        /**
+         * @brief isPending tells the nodes with an entry in Pending that was not
+         * settled yet, which may be outdated.
+         */
+        std::vector<bool> isPending;
+        /**
+         * @brief LogPosition is the position in the log of the first link not yet
+         * evaluated by this tree, counted from the creation of the log.
+         */
+        uint64_t LogPosition;
+    };
+
+    std::shared_ptr<Topology> T;
+    std::shared_ptr<RoutingCost> RCost;
+    const RoutingGraph *G;
+    unsigned int NumNodes;
+    unsigned int NumLinks;
+
+    std::map<std::pair<unsigned int, RoutingCost::CallClass>, Tree> Trees;
+
+    /**
+     * @brief Log has the links notified since LogStart. Only the last entry of
+     * each link is kept, the former ones being replaced by NoLink, so that a tree
+     * evaluates each link once.
+     */
+    std::vector<unsigned int> Log;
+    /**
+     * @brief LastEntry has the position plus one of the last entry of each link in
+     * the log, counted from the creation of the log, or zero.
+     */
+    std::vector<uint64_t> LastEntry;
+    static constexpr unsigned int NoLink = -1;
+    /**
+     * @brief LogStart is the position of the first entry of Log, counted from the
+     * creation of the log. A tree that has not read the entries discarded before
+     * it evaluates every link again.
+     */
+    uint64_t LogStart;
+
+    //Scratch arrays of the repairs
+    std::vector<uint32_t> ShiftedGeneration;
+    uint32_t CurrentGeneration;
+    unsigned long NumRepairedNodes;
+
+    void check_Graph();
+    double get_LinkCost(const Tree &Tr, unsigned int LinkIndex) const;
+    void build(Tree &Tr, unsigned int Origin);
+    void update(Tree &Tr);
+    void repair(Tree &Tr, const std::vector<std::pair<unsigned int, double>> &Changes);
+    /**
+     * @brief relax shortens the distance of the destination of the link with
+     * index Link through it, if it can, and then makes the destination pending.
+     */
+    void relax(Tree &Tr, unsigned int Link);
+    /**
+     * @brief push makes the node with index Node pending, with its distance.
+     */
+    void push(Tree &Tr, unsigned int Node);
+    /**
+     * @brief settle settles the pending nodes of the tree until the node with
+     * index Destination has its distance.
+     */
+    void settle(Tree &Tr, unsigned int Destination);
+};
+}
+}
+
+#endif // DYNAMICSHORTESTPATHS_H
@@ -0,0 +1,117 @@
+#ifndef ROUTETABLE_H
+#define ROUTETABLE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RoutingCost.h"
+
+class Topology;
+
+namespace RMSA
+{
+namespace ROUT
+{
+/**
+ * @brief The RouteTable class has the k shortest routes between every pair of
+ * nodes of a topology, under a static routing cost, as found by
+ * Yen_RoutingAlgorithm.
+ *
+ * The routes are stored as link indices, in three flat arrays: the routes
+ * between nodes o and d are the entries FirstRoute[o * NumNodes + d] to
+ * FirstRoute[o * NumNodes + d + 1] - 1 of FirstLink, and the links of route r
+ * are the entries FirstLink[r] to FirstLink[r + 1] - 1 of RouteLinks. The
+ * routes are the same over any copy of the topology.
+ *
+ * The tables are computed in parallel, one origin per thread, and shared by
+ * get_RouteTable() between all the algorithms over the same topology. If
+ * Directory is set, they are also saved in it, keyed by the hash of the
+ * topology, and read back by later runs.
+ */
+class RouteTable
+{
+public:
+    /**
+     * @brief RouteTable computes the route table of a topology.
+     * @param T is the topology. The routes are computed over a copy of it, with
+     * every node and link active.
+     * @param Cost is the routing cost. It must be static.
+     * @param k is the number of routes between each pair of nodes.
+     */
+    RouteTable(std::shared_ptr<Topology> T, RoutingCost::RoutingCosts Cost,
+               unsigned int k);
+
+    /**
+     * @brief get_RouteTable returns the route table of a topology, computing it
+     * only if no algorithm has asked for it before, and if it can not be read
+     * from Directory. It can be called from several threads.
+     */
+    static std::shared_ptr<const RouteTable> get_RouteTable(
+        std::shared_ptr<Topology> T, RoutingCost::RoutingCosts Cost, unsigned int k);
+    /**
+     * @brief Directory is the directory where the route tables are saved. If
+     * empty, they are not saved.
+     */
+    static std::string Directory;
+
+    /**
+     * @brief save writes this table into a binary file.
+     */
+    void save(std::string FileName) const;
+    /**
+     * @brief load reads a table written by save().
+     * @return the table, or nullptr if the file can not be read, was not
+     * written for the topology, cost and number of routes given, or has offsets
+     * or link indices that do not fit the topology.
+     */
+    static std::shared_ptr<RouteTable> load(std::string FileName,
+                                            std::shared_ptr<Topology> T,
+                                            RoutingCost::RoutingCosts Cost,
+                                            unsigned int k);
+
+    /**
+     * @brief get_NumRoutes returns the number of routes between the nodes with
+     * indices Origin and Destination.
+     */
+    unsigned int get_NumRoutes(unsigned int Origin, unsigned int Destination) const
+    {
+        unsigned int Pair = Origin * NumNodes + Destination;
+        return FirstRoute[Pair + 1] - FirstRoute[Pair];
+    }
+    /**
+     * @brief get_Route returns the first and one past the last link indices of
+     * the route \a r between the nodes with indices Origin and Destination.
+     */
+    std::pair<const uint32_t *, const uint32_t *> get_Route(unsigned int Origin,
+            unsigned int Destination, unsigned int r) const
+    {
+        uint32_t Route = FirstRoute[Origin * NumNodes + Destination] + r;
+        return {RouteLinks.data() + FirstLink[Route],
+                RouteLinks.data() + FirstLink[Route + 1]};
+    }
+
+    uint64_t TopologyHash;
+    RoutingCost::RoutingCosts Cost;
+    unsigned int k;
+    unsigned int NumNodes;
+
+private:
+    RouteTable();
+    /**
+     * @brief isValid returns true iff the arrays of this table can be read over
+     * a topology with these numbers of nodes and links.
+     */
+    bool isValid(uint64_t NumTopologyNodes, uint64_t NumTopologyLinks) const;
+
+    static const char Magic[8];
+    static constexpr uint32_t Version = 1;
+
+    std::vector<uint32_t> FirstRoute;
+    std::vector<uint32_t> FirstLink;
+    std::vector<uint32_t> RouteLinks;
+};
+}
+}
+
+#endif // ROUTETABLE_H
@@ -56,6 +56,13 @@ public:
 
     virtual std::vector<std::vector<std::weak_ptr<Link>>>
     route(std::shared_ptr<Call> C) = 0;
+    /**
+     * @brief notify_LinkChanged is called when the cost of the link with index
+     * LinkIndex may have changed, as when its slots are used or freed, or when it
+     * or its destination node fails or is repaired. Unless overriden, it does
+     * nothing.
+     */
+    virtual void notify_LinkChanged(unsigned int) {}
 
     std::shared_ptr<Topology> T;
 
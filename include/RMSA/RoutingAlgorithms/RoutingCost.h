@@ -2,9 +2,11 @@
 #define ROUTINGCOST_H
 
 #include <memory>
+#include <tuple>
 #include <boost/bimap.hpp>
 
 class Link;
+class RoutingGraph;
 class Topology;
 class Call;
 
@@ -34,6 +36,35 @@ public:
 
     RoutingCost(std::shared_ptr<Topology> T, RoutingCosts RoutCost);
     virtual double get_Cost(std::weak_ptr<Link> link, std::shared_ptr<Call> C) = 0;
+    /**
+     * @brief get_Cost returns the cost of the link with index LinkIndex in the
+     * compiled graph G. Unless overriden, it is the cost of G.Links[LinkIndex].
+     */
+    virtual double get_Cost(const RoutingGraph &G, unsigned int LinkIndex,
+                            const std::shared_ptr<Call> &C);
+    /**
+     * @brief isStatic returns true iff the cost of an active link depends only
+     * on the topology, and not on the call nor on the occupation of the network,
+     * so that routes can be computed in advance.
+     */
+    virtual bool isStatic() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief CallClass identifies the calls to which this cost gives the same
+     * link costs. Its fields are the indices of the origin and destination nodes,
+     * and two attributes of the call, such as its bitrate and modulation scheme,
+     * and are only compared between calls of the same cost.
+     */
+    typedef std::tuple<int, int, double, unsigned int> CallClass;
+    /**
+     * @brief get_CallClass returns the class of the call \a C. Unless overriden,
+     * the calls of a class have the same origin, destination, bitrate and
+     * modulation scheme.
+     */
+    virtual CallClass get_CallClass(const std::shared_ptr<Call> &C) const;
 
     virtual void load() = 0;
     virtual void save(std::string) = 0;
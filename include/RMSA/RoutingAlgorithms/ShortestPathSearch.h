@@ -0,0 +1,146 @@
+#ifndef SHORTESTPATHSEARCH_H
+#define SHORTESTPATHSEARCH_H
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+class RoutingGraph;
+
+namespace RMSA
+{
+namespace ROUT
+{
+/**
+ * @brief The ShortestPathSearch class runs Dijkstra's algorithm over a
+ * RoutingGraph. It is the engine of Dijkstra_RoutingAlgorithm and of
+ * Yen_RoutingAlgorithm.
+ *
+ * The vertices to be settled are kept in an indexed 4-ary heap, keyed by their
+ * distances, so that a vertex is decreased in place instead of being erased
+ * and reinserted. The arrays of the search are kept between searches, one set
+ * per thread, and are invalidated by increasing a generation counter instead of
+ * being cleared, so a search only touches the vertices it reaches. A search
+ * between two nodes stops as soon as the destination is settled, or, if
+ * bidirectional, as soon as the forward and backward searches can no longer
+ * find a shorter path.
+ *
+ * The costs of the links are given by a function, called at most once per link
+ * and search. A link whose cost is the maximum double, as the inactive links,
+ * is not traversed, nor is an inactive node. The costs must not be negative.
+ */
+class ShortestPathSearch
+{
+public:
+    /**
+     * @brief LinkCostFunction returns the cost of the link with the index given.
+     */
+    typedef std::function<double(unsigned int)> LinkCostFunction;
+
+    /**
+     * @brief get_ThreadSearch returns the search of the calling thread. It must
+     * not be used by the cost function of a search in progress.
+     */
+    static ShortestPathSearch &get_ThreadSearch();
+
+    /**
+     * @brief find_Path finds the shortest path between the nodes with indices
+     * Origin and Destination.
+     * @param Path receives the link indices of the path. It is empty if there is
+     * no path, or if Origin is Destination.
+     * @param isBidirectional is true iff the search advances from both ends.
+     * @return true iff there is a path.
+     */
+    bool find_Path(const RoutingGraph &G, const LinkCostFunction &Cost,
+                   unsigned int Origin, unsigned int Destination,
+                   std::vector<unsigned int> &Path, bool isBidirectional = false);
+    /**
+     * @brief find_Tree finds the shortest paths from the node with index Origin
+     * to every node, read with get_Distance() and get_Precedent() until the next
+     * search of this thread.
+     */
+    void find_Tree(const RoutingGraph &G, const LinkCostFunction &Cost,
+                   unsigned int Origin);
+
+    /**
+     * @brief get_Distance returns the distance from the origin of the last tree
+     * to the node with index Node, or the maximum double if it is unreachable.
+     */
+    double get_Distance(unsigned int Node) const;
+    /**
+     * @brief get_Precedent returns the index of the last link of the shortest
+     * path from the origin of the last tree to the node with index Node, or -1
+     * if there is none.
+     */
+    int get_Precedent(unsigned int Node) const;
+
+private:
+    ShortestPathSearch();
+
+    static constexpr unsigned int Arity = 4;
+    static constexpr uint32_t Settled = std::numeric_limits<uint32_t>::max();
+
+    struct HeapEntry
+    {
+        double Key;
+        unsigned int Node;
+    };
+
+    /**
+     * @brief The Direction struct has the arrays of the forward or the backward
+     * search. An entry of the node arrays is only valid if the Generation of the
+     * node is the current one.
+     */
+    struct Direction
+    {
+        std::vector<uint32_t> Generation;
+        std::vector<double> Distance;
+        std::vector<int> Precedent;
+        /**
+         * @brief Position has the position of each node in Heap, or Settled.
+         */
+        std::vector<uint32_t> Position;
+        std::vector<HeapEntry> Heap;
+    };
+
+    Direction Forward;
+    Direction Backward;
+    std::vector<uint32_t> LinkGeneration;
+    std::vector<double> LinkCost;
+    uint32_t CurrentGeneration;
+
+    const RoutingGraph *G;
+    const LinkCostFunction *Cost;
+
+    void start(const RoutingGraph &G, const LinkCostFunction &Cost);
+    double get_LinkCost(unsigned int Link);
+
+    bool isReached(const Direction &D, unsigned int Node) const
+    {
+        return D.Generation[Node] == CurrentGeneration;
+    }
+    bool isSettled(const Direction &D, unsigned int Node) const
+    {
+        return isReached(D, Node) && D.Position[Node] == Settled;
+    }
+
+    /**
+     * @brief relax sets the distance of Node to Distance, through Link, if it is
+     * shorter than the current one.
+     */
+    void relax(Direction &D, unsigned int Node, double Distance, int Link);
+    /**
+     * @brief settle removes the closest node from the heap and returns it.
+     */
+    unsigned int settle(Direction &D);
+    void sift_Up(Direction &D, uint32_t Position);
+    void sift_Down(Direction &D, uint32_t Position);
+
+    void search_Forward(unsigned int Origin, unsigned int Destination);
+    unsigned int search_Bidirectional(unsigned int Origin, unsigned int Destination);
+};
+}
+}
+
+#endif // SHORTESTPATHSEARCH_H
@@ -29,7 +29,7 @@ private:
     bool hasSetSlots;
     static std::map<int, std::vector<int>> defaultSlotsList;
 
-    static bool initDefaultList(std::string);
+    static bool initDefaultList(std::string, int NumSlots);
 
     std::map<int, std::vector<int>> slotsList;
 };
@@ -4,6 +4,7 @@
 #include <map>
 #include <boost/bimap.hpp>
 #include <RMSA/TransparentSegment.h>
+#include <GeneralClasses/RandomGenerator.h>
 
 class Call;
 class Slot;
@@ -88,6 +89,11 @@ public:
     unsigned get_numPossibleRequiredSlots() const;
 
     std::shared_ptr<Topology> T;
+    /**
+     * @brief Stream is the random stream used by the randomized spectrum
+     * assignment algorithms.
+     */
+    RandomGenerator Stream;
 
     static std::set<unsigned> possibleRequiredSlots;
 };
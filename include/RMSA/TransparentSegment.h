@@ -6,6 +6,7 @@
 #include <map>
 #include <GeneralClasses/Signal.h>
 #include <GeneralClasses/ModulationScheme.h>
+#include <Structure/SlotBitset.h>
 
 class Link;
 class Node;
@@ -69,6 +70,12 @@ public:
      * @return the Signal after it has traversed the network.
      */
     Signal bypass(Signal S);
+    /**
+     * @brief get_FreeSlots returns the slots that are free on every link of the
+     * TransparentSegment.
+     * @return the slots that are free on every link of the TransparentSegment.
+     */
+    SlotBitset get_FreeSlots() const;
     /**
      * @brief get_MaxContigSlots returns the maximum number of adjacent free slots
      * in the TransparentSegment.
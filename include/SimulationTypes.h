@@ -4,6 +4,7 @@
 #include <SimulationTypes/Simulation_TransparencyAnalysis.h>
 #include <SimulationTypes/Simulation_StatisticalTrend.h>
 #include <SimulationTypes/Simulation_NetworkLoad.h>
+#include <SimulationTypes/Simulation_PairedComparison.h>
 #include <SimulationTypes/Simulation_NSGA2_RegnPlac.h>
 #include <SimulationTypes/Simulation_PSROptimization.h>
 #include <SimulationTypes/Simulation_RegeneratorNumber.h>
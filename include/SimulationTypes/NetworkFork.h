@@ -0,0 +1,166 @@
+#ifndef NETWORKFORK_H
+#define NETWORKFORK_H
+
+#include <memory>
+#include <vector>
+#include <utility>
+
+class Topology;
+class NetworkState;
+class RoutingGraph;
+
+namespace RMSA
+{
+class Route;
+}
+
+namespace Simulations
+{
+
+/**
+ * @brief The NetworkFork class is a copy of the state of a network, on which a
+ * candidate RMSA decision can be applied and simulated ahead, and then
+ * discarded, without changing the network.
+ *
+ * A fork has a copy-on-write fork of the NetworkState of the topology: the
+ * slots and regenerators it uses or frees only copy the pages of the state they
+ * change. It also has the pending departures: the connections that will free
+ * their resources as the fork advances in time, added with add_Departure() or
+ * implement().
+ *
+ * The root fork of a simulation is built by NetworkSimulation::fork(), with the
+ * active connections as its pending departures. The forks of the candidate
+ * decisions are then built with fork(), which takes time proportional to the
+ * number of pages of the state, and not to the number of connections. The
+ * forks of a root can be changed and advanced concurrently, each by a single
+ * thread, while the topology remains unchanged.
+ */
+class NetworkFork
+{
+public:
+    /**
+     * @brief The Connection struct has the resources used by a connection:
+     * the slots, as pairs of link index and slot, and the regenerators, as pairs
+     * of node index and number of regenerators.
+     */
+    struct Connection
+    {
+        std::vector<std::pair<unsigned int, unsigned int>> Slots;
+        std::vector<std::pair<unsigned int, unsigned int>> Regenerators;
+    };
+
+    /**
+     * @brief NetworkFork is the standard constructor for a NetworkFork.
+     * @param T is the topology whose current state is forked.
+     * @param Time is the simulated instant of the fork.
+     */
+    NetworkFork(std::shared_ptr<Topology> T, double Time);
+
+    /**
+     * @brief fork returns a fork of this fork, with the same state and pending
+     * departures. Changing either does not change the other.
+     */
+    std::shared_ptr<NetworkFork> fork();
+
+    /**
+     * @brief add_Departure adds a pending departure of a connection whose
+     * resources are already used in the state of this fork.
+     * @param R is the route of the connection.
+     * @param EndingTime is the instant the connection frees its resources.
+     */
+    void add_Departure(const RMSA::Route &R, double EndingTime);
+    /**
+     * @brief implement uses the resources of a route in this fork, and adds its
+     * departure.
+     * @param R is the route to be implemented.
+     * @param EndingTime is the instant the connection frees its resources.
+     */
+    void implement(const RMSA::Route &R, double EndingTime);
+    /**
+     * @brief implement uses the resources of a connection in this fork, and adds
+     * its departure.
+     * @param C has the resources of the connection. They must be free.
+     * @param EndingTime is the instant the connection frees its resources.
+     */
+    void implement(Connection C, double EndingTime);
+    /**
+     * @brief advance frees the resources of the connections departing up to
+     * \a Time, and moves this fork to that instant.
+     */
+    void advance(double Time);
+
+    /**
+     * @brief find_FirstFit returns the first slot of the first block of \a
+     * NumSlots consecutive slots free in all the links in \a LinkIndices, in
+     * the state of this fork, or -1 if there is none.
+     */
+    int find_FirstFit(const std::vector<unsigned int> &LinkIndices,
+                      unsigned int NumSlots) const;
+
+    /**
+     * @brief get_Time returns the simulated instant of this fork.
+     */
+    double get_Time() const
+    {
+        return Time;
+    }
+    /**
+     * @brief get_NumPendingDepartures returns the number of connections that
+     * have not departed yet.
+     */
+    unsigned int get_NumPendingDepartures() const;
+    /**
+     * @brief get_State returns the state of the network in this fork.
+     */
+    const NetworkState &get_State() const
+    {
+        return *State;
+    }
+    /**
+     * @brief get_RoutingGraph returns a routing graph that reads the state of
+     * this fork. It is built on the first call, by copying the structure of the
+     * routing graph of the topology.
+     */
+    const RoutingGraph &get_RoutingGraph();
+
+private:
+    struct Departure
+    {
+        double t;
+        std::shared_ptr<const Connection> Resources;
+
+        bool operator>(const Departure &D) const
+        {
+            return t > D.t;
+        }
+    };
+
+    std::shared_ptr<Topology> T;
+    std::shared_ptr<NetworkState> State;
+    std::shared_ptr<RoutingGraph> Graph;
+    double Time;
+
+    /**
+     * @brief SharedDepartures are the pending departures shared with the other
+     * forks, in increasing order of time. The ones before NextSharedDeparture
+     * have already departed in this fork.
+     */
+    std::shared_ptr<const std::vector<Departure>> SharedDepartures;
+    unsigned int NextSharedDeparture;
+    /**
+     * @brief OwnDepartures are the pending departures added to this fork since
+     * it was last forked, in a min-heap.
+     */
+    std::vector<Departure> OwnDepartures;
+
+    void release(const Connection &C);
+    /**
+     * @brief share_Departures merges OwnDepartures into SharedDepartures, so that
+     * the forks of this fork share all its pending departures.
+     */
+    void share_Departures();
+};
+
+}
+
+#endif // NETWORKFORK_H
@@ -3,8 +3,17 @@
 
 #include <memory>
 #include <fstream>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <limits>
+#include <Calls/ConnectionIndex.h>
+#include <GeneralClasses/BatchMeans.h>
+#include <GeneralClasses/WarmupDetector.h>
 
+class Call;
 class CallGenerator;
+class MetricsStream;
 class Event;
 
 namespace RMSA
@@ -14,11 +23,37 @@ class RoutingWavelengthAssignment;
 
 namespace Simulations
 {
+class NetworkFork;
 
 /**
  * @brief The NetworkSimulation class is the a basic block. This class runs a
  * network simulation, coordinating the CallGenerator and the RoutingWavelengthAssignment
  * objects.
+ *
+ * By default, exactly NumMaxCalls call requests are simulated. If a stopping
+ * rule is set with set_StoppingRule(), the simulation stops as soon as the
+ * confidence interval of the call blocking probability, estimated by batch
+ * means, is narrow enough. NumMaxCalls is then a hard cap.
+ *
+ * If the warm-up deletion is enabled with set_WarmupDeletion(), the statistics
+ * are reset once the MSER-5 rule, applied over the number of occupied slots seen
+ * by each call request, detects that the steady state was reached. NumMaxCalls
+ * then counts only the call requests simulated after that.
+ *
+ * If checkpointing is enabled with set_Checkpointing(), the whole state of the
+ * simulation is periodically saved to a binary file. A simulation built with
+ * the same parameters can resume from it with load_Checkpoint(), and yields the
+ * same results as an uninterrupted run.
+ *
+ * If a metrics stream is enabled with set_MetricsStream(), a time series of the
+ * interval blocking probability, link utilisation, active calls and regenerators
+ * in use is written while the simulation runs, by a background thread.
+ *
+ * Links and nodes can be failed and repaired during the simulation with
+ * schedule_LinkFailure() and schedule_NodeFailure(). When an element fails, it
+ * is deactivated, and the connections traversing it, found through the
+ * ConnectionIndex, are torn down and routed again over the remaining network.
+ * The connections that can not be restored are dropped.
  */
 class NetworkSimulation
 {
@@ -32,6 +67,7 @@ public:
     NetworkSimulation(std::shared_ptr<CallGenerator> Generator,
                       std::shared_ptr<RMSA::RoutingWavelengthAssignment> RMSA,
                       long unsigned NumMaxCalls);
+    virtual ~NetworkSimulation() {}
 
     /**
      * @brief run silently runs a network simulation.
@@ -92,6 +128,115 @@ public:
      * @return a estimation of the call request blocking probability.
      */
     double get_CallBlockingProbability();
+    /**
+     * @brief get_CallBlockingProbabilityHalfWidth returns the half-width of the
+     * confidence interval of the call request blocking probability.
+     * @return the half-width of the confidence interval, estimated by batch means
+     * with confidence level ConfidenceLevel.
+     */
+    double get_CallBlockingProbabilityHalfWidth();
+    /**
+     * @brief set_StoppingRule enables the precision-driven stopping rule.
+     * @param TargetRelativeHalfWidth is the target half-width of the confidence
+     * interval, relative to the call blocking probability. If zero, exactly
+     * NumMaxCalls call requests are simulated.
+     * @param ConfidenceLevel is the confidence level of the interval.
+     */
+    void set_StoppingRule(double TargetRelativeHalfWidth,
+                          double ConfidenceLevel = 0.95);
+    /**
+     * @brief set_RandomStreams derives the random streams used by this simulation
+     * from the master seed, so that simulations are reproducible and independent
+     * regardless of the order and of the thread in which they run.
+     * @param SweepPoint identifies the point of the parameter sweep.
+     * @param Replication identifies the replication of the point.
+     */
+    void set_RandomStreams(uint32_t SweepPoint, uint32_t Replication = 0);
+    /**
+     * @brief set_WarmupDeletion enables or disables the automatic deletion of the
+     * initial transient.
+     */
+    void set_WarmupDeletion(bool WarmupDeletion);
+    /**
+     * @brief set_BlockingHistory enables or disables the recording of the blocking
+     * indicator of each call request in BlockingHistory.
+     */
+    void set_BlockingHistory(bool RecordBlockingHistory);
+    /**
+     * @brief set_Checkpointing enables the periodic checkpoints of this simulation.
+     * @param FileName is the file where the checkpoints are written. Each
+     * checkpoint replaces the previous one.
+     * @param Interval is the number of call requests between checkpoints. If
+     * zero, the checkpoints are disabled.
+     * @param ParametersHash is a hash of the parameters of this simulation that
+     * its objects do not record, such as the algorithms and the seed. It is
+     * saved with the hash of the topology, and a checkpoint is only loaded by
+     * a simulation with the same hashes.
+     */
+    void set_Checkpointing(std::string FileName, unsigned long Interval,
+                           uint64_t ParametersHash = 0);
+    /**
+     * @brief save_Checkpoint writes the state of this simulation into a binary
+     * file: the pending events, the active calls with their resources, the
+     * counters, the random streams and the occupancy of the topology.
+     *
+     * The file is first written aside and then renamed, so a crash or a failed
+     * write while saving never destroys the previous checkpoint. Its header
+     * holds the size and the hash of the state, so that a truncated or corrupt
+     * checkpoint is detected before it is loaded.
+     */
+    void save_Checkpoint(std::string FileName);
+    /**
+     * @brief load_Checkpoint restores the state written by save_Checkpoint(). This
+     * simulation must have been created with the same topology, algorithms,
+     * load and number of calls as the one that saved it. Every link is notified
+     * to the routing algorithm, as its cost may have changed. The next call to
+     * run() resumes the simulation.
+     * @return false iff the checkpoint could not be read, is invalid, truncated
+     * or corrupt, or was saved by a simulation with other parameters, topology,
+     * load or number of calls. This simulation is then
+     * unchanged.
+     */
+    bool load_Checkpoint(std::string FileName);
+    /**
+     * @brief set_MetricsStream enables the time series of the metrics of this
+     * simulation. A sample is emitted every \a CallInterval call requests, and
+     * whenever the simulated time crosses a multiple of \a TimeInterval.
+     * @param FileName is the CSV file where the samples are written. A resumed
+     * simulation appends to it.
+     * @param CallInterval is the number of call requests between samples. If
+     * zero, the samples are not emitted by number of call requests.
+     * @param TimeInterval is the simulated time between samples. If zero, the
+     * samples are not emitted by simulated time.
+     */
+    void set_MetricsStream(std::string FileName, unsigned long CallInterval,
+                           double TimeInterval);
+    /**
+     * @brief schedule_LinkFailure schedules the failure of a link, and its
+     * repair.
+     * @param LinkIndex is the index of the link, Link::Index.
+     * @param FailureTime is the simulated instant of the failure.
+     * @param RepairTime is the simulated instant of the repair. If infinite, the
+     * link is never repaired.
+     */
+    void schedule_LinkFailure(unsigned LinkIndex, double FailureTime,
+                              double RepairTime = std::numeric_limits<double>::infinity());
+    /**
+     * @brief schedule_NodeFailure schedules the failure of a node, and its
+     * repair. The connections starting or ending on a failed node are dropped.
+     * @param NodeIndex is the index of the node, Node::Index.
+     * @param FailureTime is the simulated instant of the failure.
+     * @param RepairTime is the simulated instant of the repair. If infinite, the
+     * node is never repaired.
+     */
+    void schedule_NodeFailure(unsigned NodeIndex, double FailureTime,
+                              double RepairTime = std::numeric_limits<double>::infinity());
+    /**
+     * @brief fork returns a NetworkFork of the current state of the network,
+     * with the active connections as its pending departures. Candidate RMSA
+     * decisions can be simulated ahead over forks of it.
+     */
+    std::shared_ptr<NetworkFork> fork();
     /**
      * @brief get_Load returns the load of this simulation, in Erlangs.
      * @return the load of this simulation, in Erlangs.
@@ -102,10 +247,172 @@ public:
      * @brief hasSimulated is true iff the simulation has already run.
      */
     bool hasSimulated;
+    /**
+     * @brief hasConverged is true iff the stopping rule target has been met.
+     */
+    bool hasConverged;
+
+    /**
+     * @brief TargetRelativeHalfWidth is the target half-width of the confidence
+     * interval, relative to the call blocking probability. If zero, the stopping
+     * rule is disabled.
+     */
+    double TargetRelativeHalfWidth;
+    /**
+     * @brief ConfidenceLevel is the confidence level of the interval of the call
+     * blocking probability.
+     */
+    double ConfidenceLevel;
+    /**
+     * @brief MinNumBatches is the minimum number of complete batches before the
+     * stopping rule is evaluated.
+     */
+    static constexpr unsigned MinNumBatches = 10;
+    /**
+     * @brief BlockingIndicator collects the blocking indicator of each call
+     * request, in order of arrival.
+     */
+    BatchMeans BlockingIndicator;
+    /**
+     * @brief RecordBlockingHistory is true iff BlockingHistory is recorded.
+     */
+    bool RecordBlockingHistory;
+    /**
+     * @brief BlockingHistory is the blocking indicator of each counted call
+     * request, in order of arrival. Only recorded if RecordBlockingHistory is set.
+     */
+    std::vector<bool> BlockingHistory;
+
+    /**
+     * @brief WarmupDeletion is true iff the initial transient is automatically
+     * deleted.
+     */
+    bool WarmupDeletion;
+    /**
+     * @brief NumOccupiedSlots is the number of slots currently in use, in the
+     * whole network.
+     */
+    long unsigned NumOccupiedSlots;
+    /**
+     * @brief Warmup detects the end of the initial transient with the number of
+     * occupied slots seen by each call request.
+     */
+    WarmupDetector Warmup;
+    /**
+     * @brief NumWarmupCalls is the number of call requests that were discarded
+     * from the statistics as part of the initial transient.
+     */
+    long unsigned NumWarmupCalls;
+    /**
+     * @brief WarmupTruncationPoint is the truncation point detected by the MSER-5
+     * rule, in number of call requests.
+     */
+    long unsigned WarmupTruncationPoint;
+
+    /**
+     * @brief Connections indexes the active connections by the links and nodes
+     * they traverse. It is kept by implement_call(), drop_call() and the
+     * restoration after a failure.
+     */
+    ConnectionIndex Connections;
+    /**
+     * @brief NumDisruptedCalls is the number of active connections torn down by
+     * failures.
+     */
+    long unsigned NumDisruptedCalls;
+    /**
+     * @brief NumRestoredCalls is the number of connections torn down by failures
+     * that were routed again.
+     */
+    long unsigned NumRestoredCalls;
+
+    /**
+     * @brief CheckpointFileName is the file where the checkpoints are written.
+     */
+    std::string CheckpointFileName;
+    /**
+     * @brief CheckpointInterval is the number of call requests between
+     * checkpoints. If zero, the checkpoints are disabled.
+     */
+    long unsigned CheckpointInterval;
+    /**
+     * @brief CheckpointParametersHash is the hash of the parameters of this
+     * simulation, saved with its checkpoints.
+     */
+    uint64_t CheckpointParametersHash;
+    /**
+     * @brief isResumed is true iff the state was restored from a checkpoint, and
+     * the simulation has not run since.
+     */
+    bool isResumed;
+
+    /**
+     * @brief MetricsFileName is the file where the metrics are written. If
+     * empty, the metrics stream is disabled.
+     */
+    std::string MetricsFileName;
+    /**
+     * @brief MetricsCallInterval is the number of call requests between samples
+     * of the metrics.
+     */
+    long unsigned MetricsCallInterval;
+    /**
+     * @brief MetricsTimeInterval is the simulated time between samples of the
+     * metrics.
+     */
+    double MetricsTimeInterval;
 
 protected:
-    void implement_call(std::shared_ptr<Event> evt);
-    void drop_call(std::shared_ptr<Event> evt);
+    /**
+     * @brief implement_call tries to implement the call requested by \a evt.
+     *
+     * The call remains valid until this method returns, even if blocked.
+     */
+    virtual void implement_call(const Event &evt);
+    /**
+     * @brief drop_call frees the resources used by the call ended by \a evt.
+     */
+    virtual void drop_call(const Event &evt);
+    /**
+     * @brief fail_Element deactivates the link or node failed by \a evt, and
+     * restores the connections that traversed it.
+     */
+    virtual void fail_Element(const Event &evt);
+    /**
+     * @brief repair_Element reactivates the link or node repaired by \a evt.
+     */
+    virtual void repair_Element(const Event &evt);
+    /**
+     * @brief reset_Statistics discards the statistics collected so far.
+     */
+    void reset_Statistics();
+    /**
+     * @brief emit_Metrics pushes a sample of the metrics into the stream.
+     * @param Time is the current simulated time.
+     */
+    void emit_Metrics(double Time);
+
+private:
+    /**
+     * @brief use_Route uses the slots and regenerators of the route of \a C, and
+     * notifies the routing algorithm of the links whose slots were used.
+     */
+    void use_Route(const std::shared_ptr<Call> &C);
+    /**
+     * @brief free_Route frees the slots and regenerators of the route of \a C,
+     * and notifies the routing algorithm of the links whose slots were freed.
+     */
+    void free_Route(const std::shared_ptr<Call> &C);
+    /**
+     * @brief notify_ElementChanged notifies the routing algorithm of the links
+     * whose cost changed with the failure or repair \a evt.
+     */
+    void notify_ElementChanged(const Event &evt);
+
+    std::shared_ptr<MetricsStream> Metrics;
+    double NextMetricsTime;
+    long unsigned IntervalNumCalls;
+    long unsigned IntervalNumBlockedCalls;
 };
 }
 
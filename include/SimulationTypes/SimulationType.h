@@ -5,6 +5,7 @@
 #include <string>
 #include <boost/bimap.hpp>
 #include <Structure/Topology.h>
+#include <Structure/TopologyPool.h>
 
 //! Simulations that can run over this simulator.
 namespace Simulations
@@ -25,6 +26,7 @@ public:
     X(transparency, "Transparency Analysis", "transparency", Simulation_TransparencyAnalysis) \
     X(morp3o, "MORP-3O Regenerator Placement", "morp3o", Simulation_NSGA2_RegnPlac) \
     X(networkload, "Network Load Variation", "networkload", Simulation_NetworkLoad) \
+    X(pairedcomparison, "Paired Comparison of RMSA Configurations", "pairedcomparison", Simulation_PairedComparison) \
     X(psroptimization, "Power Series Routing PSO Optimization", "psroptimization", Simulation_PSROptimization) \
     X(regnum, "Number of Regenerators", "regnum", Simulation_RegeneratorNumber) \
     X(pratiothreshold, "Power Ratio Threshold Variation", "pratiothreshold", Simulation_PowerRatioThreshold) \
@@ -124,6 +126,11 @@ public:
      * @brief T is a pointer to a "master" Topology.
      */
     std::shared_ptr<Topology> T;
+    /**
+     * @brief Replicas hands out the copies of T simulated by the individuals or
+     * particles of an optimization, reusing the copies of the finished ones.
+     */
+    std::shared_ptr<TopologyPool> Replicas;
 };
 
 }
@@ -40,6 +40,10 @@ private:
     bool runLoadNX;
 
     double NumCalls;
+    double TargetRelativeHalfWidth, ConfidenceLevel;
+    bool WarmupDeletion;
+    double CheckpointInterval;
+    double MetricsCallInterval, MetricsTimeInterval;
     double NetworkLoadMin, NetworkLoadMax, NetworkLoadStep;
 
     std::string FileName;
@@ -79,6 +79,7 @@ private:
     struct Fitness
     {
         static std::shared_ptr<Topology> T;
+        static std::shared_ptr<TopologyPool> Replicas;
         static RMSA::ROUT::PSR::PowerSeriesRouting::Variants Variant;
         double operator()(std::shared_ptr<PSO::PSO_Particle<double>>);
     };
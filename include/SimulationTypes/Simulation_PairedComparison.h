@@ -0,0 +1,75 @@
+#ifndef SIMULATION_PAIREDCOMPARISON_H
+#define SIMULATION_PAIREDCOMPARISON_H
+
+#include <memory>
+#include <vector>
+#include <SimulationTypes/NetworkSimulation.h>
+#include <SimulationTypes/SimulationType.h>
+#include "RMSA.h"
+
+namespace Simulations
+{
+
+/**
+ * @brief The Simulation_PairedComparison class compares several RMSA
+ * configurations under the same traffic.
+ *
+ * Each configuration runs over its own copy of the topology, but every
+ * configuration is fed with the same sequence of call requests (common random
+ * numbers). The call blocking probability of each configuration is reported,
+ * together with a confidence interval of its difference to the first
+ * configuration, estimated by batch means over the paired blocking indicators.
+ * Pairing removes most of the traffic-induced variance, so differences between
+ * configurations are resolved with far fewer calls than independent runs need.
+ */
+class Simulation_PairedComparison : public SimulationType
+{
+public:
+    /**
+     * @brief Simulation_PairedComparison is the default constructor.
+     */
+    Simulation_PairedComparison();
+
+    void help();
+    void run();
+    void load();
+    void save(std::string);
+    void load_file(std::string);
+    void print();
+
+    /**
+     * @brief The Configuration struct is an RMSA configuration being compared.
+     */
+    struct Configuration
+    {
+        RMSA::ROUT::RoutingAlgorithm::RoutingAlgorithms Routing_Algorithm;
+        RMSA::ROUT::RoutingCost::RoutingCosts Routing_Cost;
+        RMSA::SA::SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithms
+        WavAssign_Algorithm;
+        RMSA::RA::RegeneratorAssignmentAlgorithm::RegeneratorAssignmentAlgorithms
+        RegAssignment_Algorithm;
+    };
+
+private:
+    std::vector<std::shared_ptr<NetworkSimulation>> simulations;
+    std::vector<Configuration> Configurations;
+    bool hasSimulated;
+    bool hasLoaded;
+    bool runLoadNX;
+
+    double NumCalls;
+    double NetworkLoad;
+    double ConfidenceLevel;
+
+    std::string FileName;
+
+    RMSA::RP::RegeneratorPlacementAlgorithm::RegeneratorPlacementAlgorithms
+    RegPlacement_Algorithm;
+
+    void create_Simulations();
+    void place_Regenerators(std::shared_ptr<Topology> T);
+    std::string get_ConfigurationName(size_t i);
+};
+
+}
+#endif // SIMULATION_PAIREDCOMPARISON_H
@@ -2,9 +2,14 @@
 #define STRUCTURE_H
 
 #include <Structure/Slot.h>
+#include <Structure/SlotBitset.h>
+#include <Structure/NetworkState.h>
 #include <Structure/Node.h>
 #include <Structure/Link.h>
 #include <Structure/Topology.h>
+#include <Structure/TopologyGenerator.h>
+#include <Structure/TopologyPool.h>
+#include <Structure/RoutingGraph.h>
 
 #endif // STRUCTURE_H
 
@@ -7,6 +7,7 @@
 #include <string>
 #include <fstream>
 #include <GeneralClasses/LinkSpectralDensity.h>
+#include <Structure/NetworkState.h>
 
 class Node;
 class Call;
@@ -24,9 +25,10 @@ class Link
 {
 public:
     /**
-     * @brief NumSlots is the number of frequency slots on this link.
+     * @brief DefaultNumSlots is the number of frequency slots on the links of a
+     * topology, unless it is set with Topology::set_NumSlots().
      */
-    static int NumSlots;
+    static int DefaultNumSlots;
     /**
      * @brief DefaultAvgSpanLength is the average distance between successive
      * in line amplifiers, in kilometers.
@@ -44,9 +46,22 @@ public:
      * @param Origin is a pointer to the origin node.
      * @param Destination is a pointer to the destination node.
      * @param Length is the length of this link, in kilometers.
+     * @param State is the state of the network that holds this link, if any.
+     * Otherwise, the link has a state of its own.
+     * @param NumSlots is the number of frequency slots on this link.
      */
     Link(std::weak_ptr<Node> Origin, std::weak_ptr<Node> Destination,
-         double Length);
+         double Length, std::shared_ptr<NetworkState> State = nullptr,
+         int NumSlots = DefaultNumSlots);
+    /**
+     * @brief Link creates a link with the same structure as another, between
+     * other nodes, with every slot free. The fibers and in line amplifiers never
+     * change, so they are shared with the other link.
+     * @param link is the Link whose structure is copied.
+     * @param State is the state of the network that holds this link.
+     */
+    Link(std::weak_ptr<Node> Origin, std::weak_ptr<Node> Destination,
+         const Link &link, std::shared_ptr<NetworkState> State);
     /**
      * @brief Link is the copy constructor of a Link object.
      * @param link is the Link being copied.
@@ -65,6 +80,25 @@ public:
      * @brief Slots is a vector containing the frequency slots of this link.
      */
     std::vector<std::shared_ptr<Slot>> Slots;
+    /**
+     * @brief get_NumSlots returns the number of frequency slots on this link.
+     */
+    int get_NumSlots() const
+    {
+        return NumSlots;
+    }
+    /**
+     * @brief get_FreeSlots returns the free slots of this link. They are kept in
+     * sync by Slot::useSlot() and Slot::freeSlot().
+     */
+    const SlotBitset &get_FreeSlots() const
+    {
+        return State->get_Link(Index).FreeSlots;
+    }
+    /**
+     * @brief Index is the index of this link in its NetworkState.
+     */
+    unsigned int Index;
     /**
      * @brief Devices is a vector containing the optical Devices of this link.
      */
@@ -123,7 +157,32 @@ public:
      * @return in how many ways it is possible to allocate the required slots by
      * Call C on this link.
      */
-    int get_Contiguity(std::shared_ptr<Call> C);
+    int get_Contiguity(const std::shared_ptr<Call> &C);
+    /**
+     * @brief get_LargestFreeBlock returns the length of the largest block of
+     * consecutive free slots of this link.
+     */
+    int get_LargestFreeBlock() const
+    {
+        return State->get_Link(Index).get_LargestFreeBlock();
+    }
+    /**
+     * @brief get_Fragmentation returns the fragmentation of the spectrum of
+     * this link. See NetworkState::LinkState::get_Fragmentation().
+     */
+    double get_Fragmentation() const
+    {
+        return State->get_Link(Index).get_Fragmentation();
+    }
+    /**
+     * @brief get_Version returns the version of the state of this link, that
+     * changes whenever a slot of the link is used or freed, or its activity
+     * changes.
+     */
+    unsigned long long get_Version() const
+    {
+        return State->get_Link(Index).Version;
+    }
 
     /**
      * @brief get_CapEx returns the CapEx of this link.
@@ -161,7 +220,7 @@ public:
      */
     bool is_LinkActive() const
     {
-        return isActive;
+        return State->get_Link(Index).isActive;
     }
     /**
      * @brief set_LinkActive sets the link as active.
@@ -174,13 +233,21 @@ public:
 
     friend std::ostream& operator<<(std::ostream &out, const Link &link);
 
+    /**
+     * @brief linkSpecDens is the spectral density of the signals in this link. It
+     * is only allocated if the filter imperfection is considered, otherwise it is
+     * nullptr.
+     */
     std::shared_ptr<LinkSpectralDensity> linkSpecDens;
 
 private:
+    friend class Slot;
+
     void create_Slots();
     void create_Devices();
 
-    bool isActive;
+    int NumSlots;
+    std::shared_ptr<NetworkState> State;
 };
 
 #endif // LINK_H
@@ -0,0 +1,240 @@
+#ifndef NETWORKSTATE_H
+#define NETWORKSTATE_H
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <Structure/SlotBitset.h>
+
+/**
+ * @brief The NetworkState class holds the mutable state of a Topology: the free
+ * slots and the activity of each link, and the regenerator usage and the
+ * activity of each node.
+ *
+ * The links and nodes keep their state here, and not in their own objects, so
+ * that the state of a whole network is a small, flat object, allocated apart
+ * from the structure. It can be read with Topology::get_State() and restored
+ * with Topology::set_State(), over the same topology or over a copy of it.
+ *
+ * The links and nodes are indexed in the order they were added to the topology.
+ *
+ * The states are stored in pages of PageSize links or nodes, shared between
+ * copies of a NetworkState: copying one, or calling fork(), only copies the
+ * pointers to the pages, and a page is copied the first time it is changed
+ * through edit_Link() or edit_Node() while it is shared. A copy thus costs a
+ * pointer per page, plus a page for each page it changes. Copies can be read
+ * and changed concurrently, by different threads, as long as no thread copies
+ * a NetworkState while another one changes it.
+ */
+class NetworkState
+{
+public:
+    /**
+     * @brief The LinkState struct is the mutable state of a Link.
+     *
+     * Besides the free slots, it keeps the spectrum metrics read by the routing
+     * costs, updated by use_Slot() and free_Slot() from the blocks of free slots
+     * they split or merge, so that reading them takes constant time.
+     */
+    struct LinkState
+    {
+        LinkState(unsigned int NumSlots);
+
+        /**
+         * @brief FreeSlots has the bit of each free slot of the link set. It is
+         * changed through use_Slot() and free_Slot().
+         */
+        SlotBitset FreeSlots;
+        /**
+         * @brief isActive is true iff new connections can pass through the link.
+         */
+        bool isActive;
+        /**
+         * @brief Version is incremented whenever a slot of the link is used or
+         * freed, or its activity changes, so that a value computed from the
+         * state of the link can tell whether it is outdated.
+         */
+        unsigned long long Version;
+
+        /**
+         * @brief use_Slot uses the free slot \a s.
+         */
+        void use_Slot(unsigned int s);
+        /**
+         * @brief free_Slot frees the used slot \a s.
+         */
+        void free_Slot(unsigned int s);
+        /**
+         * @brief set_Active sets whether new connections can pass through the
+         * link.
+         */
+        void set_Active(bool isActive);
+
+        /**
+         * @brief get_NumFreeSlots returns the number of free slots.
+         */
+        unsigned int get_NumFreeSlots() const
+        {
+            return NumPositions[0];
+        }
+        /**
+         * @brief get_NumPositions returns in how many positions a block of
+         * \a Length consecutive slots fits into the free slots, that is, the
+         * contiguity of the link for a call requiring \a Length slots.
+         */
+        unsigned int get_NumPositions(unsigned int Length) const
+        {
+            Length = std::max(Length, 1u);
+            return Length <= NumPositions.size() ? NumPositions[Length - 1] : 0;
+        }
+        /**
+         * @brief get_LargestFreeBlock returns the length of the largest block of
+         * consecutive free slots.
+         */
+        unsigned int get_LargestFreeBlock() const
+        {
+            return LargestFreeBlock;
+        }
+        /**
+         * @brief get_Fragmentation returns the entropy of the distribution of the
+         * free slots among the blocks of consecutive free slots, normalized to
+         * [0, 1]. It is 0 when the free slots form a single block and 1 when no
+         * two free slots are consecutive.
+         */
+        double get_Fragmentation() const;
+
+    private:
+        /**
+         * @brief NumPositions has, at index w - 1, in how many positions a block
+         * of w consecutive slots fits into the free slots.
+         */
+        std::vector<unsigned int> NumPositions;
+        unsigned int LargestFreeBlock;
+        /**
+         * @brief BlockEntropySum is the sum of L ln L over the lengths L of the
+         * blocks of consecutive free slots.
+         */
+        double BlockEntropySum;
+
+        void add_FreeBlock(unsigned int Length);
+        void remove_FreeBlock(unsigned int Length);
+    };
+
+    /**
+     * @brief The NodeState struct is the mutable state of a Node.
+     */
+    struct NodeState
+    {
+        NodeState();
+
+        unsigned int NumUsedRegenerators;
+        unsigned long long TotalNumRequestedRegenerators;
+        unsigned int MaxSimultUsedRegenerators;
+        /**
+         * @brief isActive is true iff new connections can pass through the node.
+         */
+        bool isActive;
+    };
+
+    NetworkState();
+
+    /**
+     * @brief PageSize is the number of links or nodes in each page.
+     */
+    static constexpr unsigned int PageSize = 16;
+
+    /**
+     * @brief fork returns a copy of this state that shares its pages until
+     * either is changed.
+     */
+    std::shared_ptr<NetworkState> fork() const
+    {
+        return std::make_shared<NetworkState>(*this);
+    }
+
+    /**
+     * @brief get_NumLinks returns the number of links.
+     */
+    unsigned int get_NumLinks() const
+    {
+        return NumLinks;
+    }
+    /**
+     * @brief get_NumNodes returns the number of nodes.
+     */
+    unsigned int get_NumNodes() const
+    {
+        return NumNodes;
+    }
+
+    /**
+     * @brief get_Link returns the state of the link with index \a l.
+     */
+    const LinkState &get_Link(unsigned int l) const
+    {
+        return (*LinkPages[l / PageSize])[l % PageSize];
+    }
+    /**
+     * @brief get_Node returns the state of the node with index \a n.
+     */
+    const NodeState &get_Node(unsigned int n) const
+    {
+        return (*NodePages[n / PageSize])[n % PageSize];
+    }
+    /**
+     * @brief edit_Link returns the state of the link with index \a l, to be
+     * changed. Its page is copied first if it is shared with another state.
+     */
+    LinkState &edit_Link(unsigned int l)
+    {
+        return (*own_Page(LinkPages[l / PageSize]))[l % PageSize];
+    }
+    /**
+     * @brief edit_Node returns the state of the node with index \a n, to be
+     * changed. Its page is copied first if it is shared with another state.
+     */
+    NodeState &edit_Node(unsigned int n)
+    {
+        return (*own_Page(NodePages[n / PageSize]))[n % PageSize];
+    }
+
+    /**
+     * @brief add_Link adds the state of a new link, with every slot free.
+     * @param NumSlots is the number of frequency slots on the link.
+     * @return the index of the new link.
+     */
+    unsigned int add_Link(unsigned int NumSlots);
+    /**
+     * @brief add_Node adds the state of a new node, with no regenerator used.
+     * @return the index of the new node.
+     */
+    unsigned int add_Node();
+
+    /**
+     * @brief get_NumSharedPages returns how many pages of this state are shared
+     * with another state.
+     */
+    unsigned int get_NumSharedPages() const;
+
+private:
+    typedef std::vector<LinkState> LinkPage;
+    typedef std::vector<NodeState> NodePage;
+
+    std::vector<std::shared_ptr<LinkPage>> LinkPages;
+    std::vector<std::shared_ptr<NodePage>> NodePages;
+    unsigned int NumLinks;
+    unsigned int NumNodes;
+
+    template<class Page>
+    static Page *own_Page(std::shared_ptr<Page> &P)
+    {
+        if (P.use_count() > 1)
+            {
+            P = std::make_shared<Page>(*P);
+            }
+
+        return P.get();
+    }
+};
+
+#endif // NETWORKSTATE_H
@@ -3,6 +3,7 @@
 
 #include <boost/bimap.hpp>
 #include <GeneralClasses/Signal.h>
+#include <Structure/NetworkState.h>
 #include <memory>
 #include <vector>
 #include <iostream>
@@ -68,8 +69,11 @@ public:
      * @param ID is the number that identifies this node.
      * @param T is the type of node (TranslucentNode or TransparentNode)
      * @param A is the node Architecture (BS or SS)
+     * @param State is the state of the network that holds this node, if any.
+     * Otherwise, the node has a state of its own.
      */
-    Node(int ID, NodeType T = TransparentNode, NodeArchitecture A = Default_Arch);
+    Node(int ID, NodeType T = TransparentNode, NodeArchitecture A = Default_Arch,
+         std::shared_ptr<NetworkState> State = nullptr);
     Node(const Node &node);
 
     bool operator==(const Node &) const;
@@ -83,6 +87,10 @@ public:
      * @brief ID is the unique identifier of this node on the topology.
      */
     const int ID;
+    /**
+     * @brief Index is the index of this node in its NetworkState.
+     */
+    unsigned int Index;
     /**
      * @brief Neighbours is a vector containing the nodes that are neighbours to
      * this node.
@@ -148,6 +156,19 @@ public:
      * used on this node.
      */
     unsigned int get_NumMaxSimultUsedRegenerators();
+    /**
+     * @brief get_NumUsedRegenerators returns the quantity of regenerators
+     * currently in use on this node.
+     * @return the quantity of regenerators currently in use on this node.
+     */
+    unsigned int get_NumUsedRegenerators();
+    /**
+     * @brief set_RegeneratorUsage restores the regenerator usage counters of this
+     * node, as when resuming a simulation from a checkpoint.
+     */
+    void set_RegeneratorUsage(unsigned int NumUsed,
+                              unsigned long long TotalNumRequested,
+                              unsigned int MaxSimultUsed);
 
     /**
      * @brief request_Regenerators occupies i regenerators on this node,
@@ -228,7 +249,7 @@ public:
      */
     bool is_NodeActive() const
     {
-        return isActive;
+        return State->get_Node(Index).isActive;
     }
     /**
      * @brief set_NodeActive sets the node as active.
@@ -245,12 +266,9 @@ public:
 private:
     NodeType Type;
     NodeArchitecture Architecture;
-    bool isActive;
+    std::shared_ptr<NetworkState> State;
 
     void create_Devices();
-    unsigned int NumUsedRegenerators;
-    unsigned long long TotalNumRequestedRegenerators;
-    unsigned int MaxSimultUsedRegenerators;
     static NodeArchitecture Default_Arch;
 
     Devices::SSS *entranceSSS;
@@ -0,0 +1,148 @@
+#ifndef ROUTINGGRAPH_H
+#define ROUTINGGRAPH_H
+
+#include <memory>
+#include <vector>
+#include <Structure/NetworkState.h>
+
+class Link;
+class Node;
+class Topology;
+
+/**
+ * @brief The RoutingGraph class is a compiled view of a Topology, read by the
+ * routing algorithms.
+ *
+ * The nodes and links are addressed by their indices in the NetworkState, so
+ * Node::Index and Link::Index. The links departing from each node are stored in
+ * compressed sparse row form: the links departing from node n are the entries
+ * FirstEdge[n] to FirstEdge[n + 1] - 1 of EdgeTarget and EdgeLink, in the same
+ * order as in Node::Links. The links arriving at each node are stored likewise,
+ * in FirstInEdge, InEdgeSource and InEdgeLink, for the backward searches. The
+ * attributes of each link used by the routing costs are stored in one array per
+ * attribute.
+ *
+ * The activity of the nodes and links and the free slots are read from the
+ * state of the topology, so they are always current. The rest is a snapshot of
+ * the structure, rebuilt by the Topology when a node or a link is added or when
+ * the span length is changed.
+ *
+ * A copy of the graph reading another state, such as a NetworkFork, is built
+ * with the second constructor.
+ */
+class RoutingGraph
+{
+public:
+    /**
+     * @brief RoutingGraph is the standard constructor for a RoutingGraph.
+     * @param T is the topology to be compiled.
+     * @param State is the state of T.
+     */
+    RoutingGraph(const Topology &T, std::shared_ptr<const NetworkState> State);
+    /**
+     * @brief RoutingGraph is the constructor of a RoutingGraph with the same
+     * structure as \a Graph, but that reads another state, such as a fork of the
+     * state of its topology.
+     */
+    RoutingGraph(const RoutingGraph &Graph, std::shared_ptr<const NetworkState> State);
+
+    unsigned int NumNodes;
+    unsigned int NumLinks;
+
+    /**
+     * @brief FirstEdge has the first edge departing from each node. It has
+     * NumNodes + 1 entries.
+     */
+    std::vector<unsigned int> FirstEdge;
+    /**
+     * @brief EdgeTarget has the index of the node at which each edge arrives.
+     */
+    std::vector<unsigned int> EdgeTarget;
+    /**
+     * @brief EdgeLink has the index of the link of each edge.
+     */
+    std::vector<unsigned int> EdgeLink;
+    /**
+     * @brief FirstInEdge has the first edge arriving at each node. It has
+     * NumNodes + 1 entries.
+     */
+    std::vector<unsigned int> FirstInEdge;
+    /**
+     * @brief InEdgeSource has the index of the node from which each arriving
+     * edge departs.
+     */
+    std::vector<unsigned int> InEdgeSource;
+    /**
+     * @brief InEdgeLink has the index of the link of each arriving edge.
+     */
+    std::vector<unsigned int> InEdgeLink;
+
+    /**
+     * @brief LinkOrigin has the index of the origin node of each link.
+     */
+    std::vector<unsigned int> LinkOrigin;
+    /**
+     * @brief LinkDestination has the index of the destination node of each link.
+     */
+    std::vector<unsigned int> LinkDestination;
+    /**
+     * @brief LinkLength has the length of each link, in km.
+     */
+    std::vector<double> LinkLength;
+    /**
+     * @brief LinkNumSpans has the number of spans of each link, that is, its
+     * number of in line amplifiers plus one.
+     */
+    std::vector<unsigned int> LinkNumSpans;
+    /**
+     * @brief LengthLongestLink is the length of the longest link.
+     */
+    double LengthLongestLink;
+
+    /**
+     * @brief Links has a pointer to each link.
+     */
+    std::vector<std::shared_ptr<Link>> Links;
+    /**
+     * @brief Nodes has a pointer to each node.
+     */
+    std::vector<std::shared_ptr<Node>> Nodes;
+
+    /**
+     * @brief is_LinkActive returns true iff new connections can pass through the
+     * link with index LinkIndex.
+     */
+    bool is_LinkActive(unsigned int LinkIndex) const
+    {
+        return State->get_Link(LinkIndex).isActive;
+    }
+    /**
+     * @brief is_NodeActive returns true iff new connections can pass through the
+     * node with index NodeIndex.
+     */
+    bool is_NodeActive(unsigned int NodeIndex) const
+    {
+        return State->get_Node(NodeIndex).isActive;
+    }
+    /**
+     * @brief get_FreeSlots returns the free slots of the link with index
+     * LinkIndex.
+     */
+    const SlotBitset &get_FreeSlots(unsigned int LinkIndex) const
+    {
+        return State->get_Link(LinkIndex).FreeSlots;
+    }
+    /**
+     * @brief get_LinkState returns the state of the link with index LinkIndex,
+     * with its spectrum metrics.
+     */
+    const NetworkState::LinkState &get_LinkState(unsigned int LinkIndex) const
+    {
+        return State->get_Link(LinkIndex);
+    }
+
+private:
+    std::shared_ptr<const NetworkState> State;
+};
+
+#endif // ROUTINGGRAPH_H
@@ -3,7 +3,6 @@
 
 #include <memory>
 #include <vector>
-#include <GeneralClasses/SpectralDensity.h>
 
 class Link;
 
@@ -20,14 +19,16 @@ public:
 
     /**
      * @brief Slot is the standard constructor of a slot.
+     * @param numSlot identifies the slot in the link.
+     * @param Owner is the link that contains this slot, if any.
      */
-    Slot(int);
+    Slot(int numSlot, Link *Owner = nullptr);
     /**
-     * @brief Slot is the copy constructor of a slot.
+     * @brief Slot is the copy constructor of a slot. The copy belongs to no link.
      */
     Slot(const Slot &slot);
     /**
-     * @brief operator = is the assignment operator.
+     * @brief operator = is the assignment operator. The slot stays in its link.
      */
     Slot& operator= (const Slot &slot);
 
@@ -36,11 +37,18 @@ public:
      */
     int numSlot;
     /**
-     * @brief isFree is true, iff the slot is free.
+     * @brief isFree returns true, iff the slot is free. The occupancy of a slot
+     * of a link is only kept in the NetworkState of the link.
      */
-    bool isFree;
+    bool isFree() const;
     /**
-     * @brief freeSlot frees this slot, if it isn't free.
+     * @brief Owner is the link that contains this slot, or nullptr. freeSlot()
+     * and useSlot() change the free slots of the link.
+     */
+    Link *Owner;
+    /**
+     * @brief freeSlot frees this slot, if it isn't free. The spectral density of
+     * the slot in its link, if any, is cleared.
      */
     void freeSlot();
     /**
@@ -52,9 +60,25 @@ public:
      */
     static constexpr unsigned long samplesPerSlot = 50;
     /**
-     * @brief S is the main signal spectral density.
+     * @brief get_CenterFreq returns the central frequency of the slot. The grid
+     * of the owner link is centered at PhysicalConstants::freq.
+     */
+    double get_CenterFreq() const;
+    /**
+     * @brief get_FreqMin returns the beginning of the slot's bandwidth.
+     */
+    double get_FreqMin() const;
+    /**
+     * @brief get_FreqMax returns the end of the slot's bandwidth.
+     */
+    double get_FreqMax() const;
+
+private:
+    /**
+     * @brief isFreeWithoutOwner is the occupancy of a slot that belongs to no
+     * link.
      */
-    std::shared_ptr<SpectralDensity> S;
+    bool isFreeWithoutOwner;
 };
 
 #endif // SLOT_H
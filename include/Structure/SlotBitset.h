@@ -0,0 +1,182 @@
+#ifndef SLOTBITSET_H
+#define SLOTBITSET_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The SlotBitset class is a packed set of frequency slots, one bit per
+ * slot, such as the free slots of a Link.
+ *
+ * The bits are stored in 64-bit words. Up to InlineSlots slots, which covers
+ * the C band grids, the words are inline, so that a SlotBitset is copied
+ * without any allocation, and the intersection runs over every inline word, so
+ * that the compiler unrolls and vectorizes it. Wider grids, such as the C+L and
+ * S+C+L ones, keep their words on the heap. The bits past size() are always
+ * unset. The queries on runs of consecutive set bits skip whole words
+ * at once with the count-trailing-zeros instruction.
+ *
+ * The queries are compiled once for each of the common grid widths listed in
+ * SLOTBITSET_WIDTHS, so that their loops run over a number of words known at
+ * compile time, and once more for any other width.
+ */
+class SlotBitset
+{
+public:
+#define SLOTBITSET_WIDTHS \
+    X(64) \
+    X(128) \
+    X(320) \
+    X(384) //Widths, in slots, with specialised queries.
+
+    typedef uint64_t Word;
+    static constexpr unsigned WordSize = 64;
+    /**
+     * @brief MaxSlots is the largest number of slots a SlotBitset can hold,
+     * enough for an S+C+L grid of 6.25 GHz slots.
+     */
+    static constexpr unsigned MaxSlots = 4096;
+    static constexpr unsigned MaxWords = MaxSlots / WordSize;
+    /**
+     * @brief InlineSlots is the largest number of slots stored inline.
+     */
+    static constexpr unsigned InlineSlots = 512;
+    static constexpr unsigned NumInlineWords = InlineSlots / WordSize;
+
+    /**
+     * @brief SlotBitset is the standard constructor for a SlotBitset.
+     * @param NumSlots is the number of slots, at most MaxSlots.
+     * @param isSet is the initial value of every bit.
+     */
+    SlotBitset(unsigned NumSlots, bool isSet = false);
+
+    /**
+     * @brief size returns the number of slots.
+     */
+    unsigned size() const
+    {
+        return NumSlots;
+    }
+    /**
+     * @brief test returns true iff the bit of slot \a s is set.
+     */
+    bool test(unsigned s) const
+    {
+        return (get_Words()[s / WordSize] >> (s % WordSize)) & 1;
+    }
+    /**
+     * @brief set sets the bit of slot \a s.
+     */
+    void set(unsigned s)
+    {
+        get_Words()[s / WordSize] |= Word(1) << (s % WordSize);
+    }
+    /**
+     * @brief reset unsets the bit of slot \a s.
+     */
+    void reset(unsigned s)
+    {
+        get_Words()[s / WordSize] &= ~(Word(1) << (s % WordSize));
+    }
+    /**
+     * @brief operator &= intersects this set with \a Other, which must have the
+     * same size.
+     */
+    SlotBitset &operator&=(const SlotBitset &Other)
+    {
+        if (HeapWords.empty())
+            {
+            for (unsigned w = 0; w < NumInlineWords; w++)
+                {
+                InlineWords[w] &= Other.InlineWords[w];
+                }
+            }
+        else
+            {
+            for (unsigned w = 0; w < HeapWords.size(); w++)
+                {
+                HeapWords[w] &= Other.HeapWords[w];
+                }
+            }
+        return *this;
+    }
+    /**
+     * @brief operator == compares two sets for equality.
+     */
+    bool operator==(const SlotBitset &Other) const;
+    /**
+     * @brief get_Word returns the w-th word, whose bit i is the slot w * 64 + i.
+     */
+    Word get_Word(unsigned w) const
+    {
+        return get_Words()[w];
+    }
+
+    /**
+     * @brief count returns the number of set bits.
+     */
+    unsigned count() const;
+    /**
+     * @brief find_Next returns the first slot, not before \a s, whose bit is
+     * \a isSet, or size() if there is none.
+     */
+    unsigned find_Next(unsigned s, bool isSet = true) const;
+    /**
+     * @brief find_Previous returns the last slot, not after \a s, whose bit is
+     * \a isSet, or -1 if there is none.
+     */
+    int find_Previous(unsigned s, bool isSet = true) const;
+    /**
+     * @brief find_FirstRun returns the first slot of the first run of at least
+     * \a Length consecutive set bits, or -1 if there is none. \a Length must be
+     * positive.
+     */
+    int find_FirstRun(unsigned Length) const;
+    /**
+     * @brief get_LongestRun returns the length of the longest run of consecutive
+     * set bits.
+     */
+    unsigned get_LongestRun() const;
+    /**
+     * @brief get_NumPositions returns in how many positions a block of \a Length
+     * consecutive slots fits into the set bits. \a Length must be positive.
+     */
+    unsigned get_NumPositions(unsigned Length) const;
+
+    /**
+     * @brief for_each_Run calls \a F(Begin, End) for each maximal run of
+     * consecutive set bits, in increasing order, where End is one past the last
+     * slot of the run.
+     */
+    template<class Function>
+    void for_each_Run(Function F) const
+    {
+        unsigned Begin = find_Next(0, true);
+        while (Begin < NumSlots)
+            {
+            unsigned End = find_Next(Begin, false);
+            F(Begin, End);
+            Begin = find_Next(End, true);
+            }
+    }
+
+private:
+    unsigned NumSlots;
+    Word InlineWords[NumInlineWords];
+    /**
+     * @brief HeapWords has the words of the sets wider than InlineSlots, and is
+     * empty otherwise.
+     */
+    std::vector<Word> HeapWords;
+
+    const Word *get_Words() const
+    {
+        return HeapWords.empty() ? InlineWords : HeapWords.data();
+    }
+    Word *get_Words()
+    {
+        return HeapWords.empty() ? InlineWords : HeapWords.data();
+    }
+};
+
+#endif // SLOTBITSET_H
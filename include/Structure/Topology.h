@@ -1,14 +1,18 @@
 #ifndef TOPOLOGY_H
 #define TOPOLOGY_H
 
+#include <cstdint>
+#include <iosfwd>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 #include <boost/bimap.hpp>
 #include <Structure/Node.h>
+#include <Structure/NetworkState.h>
 
 class Link;
+class RoutingGraph;
 
 /**
  * @brief The Topology class represents a topology, i.e. a set of links and
@@ -44,11 +48,18 @@ public:
      */
     Topology();
     /**
-     * @brief Topology is the copy constructor for a Topology.
+     * @brief Topology is the copy constructor for a Topology. The copy has its
+     * own nodes, links and state, with every slot free, but shares the fibers
+     * and in line amplifiers of the links with the original topology.
      */
     Topology(const Topology &topology);
     /**
     * @brief Topology is the basic constructor for a Topology.
+    *
+    * The file is either a text file with [nodes] and [links] sections, as
+    * written by save(), possibly among other sections, or a binary file
+    * written by save_Binary(). The kind of file is told by its first bytes.
+    *
     * @param TopologyFileName is the file in which the Topology was stored.
     */
     Topology(std::string TopologyFileName);
@@ -94,6 +105,73 @@ public:
      * @param TopologyFileName is the filename where this topology will be saved.
      */
     void save(std::string TopologyFileName);
+    /**
+     * @brief save_Binary saves the structure of this topology into a compact
+     * binary file, that is memory-mapped when read back by the constructor.
+     * The file holds the same data as the text format: the number of slots,
+     * the nodes and the links, in the order they were added, and their hash.
+     * It is stored in the native byte order, so it is a cache meant to be
+     * read on the machine that wrote it.
+     * @param TopologyFileName is the file to be created.
+     */
+    void save_Binary(std::string TopologyFileName);
+    /**
+     * @brief get_Hash returns a 64-bit FNV-1a hash of the structure of this
+     * topology: the number of slots, the nodes and the links, in the order they
+     * were added. Topologies loaded from the same data have the same hash, so
+     * it can key data precomputed over a topology.
+     */
+    uint64_t get_Hash() const;
+    /**
+     * @brief save_State writes the occupancy of this topology into a binary
+     * stream: the slots in use and the activity of each link and the
+     * regenerators in use and the activity of each node. If the filter
+     * imperfection is considered, the spectral density on each slot is also
+     * written.
+     */
+    void save_State(std::ostream &Stream);
+    /**
+     * @brief load_State restores the occupancy written by save_State(). The
+     * topology must have the same nodes and links as the one that was saved.
+     */
+    void load_State(std::istream &Stream);
+    /**
+     * @brief get_State returns the mutable state of this topology: the free slots
+     * and the activity of each link, and the regenerator usage and the activity
+     * of each node.
+     */
+    const NetworkState &get_State() const
+    {
+        return *State;
+    }
+    /**
+     * @brief set_State restores a state returned by get_State(), either from this
+     * topology or from a copy of it. The slots are used and freed through the
+     * Slot objects, so the spectral densities of the freed slots are cleared.
+     */
+    void set_State(const NetworkState &State);
+    /**
+     * @brief get_RoutingGraph returns the compiled view of this topology read by
+     * the routing algorithms. It is built on the first call, and rebuilt after a
+     * node or a link is added or the span length is changed.
+     */
+    const RoutingGraph &get_RoutingGraph();
+
+    /**
+     * @brief get_NumSlots returns the number of frequency slots on each link of
+     * this topology.
+     */
+    int get_NumSlots() const
+    {
+        return NumSlots;
+    }
+    /**
+     * @brief set_NumSlots sets the number of frequency slots on each link of
+     * this topology. It must be set before the links are added, and be at most
+     * SlotBitset::MaxSlots, or the program aborts.
+     * @param NumSlots is the new number of frequency slots.
+     */
+    void set_NumSlots(int NumSlots);
 
     /**
      * @brief get_LengthLongestLink returns the length of the longest link in this
@@ -155,7 +233,56 @@ public:
     void print();
 
 private:
+    /**
+     * @brief The BinaryHeader struct starts a file written by save_Binary(). It
+     * is followed by NumNodes NodeRecords and NumLinks LinkRecords.
+     */
+    struct BinaryHeader
+    {
+        char Magic[8];
+        uint32_t Version;
+        uint32_t NumSlots;
+        uint64_t NumNodes;
+        uint64_t NumLinks;
+        uint64_t Hash;
+    };
+    struct NodeRecord
+    {
+        int32_t ID;
+        int32_t NumRegenerators;
+        uint8_t Type;
+        uint8_t Architecture;
+        uint16_t Reserved;
+    };
+    struct LinkRecord
+    {
+        uint32_t Origin; /*!< Index of the origin node in Nodes. */
+        uint32_t Destination; /*!< Index of the destination node in Nodes. */
+        double Length;
+    };
+
+    static const char BinaryMagic[8];
+    static constexpr uint32_t BinaryVersion = 1;
+
+    void load_Text(std::string TopologyFileName);
+    /**
+     * @brief load_Binary reads a file written by save_Binary(). The magic,
+     * version, sizes, hash and node indices of the file are validated before
+     * the topology is changed.
+     * @return false iff the file could not be read or is invalid, in which case
+     * the topology is unchanged.
+     */
+    bool load_Binary(std::string TopologyFileName);
+    void get_Records(std::vector<NodeRecord> &NodeRecords,
+                     std::vector<LinkRecord> &LinkRecords) const;
+    static uint64_t get_Hash(uint32_t NumSlots,
+                             const NodeRecord *NodeRecords, uint64_t NumNodes,
+                             const LinkRecord *LinkRecords, uint64_t NumLinks);
+
     double LongestLink;
+    int NumSlots;
+    std::shared_ptr<NetworkState> State;
+    std::shared_ptr<RoutingGraph> Graph;
 };
 
 #endif // TOPOLOGY_H
@@ -0,0 +1,112 @@
+#ifndef TOPOLOGYGENERATOR_H
+#define TOPOLOGYGENERATOR_H
+
+#include <memory>
+#include <string>
+#include <boost/bimap.hpp>
+#include <GeneralClasses/RandomGenerator.h>
+
+class Topology;
+
+/**
+ * @brief The TopologyGenerator class creates synthetic topologies, much larger
+ * than the bundled ones, so that it is possible to study how the simulator
+ * scales with the number of nodes.
+ *
+ * On the Waxman and Barabási-Albert models, the nodes are placed uniformly at
+ * random over a square, and the length of each link is the distance between its
+ * nodes. On the grid and on the ring of rings, the links have fixed lengths.
+ * Every link is created in both directions, and the generated topologies are
+ * always connected. They can be written in the [nodes]/[links] format of the
+ * bundled topologies with Topology::save().
+ */
+class TopologyGenerator
+{
+public:
+#define TOPOLOGY_MODELS \
+    X(Waxman, "Waxman", "waxman") \
+    X(BarabasiAlbert, "Barabasi-Albert", "barabasialbert") \
+    X(Grid, "Grid", "grid") \
+    X(RingOfRings, "Ring of Rings", "ringofrings") //Code Name, Name, Nickname
+
+#define X(a,b,c) a,
+    enum TopologyModels
+    {
+        TOPOLOGY_MODELS
+    };
+#undef X
+
+    typedef boost::bimap<TopologyModels, std::string> TopologyModelsBimap;
+    static TopologyModelsBimap TopologyModelsNames;
+    static TopologyModelsBimap TopologyModelsNicknames;
+
+    /**
+     * @brief TopologyGenerator is the standard constructor for a
+     * TopologyGenerator.
+     * @param Model is the model of the generated topologies.
+     * @param NumNodes is the number of nodes of the generated topologies.
+     * @param Seed is the seed of the random numbers. Two generators with the
+     * same parameters and seed create the same topology.
+     */
+    TopologyGenerator(TopologyModels Model, unsigned int NumNodes,
+                      uint64_t Seed = RandomGenerator::MasterSeed);
+
+    /**
+     * @brief create generates a new topology.
+     * @return a pointer to the generated topology.
+     */
+    std::shared_ptr<Topology> create() const;
+
+    TopologyModels Model;
+    unsigned int NumNodes;
+    uint64_t Seed;
+
+    /**
+     * @brief AreaSide is the side of the square over which the nodes are placed,
+     * in kilometers.
+     */
+    double AreaSide;
+    /**
+     * @brief MinLinkLength is the smallest length of a link between randomly
+     * placed nodes, in kilometers.
+     */
+    double MinLinkLength;
+    /**
+     * @brief AvgDegree is the average number of neighbours of a node on the
+     * Waxman model. It sets the parameter beta of the model.
+     */
+    double AvgDegree;
+    /**
+     * @brief Alpha is the parameter alpha of the Waxman model: the probability of
+     * a link decays as exp(-d / (Alpha * L)), where d is the length of the link
+     * and L is the largest possible distance.
+     */
+    double Alpha;
+    /**
+     * @brief NumAttachments is the number of links to the existing nodes made by
+     * each new node on the Barabási-Albert model.
+     */
+    unsigned int NumAttachments;
+    /**
+     * @brief LinkLength is the length of the links of the grid and of the links
+     * inside each ring of the ring of rings, in kilometers.
+     */
+    double LinkLength;
+    /**
+     * @brief RingSize is the number of nodes on each ring of the ring of rings.
+     */
+    unsigned int RingSize;
+    /**
+     * @brief BackboneLinkLength is the length of the links of the ring that
+     * joins the first node of each ring, in kilometers.
+     */
+    double BackboneLinkLength;
+
+private:
+    void create_Waxman(Topology &T, RandomGenerator &Stream) const;
+    void create_BarabasiAlbert(Topology &T, RandomGenerator &Stream) const;
+    void create_Grid(Topology &T) const;
+    void create_RingOfRings(Topology &T) const;
+};
+
+#endif // TOPOLOGYGENERATOR_H
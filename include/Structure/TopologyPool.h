@@ -0,0 +1,70 @@
+#ifndef TOPOLOGYPOOL_H
+#define TOPOLOGYPOOL_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Topology;
+class NetworkState;
+
+/**
+ * @brief The TopologyPool class hands out copies of a prototype topology to the
+ * simulations of an optimization, such as the individuals of a genetic algorithm
+ * or the particles of a swarm, that each need a topology of their own.
+ *
+ * A copy is built only when every copy built so far is in use. When the last
+ * pointer to a copy is released, the copy returns to the pool, and the next call
+ * to acquire() hands it out again, with only its state reset: every slot free,
+ * every node and link active and no regenerator used, and the type and
+ * regenerators of each node taken from the prototype. The number of copies built
+ * is thus the largest number of simulations that run at once, and not the
+ * number of simulations.
+ *
+ * The prototype may change the types and regenerators of its nodes between the
+ * calls to acquire(), but not its nodes, links or number of slots. The copies
+ * can be acquired and released by several threads at once.
+ */
+class TopologyPool
+{
+public:
+    /**
+     * @brief TopologyPool is the standard constructor for a TopologyPool.
+     * @param Prototype is the topology copied by this pool.
+     */
+    TopologyPool(std::shared_ptr<const Topology> Prototype);
+
+    /**
+     * @brief acquire returns a copy of the prototype, with every slot free. The
+     * copy returns to this pool when the last pointer to it is released.
+     */
+    std::shared_ptr<Topology> acquire();
+
+    /**
+     * @brief get_NumCopies returns the number of copies built by this pool.
+     */
+    unsigned int get_NumCopies() const;
+
+private:
+    /**
+     * @brief The Shelf struct keeps the copies that are not in use. It is
+     * shared with the copies in use, so that they can return to it.
+     */
+    struct Shelf
+    {
+        std::mutex Mutex;
+        std::vector<std::unique_ptr<Topology>> Copies;
+        unsigned int NumCopies = 0;
+    };
+
+    std::shared_ptr<const Topology> Prototype;
+    std::shared_ptr<Shelf> Free;
+    /**
+     * @brief CleanState is the state of a new copy of the prototype.
+     */
+    std::shared_ptr<const NetworkState> CleanState;
+
+    void reset(Topology &Copy) const;
+};
+
+#endif // TOPOLOGYPOOL_H
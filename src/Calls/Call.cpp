@@ -1,9 +1,10 @@
 #include <Calls/Call.h>
-#include <Calls/Event.h>
 
 Call::Call(std::weak_ptr<Node> Origin,
            std::weak_ptr<Node> Destination,
            TransmissionBitrate Bitrate)  :
+    ArrivalTime(0),
+    EndingTime(0),
     Origin(Origin),
     Destination(Destination),
     Bitrate(Bitrate),
@@ -1,18 +1,18 @@
 #include <Calls/CallGenerator.h>
 #include <Calls/Call.h>
 #include <Calls/Event.h>
-#include <GeneralClasses/RandomGenerator.h>
-
-bool CallGenerator::EventCompare::operator()(const std::shared_ptr<Event> a,
-        const std::shared_ptr<Event> b) const
-{
-    return *a > *b;
-}
+#include <RMSA/Route.h>
+#include <Structure/Link.h>
+#include <Structure/Slot.h>
+#include <GeneralClasses/BinaryStream.h>
+#include <iostream>
+#include <map>
 
 CallGenerator::CallGenerator(std::shared_ptr<Topology> T,
                              double h,
-                             std::vector<TransmissionBitrate> Bitrates) :
-    T(T), h(h), simulationTime(0), Bitrates(Bitrates)
+                             std::vector<TransmissionBitrate> Bitrates,
+                             RandomGenerator Stream) :
+    T(T), h(h), simulationTime(0), Bitrates(Bitrates), Stream(Stream)
 {
 
     UniformNodeDistribution = std::uniform_int_distribution<int>
@@ -27,37 +27,106 @@ CallGenerator::CallGenerator(std::shared_ptr<Topology> T,
 
 std::shared_ptr<Call> CallGenerator::generate_Call()
 {
-    double ArrivalTime = simulationTime + ExponentialDistributionH(
-                             random_generator);
-    double EndingTime = ArrivalTime + ExponentialDistributionMu(random_generator);
-    simulationTime = ArrivalTime;
+    CallTrace::CallRecord Record;
+
+    if (Trace && Trace->Mode == CallTrace::Replaying)
+        {
+        const CallTrace::CallRecord *NextRecord = Trace->read();
+        if (NextRecord == nullptr)
+            {
+            return nullptr;
+            }
+        Record = *NextRecord;
+
+        if (Record.Origin >= T->Nodes.size() || Record.Destination >= T->Nodes.size() ||
+                Record.Bitrate >= Bitrates.size())
+            {
+            std::cerr << "Trace does not match the topology or the bitrates." << std::endl;
+            abort();
+            }
+        }
+    else
+        {
+        Record.ArrivalTime = simulationTime + ExponentialDistributionH(Stream);
+        Record.HoldingTime = ExponentialDistributionMu(Stream);
+
+        int Origin = UniformNodeDistribution(Stream);
+        int Destination = UniformNodeDistribution(Stream);
+
+        while (Origin == Destination)
+            {
+            Destination = UniformNodeDistribution(Stream);
+            }
 
-    int Origin = UniformNodeDistribution(random_generator);
-    int Destination = UniformNodeDistribution(random_generator);
+        Record.Origin = Origin;
+        Record.Destination = Destination;
+        Record.Bitrate = UniformBitrateDistribution(Stream);
+        Record.Reserved = 0;
 
-    while (Origin == Destination)
+        if (Trace)
+            {
+            Trace->write(Record);
+            }
+        }
+
+    simulationTime = Record.ArrivalTime;
+
+    Call C(std::weak_ptr<Node>(T->Nodes[Record.Origin]),
+           std::weak_ptr<Node>(T->Nodes[Record.Destination]),
+           Bitrates[Record.Bitrate]);
+    C.ArrivalTime = Record.ArrivalTime;
+    C.EndingTime = Record.ArrivalTime + Record.HoldingTime;
+
+    unsigned index;
+    if (FreeCalls.empty())
+        {
+        index = CallPool.size();
+        CallPool.push_back(C);
+        }
+    else
         {
-        Destination = UniformNodeDistribution(random_generator);
+        index = FreeCalls.back();
+        FreeCalls.pop_back();
+        CallPool[index] = C;
         }
 
-    int Bitrate = UniformBitrateDistribution(random_generator);
+    Events.push(Event(Record.ArrivalTime, Event::CallRequisition, index));
+
+    return get_Call(index);
+}
 
-    std::shared_ptr<Call> C(new Call(std::weak_ptr<Node>(T->Nodes[Origin]),
-                                     std::weak_ptr<Node>(T->Nodes[Destination]),
-                                     Bitrates[Bitrate]));
+std::shared_ptr<Call> CallGenerator::get_Call(unsigned index)
+{
+#ifdef RUN_ASSERTIONS
+    if (index >= CallPool.size())
+        {
+        std::cerr << "Invalid call index." << std::endl;
+        abort();
+        }
+#endif
+    //Aliasing an empty shared_ptr: no control block, no reference counting.
+    return std::shared_ptr<Call>(std::shared_ptr<Call>(), &CallPool[index]);
+}
 
-    std::shared_ptr<Event> CallRequisition(new Event(ArrivalTime,
-                                           Event::CallRequisition, C));
-    std::shared_ptr<Event> CallEnding(new Event(EndingTime,
-                                      Event::CallEnding, C));
+void CallGenerator::schedule_CallEnding(unsigned index)
+{
+    Events.push(Event(CallPool[index].EndingTime, Event::CallEnding, index));
+}
 
-    Events.push(CallRequisition);
-    Events.push(CallEnding);
+void CallGenerator::release_Call(unsigned index)
+{
+    CallPool[index].route.reset();
+    FreeCalls.push_back(index);
+}
 
-    C->CallRequisition = CallRequisition;
-    C->CallEnding = CallEnding;
+void CallGenerator::record_Trace(std::string FileName)
+{
+    Trace = std::make_shared<CallTrace>(FileName, CallTrace::Recording);
+}
 
-    return C;
+void CallGenerator::replay_Trace(std::string FileName)
+{
+    Trace = std::make_shared<CallTrace>(FileName, CallTrace::Replaying);
 }
 
 void CallGenerator::set_Load(double h)
@@ -72,3 +141,205 @@ void CallGenerator::set_Load(double h)
     this->h = h;
     ExponentialDistributionH = std::exponential_distribution<double>(h);
 }
+
+void CallGenerator::save_State(std::ostream &Out)
+{
+#ifdef RUN_ASSERTIONS
+    if (Trace && Trace->Mode == CallTrace::Recording)
+        {
+        std::cerr << "Can not save the state while recording a trace." << std::endl;
+        abort();
+        }
+#endif
+
+    BinaryStream::write(Out, simulationTime);
+    BinaryStream::write(Out, Stream);
+    BinaryStream::write(Out, (uint64_t)(Trace ? Trace->get_Position() : 0));
+
+    //Heap order, so that the very same calendar is rebuilt
+    BinaryStream::write(Out, (uint64_t) Events.size());
+    for (auto &evt : Events.get_Events())
+        {
+        BinaryStream::write(Out, evt.t);
+        BinaryStream::write(Out, (int32_t) evt.Type);
+        BinaryStream::write(Out, evt.Parent);
+        }
+
+    BinaryStream::write(Out, FreeCalls);
+
+    BinaryStream::write(Out, (uint64_t) CallPool.size());
+    for (auto &C : CallPool)
+        {
+        BinaryStream::write(Out, C.ArrivalTime);
+        BinaryStream::write(Out, C.EndingTime);
+        BinaryStream::write(Out, C.Origin.lock()->ID);
+        BinaryStream::write(Out, C.Destination.lock()->ID);
+        BinaryStream::write(Out, C.Bitrate.get_Bitrate());
+        BinaryStream::write(Out, (int32_t) C.Status);
+        BinaryStream::write(Out, C.Scheme.get_M());
+        BinaryStream::write(Out, C.Scheme.get_SNR_Per_Bit().in_dB());
+        BinaryStream::write(Out, C.blockingReason);
+
+        BinaryStream::write(Out, (uint8_t)(C.route != nullptr));
+        if (C.route == nullptr)
+            {
+            continue;
+            }
+
+        BinaryStream::write(Out, (uint64_t) C.route->Nodes.size());
+        for (auto &node : C.route->Nodes)
+            {
+            BinaryStream::write(Out, node.lock()->ID);
+            }
+
+        BinaryStream::write(Out, (uint64_t) C.route->Links.size());
+        for (auto &link : C.route->Links)
+            {
+            BinaryStream::write(Out, link.lock()->Origin.lock()->ID);
+            BinaryStream::write(Out, link.lock()->Destination.lock()->ID);
+            }
+
+        BinaryStream::write(Out, (uint64_t) C.route->Slots.size());
+        for (auto &link : C.route->Slots)
+            {
+            BinaryStream::write(Out, link.first.lock()->Origin.lock()->ID);
+            BinaryStream::write(Out, link.first.lock()->Destination.lock()->ID);
+            BinaryStream::write(Out, (uint64_t) link.second.size());
+            for (auto &slot : link.second)
+                {
+                BinaryStream::write(Out, slot.lock()->numSlot);
+                }
+            }
+
+        BinaryStream::write(Out, (uint64_t) C.route->Regenerators.size());
+        for (auto &reg : C.route->Regenerators)
+            {
+            BinaryStream::write(Out, reg.first.lock()->ID);
+            BinaryStream::write(Out, reg.second);
+            }
+        }
+}
+
+void CallGenerator::load_State(std::istream &In)
+{
+    std::map<int, std::shared_ptr<Node>> NodesByID;
+    for (auto &node : T->Nodes)
+        {
+        NodesByID[node->ID] = node;
+        }
+
+    auto read_Node = [&]()
+        {
+        int ID;
+        BinaryStream::read(In, ID);
+        return NodesByID.at(ID);
+        };
+    auto read_Link = [&]()
+        {
+        std::pair<int, int> Key;
+        BinaryStream::read(In, Key.first);
+        BinaryStream::read(In, Key.second);
+        return T->Links.at(Key);
+        };
+
+    uint64_t TracePosition;
+    BinaryStream::read(In, simulationTime);
+    BinaryStream::read(In, Stream);
+    BinaryStream::read(In, TracePosition);
+    if (Trace && Trace->Mode == CallTrace::Replaying)
+        {
+        Trace->set_Position(TracePosition);
+        }
+
+    uint64_t NumEvents;
+    BinaryStream::read(In, NumEvents);
+    Events.clear();
+    Events.reserve(NumEvents);
+    for (uint64_t i = 0; i < NumEvents; i++)
+        {
+        double t;
+        int32_t Type;
+        unsigned Parent;
+        BinaryStream::read(In, t);
+        BinaryStream::read(In, Type);
+        BinaryStream::read(In, Parent);
+        Events.push(Event(t, (Event::Event_Type) Type, Parent));
+        }
+
+    BinaryStream::read(In, FreeCalls);
+
+    uint64_t NumCalls;
+    BinaryStream::read(In, NumCalls);
+    CallPool.clear();
+    for (uint64_t i = 0; i < NumCalls; i++)
+        {
+        double ArrivalTime, EndingTime, Bitrate, SNR_Per_Bit;
+        int32_t Status;
+        unsigned int M;
+        BinaryStream::read(In, ArrivalTime);
+        BinaryStream::read(In, EndingTime);
+        auto Origin = read_Node();
+        auto Destination = read_Node();
+        BinaryStream::read(In, Bitrate);
+        BinaryStream::read(In, Status);
+        BinaryStream::read(In, M);
+        BinaryStream::read(In, SNR_Per_Bit);
+
+        Call C(Origin, Destination, TransmissionBitrate(Bitrate),
+               ModulationScheme(M, Gain(SNR_Per_Bit, Gain::dB)));
+        C.ArrivalTime = ArrivalTime;
+        C.EndingTime = EndingTime;
+        C.Status = (Call::Call_Status) Status;
+        BinaryStream::read(In, C.blockingReason);
+
+        uint8_t hasRoute;
+        BinaryStream::read(In, hasRoute);
+        if (hasRoute)
+            {
+            C.route = std::make_shared<RMSA::Route>(
+                          std::vector<RMSA::TransparentSegment>(),
+                          std::map<std::weak_ptr<Link>, std::vector<std::weak_ptr<Slot>>,
+                          std::owner_less<std::weak_ptr<Link>>>());
+
+            uint64_t Size;
+            BinaryStream::read(In, Size);
+            for (uint64_t j = 0; j < Size; j++)
+                {
+                C.route->Nodes.push_back(read_Node());
+                }
+
+            BinaryStream::read(In, Size);
+            for (uint64_t j = 0; j < Size; j++)
+                {
+                C.route->Links.push_back(read_Link());
+                }
+
+            BinaryStream::read(In, Size);
+            for (uint64_t j = 0; j < Size; j++)
+                {
+                auto link = read_Link();
+                uint64_t NumSlots;
+                BinaryStream::read(In, NumSlots);
+
+                auto &Slots = C.route->Slots[link];
+                for (uint64_t k = 0; k < NumSlots; k++)
+                    {
+                    int numSlot;
+                    BinaryStream::read(In, numSlot);
+                    Slots.push_back(link->Slots.at(numSlot));
+                    }
+                }
+
+            BinaryStream::read(In, Size);
+            for (uint64_t j = 0; j < Size; j++)
+                {
+                auto node = read_Node();
+                unsigned int NumRegenerators;
+                BinaryStream::read(In, NumRegenerators);
+                C.route->Regenerators.emplace(node, NumRegenerators);
+                }
+            }
+
+        CallPool.push_back(C);
+        }
+}
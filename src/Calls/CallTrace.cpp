@@ -0,0 +1,239 @@
+#include <Calls/CallTrace.h>
+#include <Structure/Topology.h>
+#include <Structure/Node.h>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const char CallTrace::TraceMagic[8] = {'S', 'I', 'M', 'E', 'O', 'N', 'C', 'T'};
+
+CallTrace::CallTrace(std::string FileName, Trace_Mode Mode) :
+    Mode(Mode), FileName(FileName), NumRecords(0), Mapping(nullptr),
+    MappingSize(0), Records(nullptr), NextRecord(0)
+{
+    if (Mode == Recording)
+        {
+        OutFile.open(FileName, std::ofstream::out | std::ofstream::binary |
+                     std::ofstream::trunc);
+        if (!OutFile.is_open())
+            {
+            std::cerr << "Trace file " << FileName << " could not be created." << std::endl;
+            abort();
+            }
+        //The number of records is only known when the recording is closed.
+        TraceHeader Header;
+        std::memcpy(Header.Magic, TraceMagic, sizeof(TraceMagic));
+        Header.Version = TraceVersion;
+        Header.RecordSize = sizeof(CallRecord);
+        Header.NumRecords = 0;
+        OutFile.write(reinterpret_cast<const char *>(&Header), sizeof(Header));
+        return;
+        }
+
+    int FileDescriptor = open(FileName.c_str(), O_RDONLY);
+    if (FileDescriptor < 0)
+        {
+        std::cerr << "Trace file " << FileName << " could not be opened." << std::endl;
+        abort();
+        }
+
+    struct stat FileStatus;
+    if (fstat(FileDescriptor, &FileStatus) != 0 ||
+            (size_t) FileStatus.st_size < sizeof(TraceHeader))
+        {
+        std::cerr << "Invalid trace file " << FileName << "." << std::endl;
+        abort();
+        }
+    MappingSize = FileStatus.st_size;
+    Mapping = mmap(nullptr, MappingSize, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+    ::close(FileDescriptor);
+
+    if (Mapping == MAP_FAILED)
+        {
+        std::cerr << "Trace file " << FileName << " could not be mapped." << std::endl;
+        abort();
+        }
+
+    madvise(Mapping, MappingSize, MADV_SEQUENTIAL);
+
+    //The records announced by the header must lie within the mapping
+    const TraceHeader *Header = static_cast<const TraceHeader *>(Mapping);
+    if (std::memcmp(Header->Magic, TraceMagic, sizeof(TraceMagic)) != 0 ||
+            Header->Version != TraceVersion ||
+            Header->RecordSize != sizeof(CallRecord) ||
+            Header->NumRecords > (MappingSize - sizeof(TraceHeader)) / sizeof(CallRecord))
+        {
+        std::cerr << "Invalid trace file " << FileName << "." << std::endl;
+        abort();
+        }
+
+    NumRecords = Header->NumRecords;
+    Records = reinterpret_cast<const CallRecord *>(static_cast<const char *>
+              (Mapping) + sizeof(TraceHeader));
+}
+
+CallTrace::~CallTrace()
+{
+    close();
+}
+
+void CallTrace::write(const CallRecord &Record)
+{
+#ifdef RUN_ASSERTIONS
+    if (Mode != Recording || !OutFile.is_open())
+        {
+        std::cerr << "Trace is not being recorded." << std::endl;
+        abort();
+        }
+#endif
+
+    OutFile.write(reinterpret_cast<const char *>(&Record), sizeof(CallRecord));
+    NumRecords++;
+}
+
+const CallTrace::CallRecord *CallTrace::read()
+{
+#ifdef RUN_ASSERTIONS
+    if (Mode != Replaying)
+        {
+        std::cerr << "Trace is not being replayed." << std::endl;
+        abort();
+        }
+#endif
+
+    if (NextRecord >= NumRecords)
+        {
+        return nullptr;
+        }
+
+    return &Records[NextRecord++];
+}
+
+void CallTrace::rewind()
+{
+    NextRecord = 0;
+}
+
+uint64_t CallTrace::get_Position() const
+{
+    return NextRecord;
+}
+
+void CallTrace::set_Position(uint64_t Position)
+{
+#ifdef RUN_ASSERTIONS
+    if (Mode != Replaying || Position > NumRecords)
+        {
+        std::cerr << "Invalid trace position." << std::endl;
+        abort();
+        }
+#endif
+
+    NextRecord = Position;
+}
+
+void CallTrace::close()
+{
+    if (Mode == Recording && OutFile.is_open())
+        {
+        OutFile.seekp(offsetof(TraceHeader, NumRecords));
+        OutFile.write(reinterpret_cast<const char *>(&NumRecords), sizeof(NumRecords));
+        OutFile.close();
+        }
+    else if (Mode == Replaying && Mapping != nullptr)
+        {
+        munmap(Mapping, MappingSize);
+        Mapping = nullptr;
+        Records = nullptr;
+        NumRecords = 0;
+        }
+}
+
+uint64_t CallTrace::get_NumRecords() const
+{
+    return NumRecords;
+}
+
+uint64_t CallTrace::import_CSV(std::string CSVFileName,
+                               std::string TraceFileName,
+                               std::shared_ptr<Topology> T,
+                               std::vector<TransmissionBitrate> Bitrates)
+{
+    std::ifstream CSVFile(CSVFileName);
+    if (!CSVFile.is_open())
+        {
+        std::cerr << "Input file is not open" << std::endl;
+        abort();
+        }
+
+    std::map<int, uint16_t> NodeIndex;
+    for (size_t n = 0; n < T->Nodes.size(); ++n)
+        {
+        NodeIndex[T->Nodes[n]->ID] = n;
+        }
+
+    CallTrace Trace(TraceFileName, Recording);
+    std::string Line;
+    unsigned long LineNumber = 0;
+    double LastArrival = 0;
+
+    while (std::getline(CSVFile, Line))
+        {
+        LineNumber++;
+
+        for (auto &c : Line)
+            {
+            if (c == ',' || c == ';')
+                {
+                c = ' ';
+                }
+            }
+
+        std::istringstream Fields(Line);
+        double Arrival, Holding, Bitrate;
+        int Origin, Destination;
+
+        if (!(Fields >> Arrival))
+            {
+            continue; //Header or empty line
+            }
+        Fields >> Holding >> Origin >> Destination >> Bitrate;
+
+        auto BitrateIt = std::find_if(Bitrates.begin(), Bitrates.end(),
+                                      [Bitrate](const TransmissionBitrate & br)
+            {
+            return br.get_Bitrate() == Bitrate;
+            });
+
+        //The comparisons also reject NaN times
+        if (Fields.fail() || !(Holding >= 0) || !(Arrival >= LastArrival) ||
+                NodeIndex.count(Origin) == 0 || NodeIndex.count(Destination) == 0 ||
+                Origin == Destination || BitrateIt == Bitrates.end())
+            {
+            std::cerr << "Invalid connection on line " << LineNumber << " of "
+                      << CSVFileName << "." << std::endl;
+            Trace.close();
+            std::remove(TraceFileName.c_str());
+            abort();
+            }
+
+        CallRecord Record;
+        Record.ArrivalTime = LastArrival = Arrival;
+        Record.HoldingTime = Holding;
+        Record.Origin = NodeIndex.at(Origin);
+        Record.Destination = NodeIndex.at(Destination);
+        Record.Bitrate = BitrateIt - Bitrates.begin();
+        Record.Reserved = 0;
+        Trace.write(Record);
+        }
+
+    return Trace.get_NumRecords();
+}
@@ -0,0 +1,123 @@
+#include <Calls/ConnectionIndex.h>
+#include <RMSA/Route.h>
+#include <Structure/Link.h>
+#include <Structure/Node.h>
+#include <iostream>
+
+ConnectionIndex::ConnectionIndex(unsigned NumLinks, unsigned NumNodes)
+{
+    reset(NumLinks, NumNodes);
+}
+
+void ConnectionIndex::reset(unsigned NumLinks, unsigned NumNodes)
+{
+    this->NumLinks = NumLinks;
+    NumConnections = 0;
+
+    //The storage is kept, as the index is reset between sweep points
+    Lists.resize(NumLinks + NumNodes);
+    for (auto &List : Lists)
+        {
+        List.clear();
+        }
+    for (auto &Calls : Memberships)
+        {
+        Calls.clear();
+        }
+}
+
+void ConnectionIndex::insert(unsigned Call, const RMSA::Route &route)
+{
+#ifdef RUN_ASSERTIONS
+    if (contains(Call))
+        {
+        std::cerr << "Connection is already indexed." << std::endl;
+        abort();
+        }
+#endif
+
+    if (Call >= Memberships.size())
+        {
+        Memberships.resize(Call + 1);
+        }
+
+    for (auto &link : route.Links)
+        {
+        add(link.lock()->Index, Call);
+        }
+    for (auto &node : route.Nodes)
+        {
+        add(NumLinks + node.lock()->Index, Call);
+        }
+
+    NumConnections++;
+}
+
+void ConnectionIndex::erase(unsigned Call)
+{
+    if (!contains(Call))
+        {
+        return;
+        }
+
+    for (auto &Member : Memberships[Call])
+        {
+        //The last entry of the list takes the place of the erased one
+        auto &List = Lists[Member.List];
+        Entry Moved = List.back();
+        List[Member.Position] = Moved;
+        Memberships[Moved.Call][Moved.Membership].Position = Member.Position;
+        List.pop_back();
+        }
+
+    Memberships[Call].clear();
+    NumConnections--;
+}
+
+bool ConnectionIndex::contains(unsigned Call) const
+{
+    return Call < Memberships.size() && !Memberships[Call].empty();
+}
+
+std::vector<unsigned> ConnectionIndex::get_LinkConnections(unsigned LinkIndex) const
+{
+    return get_Connections(LinkIndex);
+}
+
+std::vector<unsigned> ConnectionIndex::get_NodeConnections(unsigned NodeIndex) const
+{
+    return get_Connections(NumLinks + NodeIndex);
+}
+
+void ConnectionIndex::add(unsigned List, unsigned Call)
+{
+#ifdef RUN_ASSERTIONS
+    if (List >= Lists.size())
+        {
+        std::cerr << "Route outside of the indexed topology." << std::endl;
+        abort();
+        }
+#endif
+
+    Entry NewEntry;
+    NewEntry.Call = Call;
+    NewEntry.Membership = Memberships[Call].size();
+
+    Membership NewMembership;
+    NewMembership.List = List;
+    NewMembership.Position = Lists[List].size();
+
+    Lists[List].push_back(NewEntry);
+    Memberships[Call].push_back(NewMembership);
+}
+
+std::vector<unsigned> ConnectionIndex::get_Connections(unsigned List) const
+{
+    std::vector<unsigned> Calls;
+    Calls.reserve(Lists[List].size());
+    for (auto &entry : Lists[List])
+        {
+        Calls.push_back(entry.Call);
+        }
+    return Calls;
+}
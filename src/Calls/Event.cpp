@@ -1,7 +1,7 @@
 #include <Calls/Event.h>
 #include <iostream>
 
-Event::Event(double t, Event_Type Type, std::shared_ptr<Call> Parent) :
+Event::Event(double t, Event_Type Type, unsigned Parent) :
     t(t),
     Type(Type),
     Parent(Parent)
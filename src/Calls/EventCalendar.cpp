@@ -0,0 +1,84 @@
+#include <Calls/EventCalendar.h>
+#include <GeneralClasses/Profiler.h>
+
+EventCalendar::EventCalendar()
+{
+
+}
+
+void EventCalendar::push(const Event &evt)
+{
+    PROFILE_PHASE(EventQueue);
+
+    std::size_t hole = Heap.size();
+    Heap.push_back(evt);
+
+    while (hole > 0)
+        {
+        std::size_t parent = (hole - 1) / Arity;
+        if (!(evt.t < Heap[parent].t))
+            {
+            break;
+            }
+        Heap[hole] = Heap[parent];
+        hole = parent;
+        }
+
+    Heap[hole] = evt;
+}
+
+void EventCalendar::pop()
+{
+    PROFILE_PHASE(EventQueue);
+
+    Event last = Heap.back();
+    Heap.pop_back();
+
+    std::size_t size = Heap.size();
+    if (size == 0)
+        {
+        return;
+        }
+
+    std::size_t hole = 0;
+
+    while (true)
+        {
+        std::size_t firstChild = hole * Arity + 1;
+        if (firstChild >= size)
+            {
+            break;
+            }
+
+        std::size_t lastChild = firstChild + Arity < size ? firstChild + Arity : size;
+        std::size_t minChild = firstChild;
+
+        for (std::size_t child = firstChild + 1; child < lastChild; ++child)
+            {
+            if (Heap[child].t < Heap[minChild].t)
+                {
+                minChild = child;
+                }
+            }
+
+        if (!(Heap[minChild].t < last.t))
+            {
+            break;
+            }
+
+        Heap[hole] = Heap[minChild];
+        hole = minChild;
+        }
+
+    Heap[hole] = last;
+}
+
+void EventCalendar::clear()
+{
+    Heap.clear();
+}
+
+void EventCalendar::reserve(std::size_t n)
+{
+    Heap.reserve(n);
+}
@@ -0,0 +1,149 @@
+#include <GeneralClasses/BatchMeans.h>
+#include <GeneralClasses/BinaryStream.h>
+#include <boost/math/distributions/students_t.hpp>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+BatchMeans::BatchMeans(unsigned long BatchSize, unsigned MaxBatches) :
+    InitialBatchSize(BatchSize), MaxBatches(MaxBatches)
+{
+#ifdef RUN_ASSERTIONS
+    if (BatchSize == 0)
+        {
+        std::cerr << "The batch size must be positive." << std::endl;
+        abort();
+        }
+    if (MaxBatches < 2 || MaxBatches % 2 != 0)
+        {
+        std::cerr << "The maximum number of batches must be even." << std::endl;
+        abort();
+        }
+#endif
+
+    BatchSums.reserve(MaxBatches);
+    reset();
+}
+
+bool BatchMeans::add(double x)
+{
+    NumObservations++;
+    Sum += x;
+
+    CurrentBatchSum += x;
+    if (++CurrentBatchCount < BatchSize)
+        {
+        return false;
+        }
+
+    BatchSums.push_back(CurrentBatchSum);
+    CurrentBatchSum = 0;
+    CurrentBatchCount = 0;
+
+    if (BatchSums.size() == MaxBatches)
+        {
+        for (unsigned b = 0; b < MaxBatches / 2; ++b)
+            {
+            BatchSums[b] = BatchSums[2 * b] + BatchSums[2 * b + 1];
+            }
+        BatchSums.resize(MaxBatches / 2);
+        BatchSize *= 2;
+        }
+
+    return true;
+}
+
+void BatchMeans::reset()
+{
+    BatchSize = InitialBatchSize;
+    NumObservations = 0;
+    Sum = 0;
+    CurrentBatchCount = 0;
+    CurrentBatchSum = 0;
+    BatchSums.clear();
+}
+
+double BatchMeans::get_Mean() const
+{
+    if (NumObservations == 0)
+        {
+        return 0;
+        }
+
+    return Sum / NumObservations;
+}
+
+double BatchMeans::get_HalfWidth(double ConfidenceLevel) const
+{
+#ifdef RUN_ASSERTIONS
+    if (ConfidenceLevel <= 0 || ConfidenceLevel >= 1)
+        {
+        std::cerr << "The confidence level must be in (0, 1)." << std::endl;
+        abort();
+        }
+#endif
+
+    unsigned k = BatchSums.size();
+    if (k < 2)
+        {
+        return std::numeric_limits<double>::infinity();
+        }
+
+    double mean = 0;
+    for (auto &batch : BatchSums)
+        {
+        mean += batch / BatchSize;
+        }
+    mean /= k;
+
+    double variance = 0;
+    for (auto &batch : BatchSums)
+        {
+        variance += std::pow(batch / BatchSize - mean, 2);
+        }
+    variance /= (k - 1);
+
+    boost::math::students_t Distribution(k - 1);
+    double t = boost::math::quantile(Distribution, 0.5 + ConfidenceLevel / 2);
+
+    return t * std::sqrt(variance / k);
+}
+
+unsigned BatchMeans::get_NumBatches() const
+{
+    return BatchSums.size();
+}
+
+unsigned long BatchMeans::get_NumObservations() const
+{
+    return NumObservations;
+}
+
+unsigned long BatchMeans::get_BatchSize() const
+{
+    return BatchSize;
+}
+
+void BatchMeans::save_State(std::ostream &Stream) const
+{
+    BinaryStream::write(Stream, InitialBatchSize);
+    BinaryStream::write(Stream, BatchSize);
+    BinaryStream::write(Stream, MaxBatches);
+    BinaryStream::write(Stream, NumObservations);
+    BinaryStream::write(Stream, Sum);
+    BinaryStream::write(Stream, CurrentBatchCount);
+    BinaryStream::write(Stream, CurrentBatchSum);
+    BinaryStream::write(Stream, BatchSums);
+}
+
+void BatchMeans::load_State(std::istream &Stream)
+{
+    BinaryStream::read(Stream, InitialBatchSize);
+    BinaryStream::read(Stream, BatchSize);
+    BinaryStream::read(Stream, MaxBatches);
+    BinaryStream::read(Stream, NumObservations);
+    BinaryStream::read(Stream, Sum);
+    BinaryStream::read(Stream, CurrentBatchCount);
+    BinaryStream::read(Stream, CurrentBatchSum);
+    BinaryStream::read(Stream, BatchSums);
+}
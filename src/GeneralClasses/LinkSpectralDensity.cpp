@@ -1,53 +1,48 @@
 #include <GeneralClasses/LinkSpectralDensity.h>
-#include <Structure/Link.h>
 #include <Structure/Slot.h>
-#include <GeneralClasses/PhysicalConstants.h>
-#include <GeneralPurposeAlgorithms/IntegrationMethods/TrapezoidalRule.h>
-#include <GeneralClasses/SpectralDensity.h>
+#include <algorithm>
+#include <iostream>
 
-unsigned long LinkSpectralDensity::numFrequencySamples =
-    Slot::samplesPerSlot * Link::NumSlots;
-
-LinkSpectralDensity::LinkSpectralDensity
-(std::vector<std::shared_ptr<Slot>> LinkSlots) : LinkSlots(LinkSlots)
+LinkSpectralDensity::LinkSpectralDensity(unsigned int NumSlots) :
+    DensityScaling(NumSlots, Gain(0, Gain::dB))
 {
-    for(auto& slot : LinkSlots)
-        {
-        S.push_back(slot->S);
-        }
+    Samples.zeros(NumSlots * Slot::samplesPerSlot);
 }
 
-void LinkSpectralDensity::updateLink(SpectralDensity thisSpecDensity,
-                                     std::vector<std::weak_ptr<Slot>> Slots)
+void LinkSpectralDensity::updateLink(const SpectralDensity &thisSpecDensity,
+                                     const std::vector<std::weak_ptr<Slot>> &Slots)
 {
-    unsigned int firstSlot = Slots.front().lock()->numSlot;
-    unsigned int lastSlot = Slots.back().lock()->numSlot;
+    auto Range = std::minmax_element(Slots.begin(), Slots.end(),
+                                     [](const std::weak_ptr<Slot> &l, const std::weak_ptr<Slot> &r)
+        {
+        return l.lock()->numSlot < r.lock()->numSlot;
+        });
+    unsigned int firstSlot = Range.first->lock()->numSlot;
+    unsigned int lastSlot = Range.second->lock()->numSlot;
 
-    unsigned int k = 0;
-    for(unsigned int i = firstSlot; i <= lastSlot; i++)
+    for (unsigned int i = firstSlot; i <= lastSlot; i++)
         {
-        S.at(i)->densityScaling = thisSpecDensity.densityScaling;
-        for(unsigned int j = 0; j < Slot::samplesPerSlot; j++)
-            {
-            S.at(i)->specDensity(j) = thisSpecDensity.specDensity(k);
-            k++;
-            }
-        LinkSlots.at(i)->S = S.at(i);
+        DensityScaling[i] = thisSpecDensity.densityScaling;
         }
+    std::copy(thisSpecDensity.specDensity.memptr(),
+              thisSpecDensity.specDensity.memptr() + (lastSlot - firstSlot + 1) * Slot::samplesPerSlot,
+              get_Samples(firstSlot));
 }
 
 std::shared_ptr<SpectralDensity> LinkSpectralDensity::slice(
-    std::vector<std::weak_ptr<Slot>> usedSlots)
+    const std::vector<std::weak_ptr<Slot>> &usedSlots) const
 {
-    std::sort(usedSlots.begin(), usedSlots.end(),
-              [](const std::weak_ptr<Slot> &l, const std::weak_ptr<Slot> &r)
+    auto Range = std::minmax_element(usedSlots.begin(), usedSlots.end(),
+                                     [](const std::weak_ptr<Slot> &l, const std::weak_ptr<Slot> &r)
         {
         return l.lock()->numSlot < r.lock()->numSlot;
         });
+    std::shared_ptr<Slot> firstSlot = Range.first->lock();
+    std::shared_ptr<Slot> lastSlot = Range.second->lock();
 
     int numSlots = usedSlots.size();
-    double freqMin = usedSlots.front().lock()->S->freqMin;
-    double freqMax = usedSlots.back().lock()->S->freqMax;
+    double freqMin = firstSlot->get_FreqMin();
+    double freqMax = lastSlot->get_FreqMax();
 
 #ifdef RUN_ASSERTIONS
     if (freqMax - freqMin != numSlots * Slot::BSlot)
@@ -59,12 +54,13 @@ std::shared_ptr<SpectralDensity> LinkSpectralDensity::slice(
 
     std::shared_ptr<SpectralDensity> PSD = std::make_shared<SpectralDensity>
                                            (freqMin, freqMax, Slot::samplesPerSlot * numSlots, true);
-
-    for (int s = 0; s < numSlots; s++)
-        {
-        PSD->specDensity.cols(s * Slot::samplesPerSlot, (s + 1) * Slot::samplesPerSlot - 1)
-            = S.at(usedSlots[s].lock()->numSlot)->specDensity;
-        }
+    std::copy(get_Samples(firstSlot->numSlot), get_Samples(lastSlot->numSlot + 1),
+              PSD->specDensity.memptr());
 
     return PSD;
 }
+
+void LinkSpectralDensity::clear_Slot(unsigned int numSlot)
+{
+    std::fill(get_Samples(numSlot), get_Samples(numSlot + 1), 0);
+}
@@ -0,0 +1,86 @@
+#include <GeneralClasses/MetricsStream.h>
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+//Period in which the writer thread looks for new samples
+constexpr std::chrono::milliseconds PollingPeriod(20);
+}
+
+MetricsStream::MetricsStream(std::string FileName, std::size_t Capacity,
+                             bool Append) :
+    Buffer(Capacity), File(FileName, std::ofstream::out |
+                           (Append ? std::ofstream::app : std::ofstream::trunc)),
+    isClosing(false), NumDroppedSamples(0)
+{
+#ifdef RUN_ASSERTIONS
+    if (!File.is_open())
+        {
+        std::cerr << "Metrics file is not open" << std::endl;
+        abort();
+        }
+#endif
+
+    if (!Append)
+        {
+        File << "time,calls,interval_blocking,link_utilisation,active_calls,"
+             "regenerators_in_use" << std::endl;
+        }
+
+    Writer = std::thread(&MetricsStream::write_Samples, this);
+}
+
+MetricsStream::~MetricsStream()
+{
+    isClosing.store(true, std::memory_order_release);
+    Writer.join();
+}
+
+bool MetricsStream::push(const Sample &S)
+{
+    if (!Buffer.push(S))
+        {
+        NumDroppedSamples.fetch_add(1, std::memory_order_relaxed);
+        return false;
+        }
+
+    return true;
+}
+
+unsigned long MetricsStream::get_NumDroppedSamples() const
+{
+    return NumDroppedSamples.load(std::memory_order_relaxed);
+}
+
+void MetricsStream::write_Samples()
+{
+    Sample S;
+
+    while (true)
+        {
+        //Read before draining, so no sample pushed before closing is lost
+        bool isLastRound = isClosing.load(std::memory_order_acquire);
+        bool hasWritten = false;
+
+        while (Buffer.pop(S))
+            {
+            File << S.SimulationTime << "," << S.NumCalls << ","
+                 << S.IntervalBlockingProbability << "," << S.LinkUtilisation << ","
+                 << S.ActiveCalls << "," << S.RegeneratorsInUse << "\n";
+            hasWritten = true;
+            }
+
+        if (hasWritten)
+            {
+            File.flush();
+            }
+
+        if (isLastRound)
+            {
+            break;
+            }
+
+        std::this_thread::sleep_for(PollingPeriod);
+        }
+}
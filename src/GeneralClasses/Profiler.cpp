@@ -0,0 +1,328 @@
+#include <GeneralClasses/Profiler.h>
+#include <boost/assign.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(RUN_PROFILER_PERF) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+Profiler::PhaseNicknameBimap Profiler::PhaseNicknames =
+    boost::assign::list_of<Profiler::PhaseNicknameBimap::relation>
+#define X(a,b,c) (a,c)
+    PROFILER_PHASES
+#undef X
+    ;
+
+Profiler::PhaseNameBimap Profiler::PhaseNames =
+    boost::assign::list_of<Profiler::PhaseNameBimap::relation>
+#define X(a,b,c) (a,b)
+    PROFILER_PHASES
+#undef X
+    ;
+
+namespace
+{
+struct ThreadStatistics
+{
+    Profiler::PhaseStatistics Phases[Profiler::NumPhases];
+};
+
+void clear(Profiler::PhaseStatistics &Statistics)
+{
+    Statistics = Profiler::PhaseStatistics();
+    Statistics.MinTime = std::numeric_limits<uint64_t>::max();
+}
+
+//Statistics of every thread. Never freed, so they outlive their threads.
+std::mutex RegistryMutex;
+std::vector<std::unique_ptr<ThreadStatistics>> Registry;
+thread_local ThreadStatistics *LocalStatistics = nullptr;
+
+ThreadStatistics &get_LocalStatistics()
+{
+    if (LocalStatistics == nullptr)
+        {
+        std::unique_ptr<ThreadStatistics> Statistics(new ThreadStatistics());
+        for (auto &phase : Statistics->Phases)
+            {
+            clear(phase);
+            }
+
+        std::lock_guard<std::mutex> Lock(RegistryMutex);
+        LocalStatistics = Statistics.get();
+        Registry.push_back(std::move(Statistics));
+        }
+
+    return *LocalStatistics;
+}
+
+#if defined(RUN_PROFILER_PERF) && defined(__linux__)
+//File descriptor of the group leader. -2 if not opened yet, -1 if unavailable.
+thread_local int PerfGroup = -2;
+
+int open_PerfGroup()
+{
+    const uint64_t Configs[Profiler::NumHardwareCounters] =
+        {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES
+        };
+
+    int Leader = -1;
+    for (unsigned c = 0; c < Profiler::NumHardwareCounters; c++)
+        {
+        perf_event_attr Attributes = perf_event_attr();
+        Attributes.type = PERF_TYPE_HARDWARE;
+        Attributes.size = sizeof(perf_event_attr);
+        Attributes.config = Configs[c];
+        Attributes.disabled = (Leader == -1);
+        Attributes.exclude_kernel = 1;
+        Attributes.exclude_hv = 1;
+        Attributes.read_format = PERF_FORMAT_GROUP;
+
+        int fd = syscall(__NR_perf_event_open, &Attributes, 0, -1, Leader, 0);
+        if (fd == -1)
+            {
+            static std::once_flag Warning;
+            std::call_once(Warning, []()
+                {
+                std::cerr << "Hardware counters are not available." << std::endl;
+                });
+            if (Leader != -1)
+                {
+                close(Leader);
+                }
+            return -1;
+            }
+
+        if (Leader == -1)
+            {
+            Leader = fd;
+            }
+        }
+
+    ioctl(Leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(Leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return Leader;
+}
+#endif
+}
+
+bool Profiler::read_HardwareCounters(uint64_t Counters[NumHardwareCounters])
+{
+#if defined(RUN_PROFILER_PERF) && defined(__linux__)
+    if (PerfGroup == -2)
+        {
+        PerfGroup = open_PerfGroup();
+        }
+
+    if (PerfGroup == -1)
+        {
+        return false;
+        }
+
+    struct
+    {
+        uint64_t NumCounters;
+        uint64_t Values[NumHardwareCounters];
+    } Group;
+
+    if (read(PerfGroup, &Group, sizeof(Group)) != (ssize_t) sizeof(Group))
+        {
+        return false;
+        }
+
+    std::copy(Group.Values, Group.Values + NumHardwareCounters, Counters);
+    return true;
+#else
+    (void) Counters;
+    return false;
+#endif
+}
+
+Profiler::ScopedTimer::ScopedTimer(Phase P) : P(P)
+{
+#ifdef RUN_PROFILER_PERF
+    if (!read_HardwareCounters(StartCounters))
+        {
+        StartCounters[0] = std::numeric_limits<uint64_t>::max();
+        }
+#endif
+    Start = std::chrono::steady_clock::now();
+}
+
+Profiler::ScopedTimer::~ScopedTimer()
+{
+    auto End = std::chrono::steady_clock::now();
+    uint64_t Time = std::chrono::duration_cast<std::chrono::nanoseconds>
+                    (End - Start).count();
+
+#ifdef RUN_PROFILER_PERF
+    uint64_t EndCounters[NumHardwareCounters];
+    if (StartCounters[0] != std::numeric_limits<uint64_t>::max() &&
+            read_HardwareCounters(EndCounters))
+        {
+        for (unsigned c = 0; c < NumHardwareCounters; c++)
+            {
+            EndCounters[c] -= StartCounters[c];
+            }
+        record(P, Time, EndCounters);
+        return;
+        }
+#endif
+
+    record(P, Time);
+}
+
+unsigned Profiler::get_Bucket(uint64_t Time)
+{
+    if (Time == 0)
+        {
+        return 0;
+        }
+
+    unsigned Bucket = 64 - __builtin_clzll(Time);
+    return std::min(Bucket, NumBuckets - 1);
+}
+
+void Profiler::record(Phase P, uint64_t Time, const uint64_t *Counters)
+{
+    PhaseStatistics &Statistics = get_LocalStatistics().Phases[P];
+
+    Statistics.Count++;
+    Statistics.TotalTime += Time;
+    Statistics.MinTime = std::min(Statistics.MinTime, Time);
+    Statistics.MaxTime = std::max(Statistics.MaxTime, Time);
+    Statistics.Histogram[get_Bucket(Time)]++;
+
+    if (Counters != nullptr)
+        {
+        for (unsigned c = 0; c < NumHardwareCounters; c++)
+            {
+            Statistics.HardwareCounters[c] += Counters[c];
+            }
+        }
+}
+
+Profiler::PhaseStatistics Profiler::get_Statistics(Phase P)
+{
+    PhaseStatistics Merged;
+    clear(Merged);
+
+    std::lock_guard<std::mutex> Lock(RegistryMutex);
+    for (auto &Thread : Registry)
+        {
+        PhaseStatistics &Statistics = Thread->Phases[P];
+
+        Merged.Count += Statistics.Count;
+        Merged.TotalTime += Statistics.TotalTime;
+        Merged.MinTime = std::min(Merged.MinTime, Statistics.MinTime);
+        Merged.MaxTime = std::max(Merged.MaxTime, Statistics.MaxTime);
+        for (unsigned b = 0; b < NumBuckets; b++)
+            {
+            Merged.Histogram[b] += Statistics.Histogram[b];
+            }
+        for (unsigned c = 0; c < NumHardwareCounters; c++)
+            {
+            Merged.HardwareCounters[c] += Statistics.HardwareCounters[c];
+            }
+        }
+
+    return Merged;
+}
+
+void Profiler::reset()
+{
+    std::lock_guard<std::mutex> Lock(RegistryMutex);
+    for (auto &Thread : Registry)
+        {
+        for (auto &phase : Thread->Phases)
+            {
+            clear(phase);
+            }
+        }
+}
+
+void Profiler::dump_JSON(std::string FileName)
+{
+    std::ofstream JSONFile(FileName, std::ofstream::out | std::ofstream::trunc);
+
+#ifdef RUN_ASSERTIONS
+    if (!JSONFile.is_open())
+        {
+        std::cerr << "Output file is not open" << std::endl;
+        abort();
+        }
+#endif
+
+    const char *CounterNames[NumHardwareCounters] =
+        {
+#define X(a,b) b,
+        PROFILER_HARDWARE_COUNTERS
+#undef X
+        };
+
+    JSONFile << "{" << std::endl << "  \"phases\": [";
+
+    for (unsigned p = 0; p < NumPhases; p++)
+        {
+        PhaseStatistics Statistics = get_Statistics((Phase) p);
+
+        JSONFile << (p == 0 ? "" : ",") << std::endl << "    {" << std::endl;
+        JSONFile << "      \"phase\": \"" << PhaseNicknames.left.at((Phase) p) << "\","
+                 << std::endl;
+        JSONFile << "      \"name\": \"" << PhaseNames.left.at((Phase) p) << "\","
+                 << std::endl;
+        JSONFile << "      \"count\": " << Statistics.Count << "," << std::endl;
+        JSONFile << "      \"total_ns\": " << Statistics.TotalTime << "," << std::endl;
+        JSONFile << "      \"mean_ns\": " << (Statistics.Count == 0 ? 0 :
+                 (double) Statistics.TotalTime / Statistics.Count) << "," << std::endl;
+        JSONFile << "      \"min_ns\": " << (Statistics.Count == 0 ? 0 :
+                 Statistics.MinTime) << "," << std::endl;
+        JSONFile << "      \"max_ns\": " << Statistics.MaxTime << "," << std::endl;
+
+        JSONFile << "      \"hardware_counters\": {";
+        for (unsigned c = 0; c < NumHardwareCounters; c++)
+            {
+            JSONFile << (c == 0 ? "" : ", ") << "\"" << CounterNames[c] << "\": "
+                     << Statistics.HardwareCounters[c];
+            }
+        JSONFile << "}," << std::endl;
+
+        //Bucket b counts the occurrences shorter than 2^b ns
+        JSONFile << "      \"histogram\": [";
+        bool isFirst = true;
+        for (unsigned b = 0; b < NumBuckets; b++)
+            {
+            if (Statistics.Histogram[b] == 0)
+                {
+                continue;
+                }
+            JSONFile << (isFirst ? "" : ", ") << "{\"below_ns\": ";
+            if (b == NumBuckets - 1)
+                {
+                JSONFile << "null";
+                }
+            else
+                {
+                JSONFile << (1ULL << b);
+                }
+            JSONFile << ", \"count\": " << Statistics.Histogram[b] << "}";
+            isFirst = false;
+            }
+        JSONFile << "]" << std::endl << "    }";
+        }
+
+    JSONFile << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
@@ -0,0 +1,76 @@
+#include <GeneralClasses/RandomGenerator.h>
+
+uint64_t RandomGenerator::MasterSeed = 0;
+
+RandomGenerator random_generator(0, 0, RandomGenerator::OptimizerStream);
+
+RandomGenerator::RandomGenerator(uint32_t SweepPoint, uint32_t Replication,
+                                 Substream Sub, uint64_t Seed)
+{
+    //Different substreams use different keys
+    Key[0] = (uint32_t) Seed;
+    Key[1] = (uint32_t)(Seed >> 32) ^ (uint32_t)(Sub * 0x9E3779B9U);
+
+    StreamID[0] = SweepPoint;
+    StreamID[1] = Replication;
+
+    set_Position(0);
+}
+
+void RandomGenerator::philox(uint32_t Counter[4], const uint32_t Key[2])
+{
+    const uint32_t M0 = 0xD2511F53U, M1 = 0xCD9E8D57U;
+    const uint32_t W0 = 0x9E3779B9U, W1 = 0xBB67AE85U;
+
+    uint32_t k0 = Key[0], k1 = Key[1];
+
+    for (unsigned round = 0; round < 10; ++round)
+        {
+        uint64_t p0 = (uint64_t) M0 * Counter[0];
+        uint64_t p1 = (uint64_t) M1 * Counter[2];
+
+        uint32_t c0 = (uint32_t)(p1 >> 32) ^ Counter[1] ^ k0;
+        uint32_t c1 = (uint32_t) p1;
+        uint32_t c2 = (uint32_t)(p0 >> 32) ^ Counter[3] ^ k1;
+        uint32_t c3 = (uint32_t) p0;
+
+        Counter[0] = c0;
+        Counter[1] = c1;
+        Counter[2] = c2;
+        Counter[3] = c3;
+
+        k0 += W0;
+        k1 += W1;
+        }
+}
+
+void RandomGenerator::generate_Block()
+{
+    Output[0] = (uint32_t) Block;
+    Output[1] = (uint32_t)(Block >> 32);
+    Output[2] = StreamID[0];
+    Output[3] = StreamID[1];
+
+    philox(Output, Key);
+
+    Block++;
+    Index = 0;
+}
+
+void RandomGenerator::discard(uint64_t n)
+{
+    set_Position(get_Position() + n);
+}
+
+uint64_t RandomGenerator::get_Position() const
+{
+    //Block points to the next block to be generated
+    return 4 * Block - (4 - Index);
+}
+
+void RandomGenerator::set_Position(uint64_t n)
+{
+    Block = n / 4;
+    generate_Block();
+    Index = n % 4;
+}
@@ -24,8 +24,8 @@ Signal::Signal(mapSlots occupiedSlots) : occupiedSlots(occupiedSlots),
             });
 
         numSlots = occupiedSlots.begin()->second.size();
-        freqMin = occupiedSlots.begin()->second.front().lock()->S->freqMin;
-        freqMax = occupiedSlots.begin()->second.back().lock()->S->freqMax;
+        freqMin = occupiedSlots.begin()->second.front().lock()->get_FreqMin();
+        freqMax = occupiedSlots.begin()->second.back().lock()->get_FreqMax();
         if (considerFilterImperfection)
             {
             signalSpecDensity = std::make_shared<SpectralDensity>(freqMin, freqMax,
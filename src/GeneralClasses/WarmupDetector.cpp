@@ -0,0 +1,150 @@
+#include <GeneralClasses/WarmupDetector.h>
+#include <GeneralClasses/BinaryStream.h>
+#include <iostream>
+#include <limits>
+
+WarmupDetector::WarmupDetector(unsigned BatchSize, unsigned MinNumBatches) :
+    BatchSize(BatchSize), MinNumBatches(MinNumBatches)
+{
+#ifdef RUN_ASSERTIONS
+    if (BatchSize == 0 || MinNumBatches < 2)
+        {
+        std::cerr << "Invalid warm-up detector parameters." << std::endl;
+        abort();
+        }
+#endif
+
+    reset();
+}
+
+bool WarmupDetector::add(double x)
+{
+    if (detected)
+        {
+        return false;
+        }
+
+    NumObservations++;
+    CurrentBatchSum += x;
+
+    if (++CurrentBatchCount < BatchSize)
+        {
+        return false;
+        }
+
+    Batches.push_back(CurrentBatchSum / BatchSize);
+    CurrentBatchSum = 0;
+    CurrentBatchCount = 0;
+
+    if (Batches.size() < NextCheck)
+        {
+        return false;
+        }
+
+    NextCheck *= 2;
+    return evaluate();
+}
+
+bool WarmupDetector::evaluate()
+{
+    unsigned long m = Batches.size();
+
+    //Suffix sums of the batch means and of their squares
+    double Sum = 0, SumSquares = 0;
+    for (unsigned long j = m / 2; j < m; ++j)
+        {
+        Sum += Batches[j];
+        SumSquares += Batches[j] * Batches[j];
+        }
+
+    double MinMSER = std::numeric_limits<double>::max();
+    unsigned long Truncation = m / 2;
+
+    for (long d = m / 2; d >= 0; --d)
+        {
+        if (d != (long) m / 2)
+            {
+            Sum += Batches[d];
+            SumSquares += Batches[d] * Batches[d];
+            }
+
+        double n = m - d;
+        double MSER = (SumSquares - Sum * Sum / n) / (n * n);
+
+        if (MSER <= MinMSER)
+            {
+            MinMSER = MSER;
+            Truncation = d;
+            }
+        }
+
+    if (Truncation >= m / 2)
+        {
+        return false;
+        }
+
+    detected = true;
+    TruncationPoint = Truncation * BatchSize;
+    Batches.clear();
+    Batches.shrink_to_fit();
+    return true;
+}
+
+void WarmupDetector::force()
+{
+    detected = true;
+    TruncationPoint = NumObservations;
+    Batches.clear();
+    Batches.shrink_to_fit();
+}
+
+void WarmupDetector::reset()
+{
+    detected = false;
+    NumObservations = TruncationPoint = 0;
+    NextCheck = MinNumBatches;
+    CurrentBatchCount = 0;
+    CurrentBatchSum = 0;
+    Batches.clear();
+}
+
+bool WarmupDetector::hasDetected() const
+{
+    return detected;
+}
+
+unsigned long WarmupDetector::get_TruncationPoint() const
+{
+    return TruncationPoint;
+}
+
+unsigned long WarmupDetector::get_NumObservations() const
+{
+    return NumObservations;
+}
+
+void WarmupDetector::save_State(std::ostream &Stream) const
+{
+    BinaryStream::write(Stream, BatchSize);
+    BinaryStream::write(Stream, MinNumBatches);
+    BinaryStream::write(Stream, detected);
+    BinaryStream::write(Stream, NumObservations);
+    BinaryStream::write(Stream, TruncationPoint);
+    BinaryStream::write(Stream, NextCheck);
+    BinaryStream::write(Stream, CurrentBatchCount);
+    BinaryStream::write(Stream, CurrentBatchSum);
+    BinaryStream::write(Stream, Batches);
+}
+
+void WarmupDetector::load_State(std::istream &Stream)
+{
+    BinaryStream::read(Stream, BatchSize);
+    BinaryStream::read(Stream, MinNumBatches);
+    BinaryStream::read(Stream, detected);
+    BinaryStream::read(Stream, NumObservations);
+    BinaryStream::read(Stream, TruncationPoint);
+    BinaryStream::read(Stream, NextCheck);
+    BinaryStream::read(Stream, CurrentBatchCount);
+    BinaryStream::read(Stream, CurrentBatchSum);
+    BinaryStream::read(Stream, Batches);
+}
@@ -3,7 +3,6 @@
 #include <Calls/CallGenerator.h>
 #include <RMSA/RoutingWavelengthAssignment.h>
 #include <Structure/Topology.h>
-#include <GeneralClasses/RandomGenerator.h>
 
 using namespace RMSA::RP;
 
@@ -87,7 +86,7 @@ void MostUsed::placeRegenerators(unsigned N, unsigned X)
         std::uniform_int_distribution<int> dist(0, MaximalNodes.size() - 1);
 
         auto ChosenNode = MaximalNodes.begin();
-        std::advance(ChosenNode, dist(random_generator));
+        std::advance(ChosenNode, dist(Stream));
         (*ChosenNode)->set_NumRegenerators(X);
         (*ChosenNode)->set_NodeType(Node::TranslucentNode);
 
@@ -20,7 +20,7 @@ double NSGA2_Parameter_BlockingProbability::evaluate()
 {
     if (!isEvaluated)
         {
-        std::shared_ptr<Topology> T(new Topology(*Sim.T));
+        std::shared_ptr<Topology> T = Sim.Replicas->acquire();
 
         for (size_t i = 0; i < gene.size(); i++)
             {
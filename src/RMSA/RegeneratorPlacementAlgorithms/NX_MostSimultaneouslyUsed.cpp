@@ -4,7 +4,6 @@
 #include <Structure/Topology.h>
 #include <Calls/CallGenerator.h>
 #include <SimulationTypes/NetworkSimulation.h>
-#include <GeneralClasses/RandomGenerator.h>
 
 using namespace RMSA::RP;
 
@@ -85,7 +84,7 @@ void NX_MostSimultaneouslyUsed::placeRegenerators(unsigned N, unsigned X)
         std::uniform_int_distribution<int> dist(0, MaximalNodes.size() - 1);
 
         auto ChosenNode = MaximalNodes.begin();
-        std::advance(ChosenNode, dist(random_generator));
+        std::advance(ChosenNode, dist(Stream));
         (*ChosenNode)->set_NumRegenerators(X);
         (*ChosenNode)->set_NodeType(Node::TranslucentNode);
 
@@ -1,6 +1,5 @@
 #include <RMSA/RegeneratorPlacementAlgorithms/NodalDegreeFirst.h>
 #include <random>
-#include <GeneralClasses/RandomGenerator.h>
 #include <Structure/Topology.h>
 
 using namespace RMSA::RP;
@@ -24,7 +24,8 @@ RegeneratorPlacementAlgorithm::RegeneratorPlacementNicknames =
     ;
 
 RegeneratorPlacementAlgorithm::RegeneratorPlacementAlgorithm(
-    std::shared_ptr<Topology> T) : isNXAlgorithm(false), T(T)
+    std::shared_ptr<Topology> T) : isNXAlgorithm(false), T(T),
+    Stream(0, 0, RandomGenerator::RegeneratorPlacementStream)
 {
 
 }
@@ -17,11 +17,12 @@ SQP_NetworkSimulation::SQP_NetworkSimulation(std::shared_ptr<CallGenerator>
     NodeUsage = std::vector<long int>(RMSA->T->Nodes.size() + 1, 0);
 }
 
-void SQP_NetworkSimulation::implement_call(std::shared_ptr<Event> evt)
+void SQP_NetworkSimulation::implement_call(const Event &evt)
 {
     NetworkSimulation::implement_call(evt);
 
-    auto Links = RMSA->R_Alg->route(evt->Parent).front();
+    std::shared_ptr<Call> C = Generator->get_Call(evt.Parent);
+    auto Links = RMSA->R_Alg->route(C).front();
     if (Links.empty())
         {
         return;
@@ -32,7 +33,7 @@ void SQP_NetworkSimulation::implement_call(std::shared_ptr<Event> evt)
     for (auto scheme = ModulationScheme::DefaultSchemes.rbegin();
             scheme != ModulationScheme::DefaultSchemes.rend(); ++scheme)
         {
-        LNMax = SQP->get_LNMax(evt->Parent->Bitrate, *scheme);
+        LNMax = SQP->get_LNMax(C->Bitrate, *scheme);
         if (LNMax != 0)
             {
             break;
@@ -91,26 +92,3 @@ void SQP_NetworkSimulation::implement_call(std::shared_ptr<Event> evt)
         }
 
 }
-
-void SQP_NetworkSimulation::run()
-{
-    NumCalls++;
-    Generator->generate_Call(); //Generates first call
-
-    while (!Generator->Events.empty())
-        {
-        std::shared_ptr<Event> evt(Generator->Events.top());
-        Generator->Events.pop();
-
-        if (evt->Type == Event::CallRequisition)
-            {
-            implement_call(evt);
-            }
-        else if (evt->Type == Event::CallEnding)
-            {
-            drop_call(evt);
-            }
-        }
-
-    hasSimulated = true;
-}
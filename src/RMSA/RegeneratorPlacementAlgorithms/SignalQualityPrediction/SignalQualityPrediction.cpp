@@ -5,7 +5,6 @@
 #include <RMSA/RoutingAlgorithms/RoutingAlgorithm.h>
 #include <RMSA/SpectrumAssignmentAlgorithms/FirstFit.h>
 #include <RMSA/RoutingWavelengthAssignment.h>
-#include <GeneralClasses/RandomGenerator.h>
 #include <Structure/Link.h>
 #include <Calls.h>
 #include <boost/assign.hpp>
@@ -130,7 +129,7 @@ void SignalQualityPrediction::placeRegenerators(unsigned N, unsigned X)
         std::uniform_int_distribution<int> dist(0, MaximalNodes.size() - 1);
 
         auto ChosenNode = MaximalNodes.begin();
-        std::advance(ChosenNode, dist(random_generator));
+        std::advance(ChosenNode, dist(Stream));
         (*ChosenNode)->set_NumRegenerators(X);
         (*ChosenNode)->set_NodeType(Node::TranslucentNode);
 
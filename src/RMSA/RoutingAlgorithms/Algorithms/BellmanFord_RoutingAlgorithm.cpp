@@ -1,8 +1,10 @@
 #include "include/RMSA/RoutingAlgorithms/Algorithms/BellmanFord_RoutingAlgorithm.h"
 #include "include/Structure/Node.h"
 #include "include/Structure/Link.h"
+#include "include/Structure/RoutingGraph.h"
 #include "include/Structure/Topology.h"
 #include "include/Calls/Call.h"
+#include <algorithm>
 
 using namespace RMSA::ROUT;
 
@@ -26,49 +28,53 @@ void BellmanFord_RoutingAlgorithm::print()
 std::vector<std::vector<std::weak_ptr<Link>>>
 BellmanFord_RoutingAlgorithm::route(std::shared_ptr<Call> C)
 {
-    /** Attention: this code breaks if there are nodes in the Topology with the
-     * same ID. This should not happen. The nodes must have sequential ID. **/
+    const RoutingGraph &G = T->get_RoutingGraph();
 
-    std::vector<double> MinDistance(T->Nodes.size() + 1,
+    std::vector<double> MinDistance(G.NumNodes,
                                     std::numeric_limits<double>::max());
-    std::set<std::pair<int, std::shared_ptr<Node>>> ActiveVertices;
-    std::vector<int> Precedent(T->Nodes.size() + 1, -1);
+    std::set<std::pair<int, unsigned int>> ActiveVertices;
+    std::vector<int> Precedent(G.NumNodes, -1); //Index of the link to the node
 
-    MinDistance[C->Origin.lock()->ID] = 0;
+    unsigned int Origin = C->Origin.lock()->Index;
+    unsigned int Destination = C->Destination.lock()->Index;
+
+    MinDistance[Origin] = 0;
 
     bool hasChanged;
-    for (size_t iter = 0; iter < T->Nodes.size(); ++iter)
+    for (size_t iter = 0; iter < G.NumNodes; ++iter)
         {
         hasChanged = false;
         ActiveVertices.clear();
-        for (size_t node = 0; node < T->Nodes.size(); ++node)
+        for (unsigned int node = 0; node < G.NumNodes; ++node)
             {
-            ActiveVertices.insert({MinDistance[node], T->Nodes[node]});
+            ActiveVertices.insert({MinDistance[node], node});
             }
 
         while (!ActiveVertices.empty())
             {
-            std::shared_ptr<Node> CurrentNode = ActiveVertices.begin()->second;
+            unsigned int CurrentNode = ActiveVertices.begin()->second;
             ActiveVertices.erase(ActiveVertices.begin());
 
-            for (auto &node : CurrentNode->Neighbours)
+            for (unsigned int e = G.FirstEdge[CurrentNode];
+                    e < G.FirstEdge[CurrentNode + 1]; ++e)
                 {
-                if (!node.lock()->is_NodeActive())
+                unsigned int node = G.EdgeTarget[e];
+
+                if (!G.is_NodeActive(node))
                     {
                     continue;
                     }
 
-                auto locknode = node.lock();
-                double newLength = MinDistance[CurrentNode->ID] +
-                                   RCost->get_Cost(T->Links.at({CurrentNode->ID, locknode->ID}), C);
+                double newLength = MinDistance[CurrentNode] +
+                                   RCost->get_Cost(G, G.EdgeLink[e], C);
 
-                if (MinDistance[locknode->ID] > newLength)
+                if (MinDistance[node] > newLength)
                     {
                     hasChanged = true;
-                    ActiveVertices.erase({MinDistance[locknode->ID], locknode});
-                    MinDistance[locknode->ID] = newLength;
-                    ActiveVertices.insert({newLength, locknode});
-                    Precedent[locknode->ID] = CurrentNode->ID;
+                    ActiveVertices.erase({MinDistance[node], node});
+                    MinDistance[node] = newLength;
+                    ActiveVertices.insert({newLength, node});
+                    Precedent[node] = G.EdgeLink[e];
                     }
                 }
             }
@@ -79,46 +85,25 @@ BellmanFord_RoutingAlgorithm::route(std::shared_ptr<Call> C)
             }
         }
 
-    std::vector<int> NodesInRoute;
     std::vector<std::weak_ptr<Link>> RouteLinks;
 
-    int CurrentNode = C->Destination.lock()->ID;
-    NodesInRoute.push_back(CurrentNode);
-
-    if (Precedent[CurrentNode] == -1)
-        {
-        RouteLinks.clear();
-        return {RouteLinks};
-        }
+    unsigned int CurrentNode = Destination;
 
     while (Precedent[CurrentNode] != -1)
         {
-        NodesInRoute.push_back(Precedent[CurrentNode]);
-
-            {
-            int CurNode = Precedent[CurrentNode];
-            Precedent[CurrentNode] = -1;
-            CurrentNode = CurNode;
-            } //Avoiding negative cost loops
-
-        if (CurrentNode == -1)
-            {
-            RouteLinks.clear(); //Could not find route. Returns empty vector.
-            return {RouteLinks};
-            }
+        int CurLink = Precedent[CurrentNode];
+        Precedent[CurrentNode] = -1; //Avoiding negative cost loops
+        RouteLinks.push_back(G.Links[CurLink]);
+        CurrentNode = G.LinkOrigin[CurLink];
         }
 
-    for (int i = NodesInRoute.size() - 1; i > 0; i--)
-        {
-        RouteLinks.push_back(T->Links.at({NodesInRoute[i], NodesInRoute[i - 1]}));
-        }
+    std::reverse(RouteLinks.begin(), RouteLinks.end());
 
     //Checks whether the route is correct
     //Usually it just isn't when there's a negative cost loop.
-    if ((RouteLinks.front().lock()->Origin.lock()->ID != C->Origin.lock()->ID) ||
-            (RouteLinks.back().lock()->Destination.lock()->ID != C->Destination.lock()->ID))
+    if (CurrentNode != Origin)
         {
-        RouteLinks.clear();
+        RouteLinks.clear(); //Could not find route. Returns empty vector.
         }
 
     return {RouteLinks};
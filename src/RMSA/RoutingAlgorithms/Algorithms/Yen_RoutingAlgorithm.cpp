@@ -1,25 +1,36 @@
 #include "include/RMSA/RoutingAlgorithms/Algorithms/Yen_RoutingAlgorithm.h"
+#include "include/RMSA/RoutingAlgorithms/ShortestPathSearch.h"
 #include "include/Structure/Node.h"
 #include "include/Structure/Link.h"
+#include "include/Structure/RoutingGraph.h"
 #include "include/Structure/Topology.h"
 #include "Calls/Call.h"
+#include <algorithm>
 #include <iostream>
+#include <limits>
+
+namespace Simulations
+{
+extern bool parallelism_enabled;
+}
 
 using namespace RMSA::ROUT;
 unsigned int Yen_RoutingAlgorithm::kShortestPaths = 1;
 bool Yen_RoutingAlgorithm::hasLoaded = false;
+bool Yen_RoutingAlgorithm::useRouteTable = true;
 
 Yen_RoutingAlgorithm::Yen_RoutingAlgorithm(std::shared_ptr<Topology> T,
-        RoutingCost::RoutingCosts Cost, bool runLoad) :
-    RoutingAlgorithm(T, yen, Cost, runLoad)
+        RoutingCost::RoutingCosts Cost, bool runLoad, unsigned int k) :
+    RoutingAlgorithm(T, yen, Cost, runLoad), k(k)
 {
-    Dijkstra = create_RoutingAlgorithm(dijkstra, Cost, T);
+
 }
 
 void Yen_RoutingAlgorithm::load()
 {
     if (hasLoaded)
         {
+        k = kShortestPaths;
         return;
         }
     hasLoaded = true;
@@ -46,6 +57,8 @@ void Yen_RoutingAlgorithm::load()
             }
         }
     while (1);
+
+    k = kShortestPaths;
 }
 
 void Yen_RoutingAlgorithm::save(std::string name)
@@ -61,90 +74,184 @@ void Yen_RoutingAlgorithm::print()
 std::vector<std::vector<std::weak_ptr<Link>>>
 Yen_RoutingAlgorithm::route(std::shared_ptr<Call> C)
 {
-    if (!hasLoaded)
+    std::vector<std::vector<std::weak_ptr<Link>>> RouteLinks;
+
+    if (useRouteTable && RCost->isStatic())
         {
-        load();
+        if (!Table || Table->k != k)
+            {
+            Table = RouteTable::get_RouteTable(T, Cost, k);
+            }
+
+        if (route_FromTable(C, RouteLinks))
+            {
+            return RouteLinks;
+            }
         }
 
-    std::vector<std::vector<std::weak_ptr<Link>>> RouteLinks;
-    RouteLinks.push_back(Dijkstra->route(C).back());
+    return search(C);
+}
 
-    while (RouteLinks.size() < kShortestPaths)
+std::vector<std::vector<std::weak_ptr<Link>>>
+Yen_RoutingAlgorithm::search(std::shared_ptr<Call> C)
+{
+    const RoutingGraph &G = T->get_RoutingGraph();
+    unsigned int Origin = C->Origin.lock()->Index;
+    unsigned int Destination = C->Destination.lock()->Index;
+
+    //Evaluated once, so that the spur paths can be searched concurrently
+    std::vector<double> Costs(G.NumLinks);
+    for (unsigned int l = 0; l < G.NumLinks; l++)
         {
-        bool foundRoute = false;
+        Costs[l] = RCost->get_Cost(G, l, C);
+        }
 
-        auto lastShortRoute = RouteLinks.back();
-        auto currShortestRoute = RouteLinks.back();
-        double minRouteCost = std::numeric_limits<double>::max();
+    std::vector<std::vector<unsigned int>> Paths;
+    Paths.push_back(find_ShortestPath(G, Costs, std::vector<bool>(G.NumNodes, false),
+                                      std::vector<bool>(G.NumLinks, false), Origin, Destination));
 
-        for (size_t n = 0; n < lastShortRoute.size(); ++n)
-            {
-            auto spurNode = lastShortRoute[n].lock()->Origin;
-            auto rootPath = std::vector<std::weak_ptr<Link>>(lastShortRoute.begin(),
-                            lastShortRoute.begin() + n);
+    //Candidates to the next shortest path, with their costs
+    std::vector<std::pair<double, std::vector<unsigned int>>> Candidates;
 
-            std::vector<std::weak_ptr<Node>> deactivatedNodes;
-            std::vector<std::weak_ptr<Link>> deactivatedLinks;
+    while (!Paths.back().empty() && Paths.size() < k)
+        {
+        const std::vector<unsigned int> LastPath = Paths.back();
+        std::vector<std::vector<unsigned int>> SpurPaths(LastPath.size());
 
-            //Deactives some nodes and links
-            for (auto &link : rootPath)
+        #pragma omp parallel for schedule(dynamic) \
+        if(Simulations::parallelism_enabled && \
+           LastPath.size() * G.NumLinks >= MinParallelWork)
+        for (unsigned int n = 0; n < LastPath.size(); n++)
+            {
+            std::vector<bool> MaskedNodes(G.NumNodes, false);
+            std::vector<bool> MaskedLinks(G.NumLinks, false);
+
+            //The spur path can not return to the root path, nor leave the spur
+            //node as a shortest path with the same root already did
+            for (unsigned int link = 0; link < n; link++)
                 {
-                link.lock()->Origin.lock()->set_NodeInactive();
-                deactivatedNodes.push_back(link.lock()->Origin);
+                MaskedNodes[G.LinkOrigin[LastPath[link]]] = true;
                 }
-            for (auto &previousRoutes : RouteLinks)
+            for (auto &path : Paths)
                 {
-                if (previousRoutes.size() < n)
-                    {
-                    continue;
-                    }
-
-                bool shareRoot = true;
-                for (unsigned link = 0; (link < n) && shareRoot; ++link)
-                    {
-                    shareRoot &= (rootPath[link].lock() == previousRoutes[link].lock());
-                    }
-                if (shareRoot)
+                if (path.size() > n &&
+                        std::equal(path.begin(), path.begin() + n, LastPath.begin()))
                     {
-                    previousRoutes[n].lock()->set_LinkInactive();
-                    deactivatedLinks.push_back(previousRoutes[n]);
+                    MaskedLinks[path[n]] = true;
                     }
                 }
 
-            auto dummyC = std::make_shared<Call>(spurNode, C->Destination, C->Bitrate, C->Scheme);
-            auto alternativeRoute = Dijkstra->route(dummyC).front();
+            SpurPaths[n] = find_ShortestPath(G, Costs, MaskedNodes, MaskedLinks,
+                                             G.LinkOrigin[LastPath[n]], Destination);
+            }
 
-            if (!alternativeRoute.empty())
+        for (unsigned int n = 0; n < LastPath.size(); n++)
+            {
+            if (SpurPaths[n].empty())
                 {
-                foundRoute = true;
-                auto testRoute = rootPath;
-                testRoute.insert(testRoute.end(), alternativeRoute.begin(),
-                                 alternativeRoute.end());
-                double routeCost = get_RoutingCost(testRoute, C);
-                if (routeCost < minRouteCost)
-                    {
-                    minRouteCost = routeCost;
-                    currShortestRoute = testRoute;
-                    }
+                continue;
                 }
 
-            //Reactivates nodes and links
-            for (auto &node : deactivatedNodes)
+            std::vector<unsigned int> Path(LastPath.begin(), LastPath.begin() + n);
+            Path.insert(Path.end(), SpurPaths[n].begin(), SpurPaths[n].end());
+
+            bool isNew = std::find(Paths.begin(), Paths.end(), Path) == Paths.end();
+            for (auto &candidate : Candidates)
                 {
-                node.lock()->set_NodeActive();
+                isNew &= (candidate.second != Path);
                 }
-            for (auto &link : deactivatedLinks)
+
+            if (isNew)
                 {
-                link.lock()->set_LinkActive();
+                double PathCost = 0;
+                for (auto l : Path)
+                    {
+                    PathCost += Costs[l];
+                    }
+                Candidates.push_back({PathCost, std::move(Path)});
                 }
-
             }
-        if (!foundRoute)
+
+        if (Candidates.empty())
             {
             break;
             }
-        RouteLinks.push_back(currShortestRoute);
+
+        auto Shortest = Candidates.begin();
+        for (auto candidate = Candidates.begin(); candidate != Candidates.end(); ++candidate)
+            {
+            if (candidate->first < Shortest->first)
+                {
+                Shortest = candidate;
+                }
+            }
+        Paths.push_back(std::move(Shortest->second));
+        Candidates.erase(Shortest);
+        }
+
+    std::vector<std::vector<std::weak_ptr<Link>>> RouteLinks(Paths.size());
+    for (unsigned int r = 0; r < Paths.size(); r++)
+        {
+        for (auto l : Paths[r])
+            {
+            RouteLinks[r].push_back(G.Links[l]);
+            }
         }
 
     return RouteLinks;
 }
+
+std::vector<unsigned int> Yen_RoutingAlgorithm::find_ShortestPath(
+    const RoutingGraph &G, const std::vector<double> &Costs,
+    const std::vector<bool> &MaskedNodes, const std::vector<bool> &MaskedLinks,
+    unsigned int Origin, unsigned int Destination)
+{
+    //A path can only enter a masked node through a link arriving at it
+    std::vector<unsigned int> Path;
+    ShortestPathSearch::get_ThreadSearch().find_Path(G, [&](unsigned int l)
+        {
+        return (MaskedLinks[l] || MaskedNodes[G.LinkDestination[l]]) ?
+               std::numeric_limits<double>::max() : Costs[l];
+        }, Origin, Destination, Path);
+
+    return Path;
+}
+
+bool Yen_RoutingAlgorithm::route_FromTable(const std::shared_ptr<Call> &C,
+        std::vector<std::vector<std::weak_ptr<Link>>> &Routes)
+{
+    const RoutingGraph &G = T->get_RoutingGraph();
+    unsigned int Origin = C->Origin.lock()->Index;
+    unsigned int Destination = C->Destination.lock()->Index;
+    unsigned int NumRoutes = Table->get_NumRoutes(Origin, Destination);
+
+    //As Dijkstra's algorithm, returns an empty route if there is none
+    if (NumRoutes == 0)
+        {
+        Routes.resize(1);
+        return true;
+        }
+
+    if (!G.is_NodeActive(Destination))
+        {
+        return false;
+        }
+
+    Routes.resize(NumRoutes);
+    for (unsigned int r = 0; r < NumRoutes; r++)
+        {
+        auto Route = Table->get_Route(Origin, Destination, r);
+        Routes[r].reserve(Route.second - Route.first);
+
+        for (auto l = Route.first; l != Route.second; ++l)
+            {
+            if (!G.is_LinkActive(*l) || !G.is_NodeActive(G.LinkOrigin[*l]))
+                {
+                return false;
+                }
+            Routes[r].push_back(G.Links[*l]);
+            }
+        }
+
+    return true;
+}
@@ -1,5 +1,6 @@
 #include <RMSA/RoutingAlgorithms/Costs/LengthOccupationRoutingAvailability.h>
 #include <Structure/Link.h>
+#include <Structure/RoutingGraph.h>
 #include <Structure/Topology.h>
 
 using namespace RMSA::ROUT;
@@ -21,7 +22,20 @@ double LengthOccupationRoutingAvailability::get_Cost(
         }
 
     return 1.0 + link.lock()->Length / T->get_LengthLongestLink() -
-           link.lock()->get_Availability() / (double) Link::NumSlots;
+           link.lock()->get_Availability() / (double) link.lock()->get_NumSlots();
+}
+
+double LengthOccupationRoutingAvailability::get_Cost(const RoutingGraph &G,
+        unsigned int LinkIndex, const std::shared_ptr<Call> &)
+{
+    if (!G.is_LinkActive(LinkIndex))
+        {
+        return std::numeric_limits<double>::max();
+        }
+
+    return 1.0 + G.LinkLength[LinkIndex] / G.LengthLongestLink -
+           G.get_LinkState(LinkIndex).get_NumFreeSlots() /
+           (double) G.get_FreeSlots(LinkIndex).size();
 }
 
 void LengthOccupationRoutingAvailability::save(std::string SimConfigFileName)
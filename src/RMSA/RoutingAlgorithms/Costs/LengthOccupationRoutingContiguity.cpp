@@ -1,5 +1,7 @@
 #include <RMSA/RoutingAlgorithms/Costs/LengthOccupationRoutingContiguity.h>
+#include <Calls/Call.h>
 #include <Structure/Link.h>
+#include <Structure/RoutingGraph.h>
 #include <Structure/Topology.h>
 
 using namespace RMSA::ROUT;
@@ -24,6 +26,27 @@ double LengthOccupationRoutingContiguity::get_Cost(
            (1.0 / (link.lock()->get_Contiguity(C) + 1));
 }
 
+double LengthOccupationRoutingContiguity::get_Cost(const RoutingGraph &G,
+        unsigned int LinkIndex, const std::shared_ptr<Call> &C)
+{
+    if (!G.is_LinkActive(LinkIndex))
+        {
+        return std::numeric_limits<double>::max();
+        }
+
+    return 1 +
+           (G.LinkLength[LinkIndex] / G.LengthLongestLink) +
+           (1.0 / (G.get_LinkState(LinkIndex).get_NumPositions(
+                       C->Scheme.get_NumSlots(C->Bitrate)) + 1));
+}
+
+RoutingCost::CallClass LengthOccupationRoutingContiguity::get_CallClass(
+    const std::shared_ptr<Call> &C) const
+{
+    //Only the number of slots of the call changes the costs
+    return CallClass(-1, -1, 0, C->Scheme.get_NumSlots(C->Bitrate));
+}
+
 void LengthOccupationRoutingContiguity::save(std::string SimConfigFileName)
 {
     RoutingCost::save(SimConfigFileName);
@@ -1,5 +1,6 @@
 #include <RMSA/RoutingAlgorithms/Costs/MinimumHops.h>
 #include <Structure/Link.h>
+#include <Structure/RoutingGraph.h>
 
 using namespace RMSA::ROUT;
 
@@ -21,6 +22,17 @@ double MinimumHops::get_Cost(
     return 1;
 }
 
+double MinimumHops::get_Cost(const RoutingGraph &G,
+        unsigned int LinkIndex, const std::shared_ptr<Call> &)
+{
+    if (!G.is_LinkActive(LinkIndex))
+        {
+        return std::numeric_limits<double>::max();
+        }
+
+    return 1;
+}
+
 void MinimumHops::save(std::string SimConfigFileName)
 {
     RoutingCost::save(SimConfigFileName);
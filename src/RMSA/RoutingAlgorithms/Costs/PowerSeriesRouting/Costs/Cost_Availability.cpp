@@ -1,5 +1,6 @@
 #include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_Availability.h>
 #include <Structure/Link.h>
+#include <Structure/Topology.h>
 #include <Calls/Call.h>
 #include <cmath>
 
@@ -9,7 +10,7 @@ PSR::cAvailability::cAvailability(int NMin, int NMax,
                                   std::shared_ptr<Topology> T)
     : Cost(NMin, NMax, T, Cost::availability)
 {
-    cache = arma::ones<arma::mat>(Link::NumSlots + 1, NMax - NMin + 1);
+    cache = arma::ones<arma::mat>(T->get_NumSlots() + 1, NMax - NMin + 1);
     createCache();
 }
 
@@ -26,10 +27,12 @@ double PSR::cAvailability::getUnitCost(std::weak_ptr<Link> link, std::shared_ptr
 
 void PSR::cAvailability::createCache()
 {
-    for (int avail = 0; avail <= Link::NumSlots; avail++)
+    unitCache.resize(T->get_NumSlots() + 1);
+
+    for (int avail = 0; avail <= T->get_NumSlots(); avail++)
         {
         int expo = 0;
-        double unitCost = avail / (double) Link::NumSlots;
+        double unitCost = avail / (double) T->get_NumSlots();
 
         unitCache[avail] = unitCost;
         for (int n = NMin; n <= NMax; n++)
@@ -1,12 +1,13 @@
 #include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_Contiguity.h>
 #include <Structure/Link.h>
+#include <Structure/Topology.h>
 
 using namespace RMSA::ROUT;
 
 PSR::cContiguity::cContiguity(int NMin, int NMax, std::shared_ptr<Topology> T) :
     Cost(NMin, NMax, T, Cost::contiguity)
 {
-    cache = arma::ones<arma::mat>(Link::NumSlots + 1, NMax - NMin + 1);
+    cache = arma::ones<arma::mat>(T->get_NumSlots() + 1, NMax - NMin + 1);
     createCache();
 }
 
@@ -23,7 +24,9 @@ double PSR::cContiguity::getUnitCost(std::weak_ptr<Link> link, std::shared_ptr<C
 
 void PSR::cContiguity::createCache()
 {
-    for (int contig = 0; contig <= Link::NumSlots; contig++)
+    unitCache.resize(T->get_NumSlots() + 1);
+
+    for (int contig = 0; contig <= T->get_NumSlots(); contig++)
         {
         int expo = 0;
         double unitCost = 1.0 / (contig + 1);
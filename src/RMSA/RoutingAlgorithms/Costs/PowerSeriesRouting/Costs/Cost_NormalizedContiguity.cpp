@@ -1,5 +1,6 @@
 #include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_NormalizedContiguity.h>
 #include <Structure/Link.h>
+#include <Structure/Topology.h>
 
 using namespace RMSA::ROUT;
 
@@ -7,7 +8,7 @@ PSR::cNormContiguity::cNormContiguity(
     int NMin, int NMax, std::shared_ptr<Topology> T) :
     Cost(NMin, NMax, T, Cost::normcontiguity)
 {
-    cache = arma::ones<arma::mat>(Link::NumSlots + 1, NMax - NMin + 1);
+    cache = arma::ones<arma::mat>(T->get_NumSlots() + 1, NMax - NMin + 1);
     createCache();
 }
 
@@ -24,10 +25,12 @@ double PSR::cNormContiguity::getUnitCost(std::weak_ptr<Link> link, std::shared_p
 
 void PSR::cNormContiguity::createCache()
 {
-    for (int contig = 0; contig <= Link::NumSlots; contig++)
+    unitCache.resize(T->get_NumSlots() + 1);
+
+    for (int contig = 0; contig <= T->get_NumSlots(); contig++)
         {
         int expo = 0;
-        double unitCost = contig / (1.0 * Link::NumSlots);
+        double unitCost = contig / (1.0 * T->get_NumSlots());
 
         unitCache[contig] = unitCost;
         for (int n = NMin; n <= NMax; n++)
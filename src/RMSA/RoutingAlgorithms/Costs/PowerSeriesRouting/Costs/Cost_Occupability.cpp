@@ -1,5 +1,6 @@
 #include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost_Occupability.h>
 #include <Structure/Link.h>
+#include <Structure/Topology.h>
 #include <Calls/Call.h>
 #include <cmath>
 
@@ -9,7 +10,7 @@ PSR::cOccupability::cOccupability(int NMin, int NMax,
                                   std::shared_ptr<Topology> T)
     : Cost(NMin, NMax, T, Cost::occupability)
 {
-    cache = arma::ones<arma::mat>(Link::NumSlots + 1, NMax - NMin + 1);
+    cache = arma::ones<arma::mat>(T->get_NumSlots() + 1, NMax - NMin + 1);
     createCache();
 }
 
@@ -26,10 +27,12 @@ double PSR::cOccupability::getUnitCost(std::weak_ptr<Link> link, std::shared_ptr
 
 void PSR::cOccupability::createCache()
 {
-    for (int occup = 0; occup <= Link::NumSlots; occup++)
+    unitCache.resize(T->get_NumSlots() + 1);
+
+    for (int occup = 0; occup <= T->get_NumSlots(); occup++)
         {
         int expo = 0;
-        double unitCost = occup / (double) Link::NumSlots;
+        double unitCost = occup / (double) T->get_NumSlots();
 
         unitCache[occup] = unitCost;
         for (int n = NMin; n <= NMax; n++)
@@ -25,16 +25,40 @@ double AdaptativeWeighingRouting::get_Cost(
         return std::numeric_limits<double>::max();
         }
 
+    if (!firstTimeRun)
+        {
+        calculate_Weights();
+        firstTimeRun = true;
+        }
+
+    auto &UnitCosts = get_UnitCosts(link, C);
     double Cost = 0;
 
+    for (size_t n = 0; n < Weights.size(); ++n)
+        {
+        Cost += Weights[n] * UnitCosts[n];
+        }
+
+    return Cost;
+}
+
+void AdaptativeWeighingRouting::calculate_Weights()
+{
     //Spherical coordinates for a n-sphere that represents the possible values that the AWR can take.
+    //The last cost has no angle of its own when there is one angle less than costs.
     double Sines = 1;
 
+    Weights.resize(Costs.size());
     for (size_t n = 0; n < Costs.size(); ++n)
         {
-        Cost += Costs[n]->getCost(1, link, C) * std::cos(coefficients.at(n)) * Sines;
-        Sines *= std::sin(coefficients.at(n));
+        if (n < coefficients.n_elem)
+            {
+            Weights[n] = std::cos(coefficients(n)) * Sines;
+            Sines *= std::sin(coefficients(n));
+            }
+        else
+            {
+            Weights[n] = Sines;
+            }
         }
-
-    return Cost;
 }
@@ -5,6 +5,7 @@
 #include <Structure/Link.h>
 #include <Structure/Topology.h>
 #include <algorithm>
+#include <iostream>
 
 using namespace RMSA::ROUT::PSR;
 
@@ -55,34 +56,35 @@ double LocalPowerSeriesRouting::get_Cost
         return std::numeric_limits<double>::max();
         }
 
-    arma::mat cost_matrix = arma::ones(1);
-    auto origDestPair = std::make_pair(C->Origin.lock()->ID,
-                                       C->Destination.lock()->ID);
-
-    for (auto &cost : Costs)
+    if (!firstTimeRun)
         {
-        cost_matrix = arma::kron(cost_matrix, cost->getCost(link, C));
+        Series.clear();
+        firstTimeRun = true;
         }
 
-    if (!coef_matrices.count(origDestPair))
+    auto origDestPair = std::make_pair(C->Origin.lock()->ID,
+                                       C->Destination.lock()->ID);
+    auto series = Series.find(origDestPair);
+
+    if (series == Series.end())
         {
-        calculateCoefficients(origDestPair);
-        coef_matrices.at(origDestPair).copy_size(cost_matrix);
+        series = Series.emplace(origDestPair, calculateSeries(origDestPair)).first;
         }
 
-    return arma::accu(coef_matrices.at(origDestPair) % cost_matrix);
+    return series->second.evaluate(get_UnitCosts(link, C).data());
 }
 
-void LocalPowerSeriesRouting::calculateCoefficients
+PowerSeries LocalPowerSeriesRouting::calculateSeries
 (std::pair<int, int> origDestPair)
 {
-    if (coef_matrices.count(origDestPair))
+    int pos = std::distance(origDestPairs.begin(),
+                            std::find(origDestPairs.begin(), origDestPairs.end(), origDestPair));
+
+    if (pos + PowerSeries::get_NumTerms(Costs.size(), NMin, NMax) > coefficients.n_elem)
         {
-        return;
+        std::cerr << "There are not enough PSR coefficients for the pair." << std::endl;
+        abort();
         }
 
-    int pos = std::distance(origDestPairs.begin(),
-                            std::find(origDestPairs.begin(), origDestPairs.end(), origDestPair));
-    coef_matrices.emplace(origDestPair,
-                          coefficients.cols(pos, pos + std::pow(NMax - NMin + 1, Costs.size()) - 1));
+    return PowerSeries(coefficients.memptr() + pos, Costs.size(), NMin, NMax);
 }
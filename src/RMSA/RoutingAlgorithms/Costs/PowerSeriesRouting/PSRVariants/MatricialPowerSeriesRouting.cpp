@@ -1,6 +1,7 @@
 #include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PSRVariants/MatricialPowerSeriesRouting.h>
 #include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost.h>
 #include <Structure/Link.h>
+#include <iostream>
 
 using namespace RMSA::ROUT::PSR;
 
@@ -25,34 +26,17 @@ double MatricialPowerSeriesRouting::get_Cost
         return std::numeric_limits<double>::max();
         }
 
-    std::vector<double> costs;
-    for (auto &cost : Costs)
+    if (!firstTimeRun)
         {
-        costs.push_back(cost->getUnitCost(link, C));
-        }
-
-    if (cache.count(costs))
-        {
-        return cache[costs];
-        }
-    else
-        {
-        arma::mat cost_matrix = arma::ones(1);
-
-        for (auto &cost : Costs)
+        if (coefficients.n_elem != PowerSeries::get_NumTerms(Costs.size(), NMin, NMax))
             {
-            cost_matrix = arma::kron(cost_matrix, cost->getCost(link, C));
+            std::cerr << "The number of PSR coefficients does not match the costs."
+                      << std::endl;
+            abort();
             }
-
-        if (!firstTimeRun)
-            {
-            coefficients.copy_size(cost_matrix);
-            firstTimeRun = true;
-            }
-
-        double totalCost = arma::accu(coefficients % cost_matrix);
-        cache[costs] = totalCost;
-
-        return totalCost;
+        Series = PowerSeries(coefficients.memptr(), Costs.size(), NMin, NMax);
+        firstTimeRun = true;
         }
+
+    return Series.evaluate(get_UnitCosts(link, C).data());
 }
@@ -1,6 +1,7 @@
 #include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PSRVariants/TensorialPowerSeriesRouting.h>
 #include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs/Cost.h>
 #include <Structure/Link.h>
+#include <iostream>
 
 using namespace RMSA::ROUT::PSR;
 
@@ -25,29 +26,36 @@ double TensorialPowerSeriesRouting::get_Cost
         return std::numeric_limits<double>::max();
         }
 
-    arma::mat cost_matrix = arma::ones(1);
-
-    for (auto &cost : Costs)
+    if (!firstTimeRun)
         {
-        cost_matrix = arma::kron(cost_matrix, cost->getCost(link, C));
+        calculate_Factors();
+        firstTimeRun = true;
         }
 
-    if (!firstTimeRun)
+    //The Kronecker product of the coefficients factors the series
+    auto &UnitCosts = get_UnitCosts(link, C);
+    double Cost = 1;
+    for (size_t cost = 0; cost < Factors.size(); ++cost)
         {
-        calculate_CoefsMatrix();
-        coefs_matrix.copy_size(cost_matrix);
-        firstTimeRun = true;
+        Cost *= Factors[cost].evaluate(&UnitCosts[cost]);
         }
 
-    return arma::accu(coefs_matrix % cost_matrix);
+    return Cost;
 }
 
-void TensorialPowerSeriesRouting::calculate_CoefsMatrix()
+void TensorialPowerSeriesRouting::calculate_Factors()
 {
-    coefs_matrix = arma::ones(1);
+    if (coefficients.n_elem != Costs.size() * get_N())
+        {
+        std::cerr << "The number of PSR coefficients does not match the costs."
+                  << std::endl;
+        abort();
+        }
+
+    Factors.clear();
     for (size_t cost = 0; cost < Costs.size(); ++cost)
         {
-        auto costCoefs = coefficients.cols(cost * get_N(), (cost + 1) * get_N() - 1);
-        coefs_matrix = arma::kron(coefs_matrix, costCoefs);
+        Factors.push_back(PowerSeries(coefficients.memptr() + cost * get_N(), 1, NMin,
+                                      NMax));
         }
 }
@@ -0,0 +1,80 @@
+#include <RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeries.h>
+#include <cmath>
+
+using namespace RMSA::ROUT::PSR;
+
+PowerSeries::PowerSeries() : NumVariables(0), NMin(0), N(0)
+{
+
+}
+
+PowerSeries::PowerSeries(const double *Coefficients, unsigned int NumVariables,
+                         int NMin, int NMax) :
+    Coefficients(Coefficients, Coefficients + get_NumTerms(NumVariables, NMin, NMax)),
+    NumVariables(NumVariables), NMin(NMin), N(NMax - NMin + 1)
+{
+
+}
+
+unsigned int PowerSeries::get_NumTerms(unsigned int NumVariables, int NMin,
+                                       int NMax)
+{
+    unsigned int NumTerms = 1;
+    for (unsigned int v = 0; v < NumVariables; v++)
+        {
+        NumTerms *= NMax - NMin + 1;
+        }
+    return NumTerms;
+}
+
+double PowerSeries::evaluate(const double *Variables) const
+{
+    if (NumVariables == 0)
+        {
+        return Coefficients.empty() ? 0 : Coefficients.front();
+        }
+
+    static thread_local std::vector<double> Partial;
+    if (Partial.size() < Coefficients.size() / N)
+        {
+        Partial.resize(Coefficients.size() / N);
+        }
+
+    //The last variable is eliminated first, by a Horner scheme over each block
+    //of N consecutive terms, and so on until the first variable
+    const double *Terms = Coefficients.data();
+    unsigned int NumTerms = Coefficients.size();
+
+    for (unsigned int v = NumVariables; v-- > 0;)
+        {
+        const double X = Variables[v];
+        unsigned int NumBlocks = NumTerms / N;
+
+        for (unsigned int b = 0; b < NumBlocks; b++)
+            {
+            const double *Block = Terms + b * N;
+            double Value = 0;
+            for (unsigned int i = N; i-- > 0;)
+                {
+                Value = Value * X + Block[i];
+                }
+            Partial[b] = Value;
+            }
+
+        Terms = Partial.data();
+        NumTerms = NumBlocks;
+        }
+
+    double Value = Terms[0];
+
+    //Every term has each variable raised at least to the minimum exponent
+    if (NMin != 0)
+        {
+        for (unsigned int v = 0; v < NumVariables; v++)
+            {
+            Value *= std::pow(Variables[v], NMin);
+            }
+        }
+
+    return Value;
+}
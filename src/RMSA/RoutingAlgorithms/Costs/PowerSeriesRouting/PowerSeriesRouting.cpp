@@ -58,6 +58,7 @@ PowerSeriesRouting::PowerSeriesRouting(std::shared_ptr<Topology> T,
 void PowerSeriesRouting::load()
 {
     RoutingCost::load();
+    firstTimeRun = false;
 
     if (hasLoaded)
         {
@@ -111,6 +112,7 @@ bool PowerSeriesRouting::initCoefficients(std::vector<double> X)
         coefficients(0, it++) = x;
         }
 
+    firstTimeRun = false;
     hasLoaded = true;
 
     return true;
@@ -225,11 +227,26 @@ bool PowerSeriesRouting::initCoefficients(std::string Filename)
             }
         }
 
+    firstTimeRun = false;
     hasLoaded = true;
 
     return true;
 }
 
+const std::vector<double> &PowerSeriesRouting::get_UnitCosts(
+    std::weak_ptr<Link> link, std::shared_ptr<Call> C)
+{
+    static thread_local std::vector<double> UnitCosts;
+
+    UnitCosts.resize(Costs.size());
+    for (size_t n = 0; n < Costs.size(); ++n)
+        {
+        UnitCosts[n] = Costs[n]->getUnitCost(link, C);
+        }
+
+    return UnitCosts;
+}
+
 std::vector<std::shared_ptr<Cost>> PowerSeriesRouting::get_Costs()
 {
     return Costs;
@@ -1,5 +1,6 @@
 #include <RMSA/RoutingAlgorithms/Costs/ShortestPath.h>
 #include <Structure/Link.h>
+#include <Structure/RoutingGraph.h>
 
 using namespace RMSA::ROUT;
 
@@ -21,6 +22,17 @@ double ShortestPath::get_Cost(
     return link.lock()->Length;
 }
 
+double ShortestPath::get_Cost(const RoutingGraph &G,
+        unsigned int LinkIndex, const std::shared_ptr<Call> &)
+{
+    if (!G.is_LinkActive(LinkIndex))
+        {
+        return std::numeric_limits<double>::max();
+        }
+
+    return G.LinkLength[LinkIndex];
+}
+
 void ShortestPath::save(std::string SimConfigFileName)
 {
     RoutingCost::save(SimConfigFileName);
@@ -0,0 +1,321 @@
+#include <RMSA/RoutingAlgorithms/DynamicShortestPaths.h>
+#include <RMSA/RoutingAlgorithms/ShortestPathSearch.h>
+#include <Calls/Call.h>
+#include <Structure/Node.h>
+#include <Structure/RoutingGraph.h>
+#include <Structure/Topology.h>
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+using namespace RMSA::ROUT;
+
+constexpr unsigned int DynamicShortestPaths::NoLink;
+
+DynamicShortestPaths::DynamicShortestPaths(std::shared_ptr<Topology> T,
+        std::shared_ptr<RoutingCost> RCost) : T(T), RCost(RCost), G(nullptr),
+    NumNodes(0), NumLinks(0), LogStart(0), CurrentGeneration(0), NumRepairedNodes(0)
+{
+
+}
+
+bool DynamicShortestPaths::find_Path(const std::shared_ptr<Call> &C,
+                                     std::vector<unsigned int> &Path)
+{
+    check_Graph();
+    Path.clear();
+
+    unsigned int Origin = C->Origin.lock()->Index;
+    unsigned int Destination = C->Destination.lock()->Index;
+
+    auto Key = std::make_pair(Origin, RCost->get_CallClass(C));
+    auto tree = Trees.find(Key);
+
+    if (tree == Trees.end())
+        {
+        tree = Trees.emplace(Key, Tree()).first;
+        tree->second.Representative = std::make_shared<Call>(C->Origin, C->Destination,
+                                      C->Bitrate, C->Scheme);
+        build(tree->second, Origin);
+        }
+    else
+        {
+        update(tree->second);
+        }
+
+    Tree &Tr = tree->second;
+    settle(Tr, Destination);
+
+    if (Origin == Destination ||
+            Tr.Distance[Destination] == std::numeric_limits<double>::max())
+        {
+        return Origin == Destination;
+        }
+
+    for (unsigned int node = Destination; node != Origin;
+            node = G->LinkOrigin[Tr.Precedent[node]])
+        {
+        Path.push_back(Tr.Precedent[node]);
+        }
+    std::reverse(Path.begin(), Path.end());
+
+    return true;
+}
+
+void DynamicShortestPaths::notify_LinkChanged(unsigned int LinkIndex)
+{
+    if (Trees.empty())
+        {
+        return;
+        }
+
+    if (LastEntry[LinkIndex] > LogStart)
+        {
+        Log[LastEntry[LinkIndex] - 1 - LogStart] = NoLink;
+        }
+    Log.push_back(LinkIndex);
+    LastEntry[LinkIndex] = LogStart + Log.size();
+
+    //Past this size, evaluating every link again is cheaper than reading the log
+    if (Log.size() > 4 * NumLinks)
+        {
+        LogStart += Log.size();
+        Log.clear();
+        }
+}
+
+void DynamicShortestPaths::check_Graph()
+{
+    const RoutingGraph &Graph = T->get_RoutingGraph();
+
+    //The trees are dropped when the structure of the topology changes
+    if (G != &Graph || NumNodes != Graph.NumNodes || NumLinks != Graph.NumLinks)
+        {
+        G = &Graph;
+        NumNodes = Graph.NumNodes;
+        NumLinks = Graph.NumLinks;
+        Trees.clear();
+        LogStart += Log.size();
+        Log.clear();
+        LastEntry.assign(NumLinks, 0);
+        ShiftedGeneration.assign(NumNodes, 0);
+        CurrentGeneration = 0;
+        }
+}
+
+double DynamicShortestPaths::get_LinkCost(const Tree &Tr, unsigned int LinkIndex)
+const
+{
+    //As in a ShortestPathSearch, an inactive node can not be entered
+    if (!G->is_NodeActive(G->LinkDestination[LinkIndex]))
+        {
+        return std::numeric_limits<double>::max();
+        }
+
+    return RCost->get_Cost(*G, LinkIndex, Tr.Representative);
+}
+
+void DynamicShortestPaths::build(Tree &Tr, unsigned int Origin)
+{
+    Tr.LinkCost.resize(NumLinks);
+    for (unsigned int l = 0; l < NumLinks; l++)
+        {
+        Tr.LinkCost[l] = get_LinkCost(Tr, l);
+        }
+
+    ShortestPathSearch &Search = ShortestPathSearch::get_ThreadSearch();
+    Search.find_Tree(*G, [&Tr](unsigned int l)
+        {
+        return Tr.LinkCost[l];
+        }, Origin);
+
+    Tr.Distance.resize(NumNodes);
+    Tr.Precedent.resize(NumNodes);
+    Tr.isPending.assign(NumNodes, false);
+    for (unsigned int n = 0; n < NumNodes; n++)
+        {
+        Tr.Distance[n] = Search.get_Distance(n);
+        Tr.Precedent[n] = Search.get_Precedent(n);
+        }
+
+    Tr.LogPosition = LogStart + Log.size();
+}
+
+void DynamicShortestPaths::update(Tree &Tr)
+{
+    std::vector<std::pair<unsigned int, double>> Changes; //Link and former cost
+
+    auto evaluate = [&](unsigned int l)
+        {
+        double Cost = get_LinkCost(Tr, l);
+        if (Cost != Tr.LinkCost[l])
+            {
+            Changes.push_back({l, Tr.LinkCost[l]});
+            Tr.LinkCost[l] = Cost;
+            }
+        };
+
+    if (Tr.LogPosition < LogStart)
+        {
+        for (unsigned int l = 0; l < NumLinks; l++)
+            {
+            evaluate(l);
+            }
+        }
+    else
+        {
+        for (auto l = Log.begin() + (Tr.LogPosition - LogStart); l != Log.end(); ++l)
+            {
+            if (*l != NoLink)
+                {
+                evaluate(*l);
+                }
+            }
+        }
+
+    Tr.LogPosition = LogStart + Log.size();
+
+    if (!Changes.empty())
+        {
+        repair(Tr, Changes);
+        }
+}
+
+void DynamicShortestPaths::repair(Tree &Tr,
+                                  const std::vector<std::pair<unsigned int, double>> &Changes)
+{
+    const double Max = std::numeric_limits<double>::max();
+
+    if (++CurrentGeneration == 0)
+        {
+        std::fill(ShiftedGeneration.begin(), ShiftedGeneration.end(), 0);
+        CurrentGeneration = 1;
+        }
+
+    //The subtree hanging from a tree link keeps its paths, whose length changes
+    //as much as the cost of the link, or that are lost if the link is blocked
+    std::vector<unsigned int> Shifted, Subtree;
+    for (auto &change : Changes)
+        {
+        unsigned int l = change.first;
+        unsigned int node = G->LinkDestination[l];
+
+        if (Tr.Precedent[node] != (int) l)
+            {
+            continue;
+            }
+
+        double Shift = (Tr.LinkCost[l] >= Max) ? Max : Tr.LinkCost[l] - change.second;
+
+        Subtree.assign(1, node);
+        for (unsigned int d = 0; d < Subtree.size(); d++)
+            {
+            unsigned int parent = Subtree[d];
+            for (unsigned int e = G->FirstEdge[parent]; e < G->FirstEdge[parent + 1]; ++e)
+                {
+                if (Tr.Precedent[G->EdgeTarget[e]] == (int) G->EdgeLink[e])
+                    {
+                    Subtree.push_back(G->EdgeTarget[e]);
+                    }
+                }
+            }
+
+        for (auto n : Subtree)
+            {
+            if (ShiftedGeneration[n] != CurrentGeneration)
+                {
+                ShiftedGeneration[n] = CurrentGeneration;
+                Shifted.push_back(n);
+                }
+
+            if (Shift == Max)
+                {
+                Tr.Distance[n] = Max;
+                Tr.Precedent[n] = -1;
+                }
+            else if (Tr.Distance[n] != Max)
+                {
+                Tr.Distance[n] += Shift;
+                }
+            }
+        }
+
+    //Only the shifted nodes may have found a shorter path, or have given one
+    for (auto n : Shifted)
+        {
+        if (Tr.isPending[n] && Tr.Distance[n] != Max)
+            {
+            push(Tr, n);
+            }
+        for (unsigned int e = G->FirstInEdge[n]; e < G->FirstInEdge[n + 1]; ++e)
+            {
+            relax(Tr, G->InEdgeLink[e]);
+            }
+        for (unsigned int e = G->FirstEdge[n]; e < G->FirstEdge[n + 1]; ++e)
+            {
+            relax(Tr, G->EdgeLink[e]);
+            }
+        }
+
+    for (auto &change : Changes)
+        {
+        if (Tr.LinkCost[change.first] < change.second)
+            {
+            relax(Tr, change.first);
+            }
+        }
+}
+
+void DynamicShortestPaths::relax(Tree &Tr, unsigned int Link)
+{
+    unsigned int origin = G->LinkOrigin[Link];
+    unsigned int node = G->LinkDestination[Link];
+
+    if (Tr.Distance[origin] == std::numeric_limits<double>::max() ||
+            Tr.LinkCost[Link] >= std::numeric_limits<double>::max())
+        {
+        return;
+        }
+
+    double newLength = Tr.Distance[origin] + Tr.LinkCost[Link];
+    if (newLength < Tr.Distance[node])
+        {
+        Tr.Distance[node] = newLength;
+        Tr.Precedent[node] = Link;
+        push(Tr, node);
+        }
+}
+
+void DynamicShortestPaths::push(Tree &Tr, unsigned int Node)
+{
+    Tr.isPending[Node] = true;
+    Tr.Pending.push_back({Tr.Distance[Node], Node});
+    std::push_heap(Tr.Pending.begin(), Tr.Pending.end(),
+                   std::greater<std::pair<double, unsigned int>>());
+}
+
+void DynamicShortestPaths::settle(Tree &Tr, unsigned int Destination)
+{
+    //Every node closer than the first pending one already has its distance
+    while (!Tr.Pending.empty() && Tr.Pending.front().first < Tr.Distance[Destination])
+        {
+        auto Top = Tr.Pending.front();
+        std::pop_heap(Tr.Pending.begin(), Tr.Pending.end(),
+                      std::greater<std::pair<double, unsigned int>>());
+        Tr.Pending.pop_back();
+
+        //Entries left behind by a later change of the distance
+        if (Top.first != Tr.Distance[Top.second])
+            {
+            continue;
+            }
+        Tr.isPending[Top.second] = false;
+        NumRepairedNodes++;
+
+        for (unsigned int e = G->FirstEdge[Top.second]; e < G->FirstEdge[Top.second + 1];
+                ++e)
+            {
+            relax(Tr, G->EdgeLink[e]);
+            }
+        }
+}
@@ -0,0 +1,269 @@
+#include <RMSA/RoutingAlgorithms/RouteTable.h>
+#include <RMSA/RoutingAlgorithms/Algorithms/Yen_RoutingAlgorithm.h>
+#include <GeneralClasses/BinaryStream.h>
+#include <GeneralClasses/ModulationScheme.h>
+#include <GeneralClasses/TransmissionBitrate.h>
+#include <Calls/Call.h>
+#include <Structure/Link.h>
+#include <Structure/Node.h>
+#include <Structure/Topology.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+#include <cstdio>
+#include <cstring>
+
+namespace Simulations
+{
+extern bool parallelism_enabled;
+}
+
+using namespace RMSA::ROUT;
+
+const char RouteTable::Magic[8] = {'S', 'I', 'M', 'E', 'O', 'N', 'R', 'T'};
+constexpr uint32_t RouteTable::Version;
+std::string RouteTable::Directory = "";
+
+RouteTable::RouteTable() : TopologyHash(0), Cost(RoutingCost::SP), k(0),
+    NumNodes(0)
+{
+
+}
+
+RouteTable::RouteTable(std::shared_ptr<Topology> T, RoutingCost::RoutingCosts Cost,
+                       unsigned int k) : TopologyHash(T->get_Hash()), Cost(Cost), k(k),
+    NumNodes(T->Nodes.size())
+{
+    //The routes are searched with every node and link active
+    auto TopologyCopy = std::make_shared<Topology>(*T);
+    for (auto &node : TopologyCopy->Nodes)
+        {
+        node->set_NodeActive();
+        }
+    for (auto &link : TopologyCopy->Links)
+        {
+        link.second->set_LinkActive();
+        }
+
+    //Yen's algorithm does not change the topology, so every origin is routed
+    //by the same instance
+    auto Yen = std::make_shared<Yen_RoutingAlgorithm>(TopologyCopy, Cost, false, k);
+    TopologyCopy->get_RoutingGraph();
+
+    //Routes between each pair of nodes, as link indices
+    std::vector<std::vector<std::vector<uint32_t>>> Routes(NumNodes * NumNodes);
+
+    #pragma omp parallel for schedule(dynamic) if(Simulations::parallelism_enabled)
+    for (unsigned int o = 0; o < NumNodes; o++)
+        {
+        for (unsigned int d = 0; d < NumNodes; d++)
+            {
+            if (o == d)
+                {
+                continue;
+                }
+
+            auto C = std::make_shared<Call>(TopologyCopy->Nodes[o], TopologyCopy->Nodes[d],
+                                            *TransmissionBitrate::DefaultBitrates.begin(),
+                                            *ModulationScheme::DefaultSchemes.begin());
+
+            for (auto &route : Yen->search(C))
+                {
+                if (route.empty())
+                    {
+                    continue;
+                    }
+
+                std::vector<uint32_t> Links;
+                for (auto &link : route)
+                    {
+                    Links.push_back(link.lock()->Index);
+                    }
+                Routes[o * NumNodes + d].push_back(std::move(Links));
+                }
+            }
+        }
+
+    FirstRoute.reserve(NumNodes * NumNodes + 1);
+    FirstLink.push_back(0);
+    for (auto &pair : Routes)
+        {
+        FirstRoute.push_back(FirstLink.size() - 1);
+        for (auto &route : pair)
+            {
+            RouteLinks.insert(RouteLinks.end(), route.begin(), route.end());
+            FirstLink.push_back(RouteLinks.size());
+            }
+        }
+    FirstRoute.push_back(FirstLink.size() - 1);
+}
+
+std::shared_ptr<const RouteTable> RouteTable::get_RouteTable(
+    std::shared_ptr<Topology> T, RoutingCost::RoutingCosts Cost, unsigned int k)
+{
+    static std::mutex TablesMutex;
+    static std::map<std::tuple<uint64_t, RoutingCost::RoutingCosts, unsigned int>,
+           std::shared_ptr<const RouteTable>> Tables;
+
+    uint64_t Hash = T->get_Hash();
+    auto Key = std::make_tuple(Hash, Cost, k);
+
+    std::lock_guard<std::mutex> Lock(TablesMutex);
+    auto &Table = Tables[Key];
+
+    if (Table)
+        {
+        return Table;
+        }
+
+    std::string FileName;
+    if (!Directory.empty())
+        {
+        std::ostringstream Name;
+        Name << Directory << "/" << std::hex << Hash << std::dec << "_" <<
+             RoutingCost::RoutingCostsNicknames.left.at(Cost) << "_" << k << ".routes";
+        FileName = Name.str();
+        Table = load(FileName, T, Cost, k);
+        }
+
+    if (!Table)
+        {
+        auto NewTable = std::make_shared<RouteTable>(T, Cost, k);
+        if (!FileName.empty())
+            {
+            NewTable->save(FileName);
+            }
+        Table = NewTable;
+        }
+
+    return Table;
+}
+
+void RouteTable::save(std::string FileName) const
+{
+    std::string TempFileName = FileName + ".tmp";
+    std::ofstream File(TempFileName, std::ofstream::binary | std::ofstream::trunc);
+
+    if (!File.is_open())
+        {
+        std::cerr << "Could not write the route table " << FileName << "." << std::endl;
+        return;
+        }
+
+    File.write(Magic, sizeof(Magic));
+    BinaryStream::write(File, Version);
+    BinaryStream::write(File, TopologyHash);
+    BinaryStream::write(File, (uint32_t) Cost);
+    BinaryStream::write(File, (uint32_t) k);
+    BinaryStream::write(File, (uint32_t) NumNodes);
+    BinaryStream::write(File, FirstRoute);
+    BinaryStream::write(File, FirstLink);
+    BinaryStream::write(File, RouteLinks);
+    File.close();
+
+    if (File.fail())
+        {
+        std::cerr << "Could not write the route table " << FileName << "." << std::endl;
+        std::remove(TempFileName.c_str());
+        return;
+        }
+
+    //Renamed once complete, so that a reader never finds half a table
+    std::rename(TempFileName.c_str(), FileName.c_str());
+}
+
+std::shared_ptr<RouteTable> RouteTable::load(std::string FileName,
+        std::shared_ptr<Topology> T, RoutingCost::RoutingCosts Cost, unsigned int k)
+{
+    std::ifstream File(FileName, std::ifstream::binary);
+
+    char FileMagic[8];
+    uint32_t FileVersion, FileCost, FileK, FileNumNodes;
+    uint64_t FileHash;
+
+    if (!File.read(FileMagic, sizeof(FileMagic)) ||
+            std::memcmp(FileMagic, Magic, sizeof(Magic)) != 0)
+        {
+        return nullptr;
+        }
+
+    BinaryStream::read(File, FileVersion);
+    BinaryStream::read(File, FileHash);
+    BinaryStream::read(File, FileCost);
+    BinaryStream::read(File, FileK);
+    BinaryStream::read(File, FileNumNodes);
+
+    if (!File || FileVersion != Version || FileHash != T->get_Hash() ||
+            FileCost != (uint32_t) Cost || FileK != k)
+        {
+        return nullptr;
+        }
+
+    std::shared_ptr<RouteTable> Table(new RouteTable());
+    Table->TopologyHash = FileHash;
+    Table->Cost = Cost;
+    Table->k = k;
+    Table->NumNodes = FileNumNodes;
+    BinaryStream::read(File, Table->FirstRoute);
+    BinaryStream::read(File, Table->FirstLink);
+    BinaryStream::read(File, Table->RouteLinks);
+
+    if (!File || !Table->isValid(T->Nodes.size(), T->Links.size()))
+        {
+        std::cerr << "Invalid route table " << FileName << ". It is computed again."
+                  << std::endl;
+        return nullptr;
+        }
+
+    return Table;
+}
+
+bool RouteTable::isValid(uint64_t NumTopologyNodes, uint64_t NumTopologyLinks) const
+{
+    //The offsets must start at zero, never decrease and end at the next array
+    auto isMonotone = [](const std::vector<uint32_t> &Offsets, uint64_t End)
+        {
+        if (Offsets.empty() || Offsets.front() != 0 || Offsets.back() != End)
+            {
+            return false;
+            }
+        for (size_t i = 1; i < Offsets.size(); i++)
+            {
+            if (Offsets[i] < Offsets[i - 1])
+                {
+                return false;
+                }
+            }
+        return true;
+        };
+
+    if (NumNodes != NumTopologyNodes ||
+            FirstRoute.size() != NumTopologyNodes * NumTopologyNodes + 1 ||
+            FirstLink.empty() ||
+            !isMonotone(FirstRoute, FirstLink.size() - 1) ||
+            !isMonotone(FirstLink, RouteLinks.size()))
+        {
+        return false;
+        }
+
+    for (size_t p = 0; p + 1 < FirstRoute.size(); p++)
+        {
+        if (FirstRoute[p + 1] - FirstRoute[p] > k)
+            {
+            return false;
+            }
+        }
+
+    for (auto l : RouteLinks)
+        {
+        if (l >= NumTopologyLinks)
+            {
+            return false;
+            }
+        }
+
+    return true;
+}
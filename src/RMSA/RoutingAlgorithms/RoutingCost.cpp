@@ -1,5 +1,8 @@
 #include "include/RMSA/RoutingAlgorithms/RoutingCost.h"
 #include "include/RMSA/RoutingCosts.h"
+#include "include/Structure/RoutingGraph.h"
+#include "include/Structure/Node.h"
+#include "include/Calls/Call.h"
 #include <boost/assign.hpp>
 #include <iostream>
 
@@ -26,6 +29,19 @@ RoutingCost::RoutingCost(std::shared_ptr<Topology> T,
 
 }
 
+double RoutingCost::get_Cost(const RoutingGraph &G, unsigned int LinkIndex,
+                             const std::shared_ptr<Call> &C)
+{
+    return get_Cost(G.Links[LinkIndex], C);
+}
+
+RoutingCost::CallClass RoutingCost::get_CallClass(const std::shared_ptr<Call> &C)
+const
+{
+    return CallClass(C->Origin.lock()->Index, C->Destination.lock()->Index,
+                     C->Bitrate.get_Bitrate(), C->Scheme.get_M());
+}
+
 void RoutingCost::load()
 {
 
@@ -0,0 +1,324 @@
+#include <RMSA/RoutingAlgorithms/ShortestPathSearch.h>
+#include <Structure/RoutingGraph.h>
+#include <algorithm>
+
+using namespace RMSA::ROUT;
+
+constexpr unsigned int ShortestPathSearch::Arity;
+constexpr uint32_t ShortestPathSearch::Settled;
+
+ShortestPathSearch::ShortestPathSearch() : CurrentGeneration(0), G(nullptr),
+    Cost(nullptr)
+{
+
+}
+
+ShortestPathSearch &ShortestPathSearch::get_ThreadSearch()
+{
+    static thread_local ShortestPathSearch Search;
+    return Search;
+}
+
+bool ShortestPathSearch::find_Path(const RoutingGraph &G,
+                                   const LinkCostFunction &Cost, unsigned int Origin,
+                                   unsigned int Destination, std::vector<unsigned int> &Path,
+                                   bool isBidirectional)
+{
+    Path.clear();
+
+    if (Origin == Destination)
+        {
+        return true;
+        }
+
+    start(G, Cost);
+
+    if (!isBidirectional)
+        {
+        search_Forward(Origin, Destination);
+
+        if (!isSettled(Forward, Destination))
+            {
+            return false;
+            }
+
+        for (unsigned int node = Destination; node != Origin;
+                node = G.LinkOrigin[Forward.Precedent[node]])
+            {
+            Path.push_back(Forward.Precedent[node]);
+            }
+        std::reverse(Path.begin(), Path.end());
+        return true;
+        }
+
+    unsigned int Meeting = search_Bidirectional(Origin, Destination);
+
+    if (Meeting == G.NumNodes)
+        {
+        return false;
+        }
+
+    for (unsigned int node = Meeting; node != Origin;
+            node = G.LinkOrigin[Forward.Precedent[node]])
+        {
+        Path.push_back(Forward.Precedent[node]);
+        }
+    std::reverse(Path.begin(), Path.end());
+    for (unsigned int node = Meeting; node != Destination;
+            node = G.LinkDestination[Backward.Precedent[node]])
+        {
+        Path.push_back(Backward.Precedent[node]);
+        }
+
+    return true;
+}
+
+void ShortestPathSearch::find_Tree(const RoutingGraph &G,
+                                   const LinkCostFunction &Cost, unsigned int Origin)
+{
+    start(G, Cost);
+    search_Forward(Origin, G.NumNodes);
+}
+
+double ShortestPathSearch::get_Distance(unsigned int Node) const
+{
+    return isReached(Forward, Node) ? Forward.Distance[Node] :
+           std::numeric_limits<double>::max();
+}
+
+int ShortestPathSearch::get_Precedent(unsigned int Node) const
+{
+    return isReached(Forward, Node) ? Forward.Precedent[Node] : -1;
+}
+
+void ShortestPathSearch::start(const RoutingGraph &G, const LinkCostFunction &Cost)
+{
+    this->G = &G;
+    this->Cost = &Cost;
+
+    if (++CurrentGeneration == 0)
+        {
+        //The counter wrapped around, so old entries could look current
+        for (auto D : {&Forward, &Backward})
+            {
+            std::fill(D->Generation.begin(), D->Generation.end(), 0);
+            }
+        std::fill(LinkGeneration.begin(), LinkGeneration.end(), 0);
+        CurrentGeneration = 1;
+        }
+
+    for (auto D : {&Forward, &Backward})
+        {
+        if (D->Generation.size() < G.NumNodes)
+            {
+            D->Generation.resize(G.NumNodes, 0);
+            D->Distance.resize(G.NumNodes);
+            D->Precedent.resize(G.NumNodes);
+            D->Position.resize(G.NumNodes);
+            }
+        D->Heap.clear();
+        }
+
+    if (LinkGeneration.size() < G.NumLinks)
+        {
+        LinkGeneration.resize(G.NumLinks, 0);
+        LinkCost.resize(G.NumLinks);
+        }
+}
+
+double ShortestPathSearch::get_LinkCost(unsigned int Link)
+{
+    if (LinkGeneration[Link] != CurrentGeneration)
+        {
+        LinkGeneration[Link] = CurrentGeneration;
+        LinkCost[Link] = (*Cost)(Link);
+        }
+
+    return LinkCost[Link];
+}
+
+void ShortestPathSearch::relax(Direction &D, unsigned int Node, double Distance,
+                               int Link)
+{
+    if (!isReached(D, Node))
+        {
+        D.Generation[Node] = CurrentGeneration;
+        D.Distance[Node] = Distance;
+        D.Precedent[Node] = Link;
+        D.Position[Node] = D.Heap.size();
+        D.Heap.push_back({Distance, Node});
+        sift_Up(D, D.Heap.size() - 1);
+        }
+    else if (D.Position[Node] != Settled && Distance < D.Distance[Node])
+        {
+        D.Distance[Node] = Distance;
+        D.Precedent[Node] = Link;
+        D.Heap[D.Position[Node]].Key = Distance;
+        sift_Up(D, D.Position[Node]);
+        }
+}
+
+unsigned int ShortestPathSearch::settle(Direction &D)
+{
+    unsigned int Node = D.Heap.front().Node;
+    D.Position[Node] = Settled;
+
+    D.Heap.front() = D.Heap.back();
+    D.Heap.pop_back();
+    if (!D.Heap.empty())
+        {
+        D.Position[D.Heap.front().Node] = 0;
+        sift_Down(D, 0);
+        }
+
+    return Node;
+}
+
+void ShortestPathSearch::sift_Up(Direction &D, uint32_t Position)
+{
+    HeapEntry Entry = D.Heap[Position];
+
+    while (Position > 0)
+        {
+        uint32_t Parent = (Position - 1) / Arity;
+        if (D.Heap[Parent].Key <= Entry.Key)
+            {
+            break;
+            }
+        D.Heap[Position] = D.Heap[Parent];
+        D.Position[D.Heap[Position].Node] = Position;
+        Position = Parent;
+        }
+
+    D.Heap[Position] = Entry;
+    D.Position[Entry.Node] = Position;
+}
+
+void ShortestPathSearch::sift_Down(Direction &D, uint32_t Position)
+{
+    HeapEntry Entry = D.Heap[Position];
+    uint32_t Size = D.Heap.size();
+
+    while (true)
+        {
+        uint32_t FirstChild = Position * Arity + 1;
+        if (FirstChild >= Size)
+            {
+            break;
+            }
+
+        uint32_t Smallest = FirstChild;
+        uint32_t LastChild = std::min(FirstChild + Arity, Size);
+        for (uint32_t child = FirstChild + 1; child < LastChild; child++)
+            {
+            if (D.Heap[child].Key < D.Heap[Smallest].Key)
+                {
+                Smallest = child;
+                }
+            }
+
+        if (Entry.Key <= D.Heap[Smallest].Key)
+            {
+            break;
+            }
+        D.Heap[Position] = D.Heap[Smallest];
+        D.Position[D.Heap[Position].Node] = Position;
+        Position = Smallest;
+        }
+
+    D.Heap[Position] = Entry;
+    D.Position[Entry.Node] = Position;
+}
+
+void ShortestPathSearch::search_Forward(unsigned int Origin, unsigned int Destination)
+{
+    relax(Forward, Origin, 0, -1);
+
+    while (!Forward.Heap.empty())
+        {
+        unsigned int CurrentNode = settle(Forward);
+
+        if (CurrentNode == Destination)
+            {
+            break;
+            }
+
+        for (unsigned int e = G->FirstEdge[CurrentNode];
+                e < G->FirstEdge[CurrentNode + 1]; ++e)
+            {
+            unsigned int node = G->EdgeTarget[e];
+
+            if (isSettled(Forward, node) || !G->is_NodeActive(node))
+                {
+                continue;
+                }
+
+            double LCost = get_LinkCost(G->EdgeLink[e]);
+            if (LCost >= std::numeric_limits<double>::max())
+                {
+                continue;
+                }
+
+            relax(Forward, node, Forward.Distance[CurrentNode] + LCost, G->EdgeLink[e]);
+            }
+        }
+}
+
+unsigned int ShortestPathSearch::search_Bidirectional(unsigned int Origin,
+        unsigned int Destination)
+{
+    //As in the forward search, the path can not arrive at an inactive node
+    if (!G->is_NodeActive(Destination))
+        {
+        return G->NumNodes;
+        }
+
+    relax(Forward, Origin, 0, -1);
+    relax(Backward, Destination, 0, -1);
+
+    double MinDistance = std::numeric_limits<double>::infinity();
+    unsigned int Meeting = G->NumNodes;
+
+    while (!Forward.Heap.empty() && !Backward.Heap.empty() &&
+            Forward.Heap.front().Key + Backward.Heap.front().Key < MinDistance)
+        {
+        bool isForward = Forward.Heap.front().Key <= Backward.Heap.front().Key;
+        Direction &D = isForward ? Forward : Backward;
+        Direction &Opposite = isForward ? Backward : Forward;
+        const std::vector<unsigned int> &FirstEdge = isForward ? G->FirstEdge :
+                G->FirstInEdge;
+        const std::vector<unsigned int> &EdgeNode = isForward ? G->EdgeTarget :
+                G->InEdgeSource;
+        const std::vector<unsigned int> &EdgeLink = isForward ? G->EdgeLink :
+                G->InEdgeLink;
+
+        unsigned int CurrentNode = settle(D);
+
+        for (unsigned int e = FirstEdge[CurrentNode]; e < FirstEdge[CurrentNode + 1]; ++e)
+            {
+            unsigned int node = EdgeNode[e];
+
+            if (isSettled(D, node) || (!G->is_NodeActive(node) && node != Origin))
+                {
+                continue;
+                }
+
+            double LCost = get_LinkCost(EdgeLink[e]);
+            if (LCost >= std::numeric_limits<double>::max())
+                {
+                continue;
+                }
+
+            relax(D, node, D.Distance[CurrentNode] + LCost, EdgeLink[e]);
+
+            if (isReached(Opposite, node) &&
+                    D.Distance[node] + Opposite.Distance[node] < MinDistance)
+                {
+                MinDistance = D.Distance[node] + Opposite.Distance[node];
+                Meeting = node;
+                }
+            }
+        }
+
+    return Meeting;
+}
@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <GeneralClasses/ModulationScheme.h>
 #include <RMSA/Route.h>
+#include <GeneralClasses/Profiler.h>
 #include <RMSA/RoutingAlgorithms/RoutingAlgorithm.h>
 #include <RMSA/SpectrumAssignmentAlgorithms/SpectrumAssignmentAlgorithm.h>
 #include <RMSA/RegeneratorPlacementAlgorithms/RegeneratorPlacementAlgorithm.h>
@@ -61,7 +62,10 @@ RoutingWavelengthAssignment::routeCall_Transparent(std::shared_ptr<Call> C)
         {
         auto scheme = *schPtr;
         C->Scheme = scheme;
-        possibleRoutes = R_Alg->route(C);
+            {
+            PROFILE_PHASE(Routing);
+            possibleRoutes = R_Alg->route(C);
+            }
 
         //There's no route
         if (possibleRoutes.empty() || possibleRoutes.front().empty())
@@ -80,7 +84,11 @@ RoutingWavelengthAssignment::routeCall_Transparent(std::shared_ptr<Call> C)
 
             TransparentSegment Segment(route, scheme, 0);
 
-            auto SegmentSlots = WA_Alg->assignSlots(C, Segment);
+            mapSlots SegmentSlots;
+                {
+                PROFILE_PHASE(SpectrumAssignment);
+                SegmentSlots = WA_Alg->assignSlots(C, Segment);
+                }
             if (SegmentSlots.empty())
                 {
                 if (scheme == *(Schemes.begin()))
@@ -142,7 +150,10 @@ RoutingWavelengthAssignment::routeCall_Translucent(std::shared_ptr<Call> C)
     mapSlots Slots;
 
     RA_Alg->thisRMSA = this;
-    possibleRoutes = R_Alg->route(C);
+        {
+        PROFILE_PHASE(Routing);
+        possibleRoutes = R_Alg->route(C);
+        }
 
     //There's no route
     if (possibleRoutes.empty() || possibleRoutes.front().empty())
@@ -156,7 +167,10 @@ RoutingWavelengthAssignment::routeCall_Translucent(std::shared_ptr<Call> C)
         {
         C->Status = Call::Not_Evaluated;
         C->blockingReason = 0x0;
-        Segments = RA_Alg->assignRegenerators(C, route);
+            {
+            PROFILE_PHASE(RegeneratorAssignment);
+            Segments = RA_Alg->assignRegenerators(C, route);
+            }
 
         //There are no regenerators
         if (Segments.empty())
@@ -170,7 +184,11 @@ RoutingWavelengthAssignment::routeCall_Translucent(std::shared_ptr<Call> C)
 
         for (auto &segment : Segments)
             {
-            auto SegmentSlots = WA_Alg->assignSlots(C, segment);
+            mapSlots SegmentSlots;
+                {
+                PROFILE_PHASE(SpectrumAssignment);
+                SegmentSlots = WA_Alg->assignSlots(C, segment);
+                }
 
             //There's no spectrum inside a transparent segment
             if (SegmentSlots.empty())
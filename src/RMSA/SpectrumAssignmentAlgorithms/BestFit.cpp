@@ -20,42 +20,16 @@ mapSlots BestFit::assignSlots(std::shared_ptr<Call> C, TransparentSegment Seg)
         std::owner_less<std::weak_ptr<Link>>> Slots;
     Slots.clear();
 
-    bool SlotsAvailability[Link::NumSlots + 1];
     std::set<std::pair<int, int>> PossibleBlocks;
 
-    for (int i = 0; i < Link::NumSlots; i++)
+    Seg.get_FreeSlots().for_each_Run([&PossibleBlocks, RequiredSlots](unsigned Begin,
+                                     unsigned End)
         {
-        SlotsAvailability[i] = true;
-        }
-    SlotsAvailability[Link::NumSlots] = false;
-
-    for (auto &link : Seg.Links)
-        {
-        auto locklink = link.lock();
-
-        for (auto &slot : locklink->Slots)
+        if ((int)(End - Begin) >= RequiredSlots)
             {
-            SlotsAvailability[slot->numSlot] &= slot->isFree;
+            PossibleBlocks.emplace(End - Begin, Begin);
             }
-        }
-
-    int CurrentFreeSlots = 0;
-
-    for (int sf = 0; sf <= Link::NumSlots; sf++)
-        {
-        if (SlotsAvailability[sf])
-            {
-            CurrentFreeSlots++;
-            }
-        else
-            {
-            if (CurrentFreeSlots != 0 && CurrentFreeSlots >= RequiredSlots)
-                {
-                PossibleBlocks.emplace(CurrentFreeSlots, sf - CurrentFreeSlots);
-                }
-            CurrentFreeSlots = 0;
-            }
-        }
+        });
 
     if (!PossibleBlocks.empty())
         {
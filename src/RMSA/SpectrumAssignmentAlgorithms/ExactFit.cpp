@@ -20,60 +20,24 @@ mapSlots ExactFit::assignSlots(std::shared_ptr<Call> C, TransparentSegment Seg)
         std::owner_less<std::weak_ptr<Link>>> Slots;
     Slots.clear();
 
-    bool SlotsAvailability[Link::NumSlots];
+    int si = -1;
 
-    for (int i = 0; i < Link::NumSlots; i++)
+    //Looks for the first "spectral hole" with exactly RequiredSlots slots.
+    Seg.get_FreeSlots().for_each_Run([&si, RequiredSlots](unsigned Begin, unsigned End)
         {
-        SlotsAvailability[i] = true;
-        }
-
-    for (auto &link : Seg.Links)
-        {
-        auto locklink = link.lock();
-
-        for (auto &slot : locklink->Slots)
-            {
-            SlotsAvailability[slot->numSlot] &= slot->isFree;
-            }
-        }
-
-    int CurrentFreeSlots = 0;
-    int si = -1, sf = 0;
-
-    for (sf = 0; sf < Link::NumSlots; sf++)
-        {
-        if (SlotsAvailability[sf])
-            {
-            CurrentFreeSlots++;
-            }
-        else
+        if (si == -1 && (int)(End - Begin) == RequiredSlots)
             {
-            CurrentFreeSlots = 0;
+            si = Begin;
             }
-
-        //Found a "spectral hole" with exactly RequiredSlots slots.
-        if ((CurrentFreeSlots == RequiredSlots) &&
-                ((sf == Link::NumSlots - 1) || !SlotsAvailability[sf + 1]))
-            {
-            si = sf - RequiredSlots + 1;
-            break;
-            }
-        }
+        });
 
     if (si != -1)
         {
-#ifdef RUN_ASSERTIONS
-        if (sf != si + RequiredSlots - 1)
-            {
-            std::cerr << "Error in Wavelength Assignment" << std::endl;
-            abort();
-            }
-#endif
         for (auto &link : Seg.Links)
             {
             Slots.emplace(link, std::vector<std::weak_ptr<Slot>>
                           (link.lock()->Slots.begin() + si,
-                           link.lock()->Slots.begin() + sf + 1));
+                           link.lock()->Slots.begin() + si + RequiredSlots));
             }
         return Slots;
         }
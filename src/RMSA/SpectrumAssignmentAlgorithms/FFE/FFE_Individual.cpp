@@ -23,7 +23,7 @@ void FFE_Individual::createIndividual()
 {
     for (auto &nS : SpectrumAssignmentAlgorithm::possibleRequiredSlots)
         {
-        Gene[nS] = std::vector<int>(Link::NumSlots);
+        Gene[nS] = std::vector<int>(G->GA->Sim.T->get_NumSlots());
         std::iota(Gene[nS].begin(), Gene[nS].end(), 0);
         std::random_shuffle(Gene[nS].begin(), Gene[nS].end());
         }
@@ -31,7 +31,7 @@ void FFE_Individual::createIndividual()
 
 int FFE_Individual::createGene(unsigned int g)
 {
-    std::uniform_int_distribution<unsigned int> dist(0, Link::NumSlots - 1);
+    std::uniform_int_distribution<unsigned int> dist(0, G->GA->Sim.T->get_NumSlots() - 1);
     unsigned int newGene;
 
     do
@@ -45,7 +45,7 @@ int FFE_Individual::createGene(unsigned int g)
 
 void FFE_Individual::eval()
 {
-    auto TCopy = std::make_shared<Topology>(*(G->GA->Sim.T));
+    auto TCopy = G->GA->Sim.Replicas->acquire();
 
     std::shared_ptr<ROUT::RoutingAlgorithm> R_Alg =
         ROUT::RoutingAlgorithm::create_RoutingAlgorithm(G->GA->Sim.Routing_Algorithm,
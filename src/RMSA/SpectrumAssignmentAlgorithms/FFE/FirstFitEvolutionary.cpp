@@ -49,25 +49,11 @@ std::map<std::weak_ptr<Link>,
         std::owner_less<std::weak_ptr<Link>>> Slots;
     Slots.clear();
 
-    bool SlotsAvailability[Link::NumSlots];
-    for (int i = 0; i < Link::NumSlots; i++)
-        {
-        SlotsAvailability[i] = true;
-        }
-
-    for (auto &link : Seg.Links)
-        {
-        auto locklink = link.lock();
-
-        for (auto &slot : locklink->Slots)
-            {
-            SlotsAvailability[slot->numSlot] &= slot->isFree;
-            }
-        }
+    SlotBitset SlotsAvailability = Seg.get_FreeSlots();
 
     for (auto si : slotsList[RequiredSlots])
         {
-        if (si + RequiredSlots - 1 >= Link::NumSlots)
+        if (si + RequiredSlots - 1 >= (int) SlotsAvailability.size())
             {
             continue;
             }
@@ -75,7 +61,7 @@ std::map<std::weak_ptr<Link>,
         bool freeSlots = true;
         for (int s = si; (s < si + RequiredSlots) && freeSlots; ++s)
             {
-            freeSlots &= SlotsAvailability[s];
+            freeSlots &= SlotsAvailability.test(s);
             }
 
         if (freeSlots)
@@ -129,7 +115,7 @@ void FirstFitEvolutionary::load()
         {
         std::cin >> filename;
 
-        if (std::cin.fail() || !initDefaultList(filename))
+        if (std::cin.fail() || !initDefaultList(filename, T->get_NumSlots()))
             {
             std::cin.clear();
             std::cin.ignore();
@@ -148,7 +134,7 @@ void FirstFitEvolutionary::load()
     hasLoaded = true;
 }
 
-bool FirstFitEvolutionary::initDefaultList(std::string Filename)
+bool FirstFitEvolutionary::initDefaultList(std::string Filename, int NumSlots)
 {
     using namespace boost::program_options;
 
@@ -183,7 +169,7 @@ bool FirstFitEvolutionary::initDefaultList(std::string Filename)
         for (auto &nSlot : possibleRequiredSlots)
             {
             defaultSlotsList[nSlot] = std::vector<int>();
-            for (int s = 0; s < Link::NumSlots; ++s)
+            for (int s = 0; s < NumSlots; ++s)
                 {
                 FFEList >> currentslot;
                 defaultSlotsList[nSlot].push_back(currentslot);
@@ -19,53 +19,11 @@ mapSlots FirstFit::assignSlots(std::shared_ptr<Call> C, TransparentSegment Seg)
         std::owner_less<std::weak_ptr<Link>>> Slots;
     Slots.clear();
 
-    bool SlotsAvailability[Link::NumSlots];
-
-    for (int i = 0; i < Link::NumSlots; i++)
-        {
-        SlotsAvailability[i] = true;
-        }
-
-    for (auto &link : Seg.Links)
-        {
-        auto locklink = link.lock();
-
-        for (auto &slot : locklink->Slots)
-            {
-            SlotsAvailability[slot->numSlot] &= slot->isFree;
-            }
-        }
-
-    int CurrentFreeSlots = 0;
-    int si = -1, sf = 0;
-
-    for (sf = 0; sf < Link::NumSlots; sf++)
-        {
-        if (SlotsAvailability[sf])
-            {
-            CurrentFreeSlots++;
-            }
-        else
-            {
-            CurrentFreeSlots = 0;
-            }
-
-        if (CurrentFreeSlots == RequiredSlots)
-            {
-            si = sf - RequiredSlots + 1;
-            break;
-            }
-        }
+    int si = Seg.get_FreeSlots().find_FirstRun(RequiredSlots);
+    int sf = si + RequiredSlots - 1;
 
     if (si != -1)
         {
-#ifdef RUN_ASSERTIONS
-        if (sf != si + RequiredSlots - 1)
-            {
-            std::cerr << "Error in Wavelength Assignment" << std::endl;
-            abort();
-            }
-#endif
         for (auto &link : Seg.Links)
             {
             Slots.emplace(link, std::vector<std::weak_ptr<Slot>>
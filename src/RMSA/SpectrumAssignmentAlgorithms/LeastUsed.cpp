@@ -19,24 +19,14 @@ mapSlots LeastUsed::assignSlots(std::shared_ptr<Call> C, TransparentSegment Seg)
         std::owner_less<std::weak_ptr<Link>>> Slots;
     Slots.clear();
 
-    std::vector<bool> SlotsAvailability(Link::NumSlots, true);
-    std::vector<int> SlotsUsage(Link::NumSlots, std::numeric_limits<int>::max());
-
-    for (auto &link : Seg.Links)
-        {
-        auto locklink = link.lock();
-
-        for (auto &slot : locklink->Slots)
-            {
-            SlotsAvailability[slot->numSlot] = SlotsAvailability[slot->numSlot]
-                                               && slot->isFree;
-            }
-        }
+    SlotBitset SlotsAvailability = Seg.get_FreeSlots();
+    int NumSlots = SlotsAvailability.size();
+    std::vector<int> SlotsUsage(NumSlots, std::numeric_limits<int>::max());
 
     //Computes in how many links is the s-th slot used.
-    for (int s = 0; s < Link::NumSlots; s++)
+    for (int s = 0; s < NumSlots; s++)
         {
-        if (!SlotsAvailability[s])
+        if (!SlotsAvailability.test(s))
             {
             continue;
             }
@@ -62,7 +52,7 @@ mapSlots LeastUsed::assignSlots(std::shared_ptr<Call> C, TransparentSegment Seg)
             }
 
         //There aren't enough slots after this slot to accomodate the requisition
-        if (possibleInitSlot + RequiredSlots - 1 > Link::NumSlots)
+        if (possibleInitSlot + RequiredSlots > NumSlots)
             {
             SlotsUsage[possibleInitSlot] = std::numeric_limits<int>::max();
             continue;
@@ -72,7 +62,7 @@ mapSlots LeastUsed::assignSlots(std::shared_ptr<Call> C, TransparentSegment Seg)
         bool validSlot = true;
         for (int s = possibleInitSlot; s < possibleInitSlot + RequiredSlots; ++s)
             {
-            validSlot &= SlotsAvailability[s];
+            validSlot &= SlotsAvailability.test(s);
             if (!validSlot)
                 {
                 break;
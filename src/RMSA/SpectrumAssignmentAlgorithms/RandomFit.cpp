@@ -1,5 +1,4 @@
 #include "include/RMSA/SpectrumAssignmentAlgorithms/RandomFit.h"
-#include <GeneralClasses/RandomGenerator.h>
 #include <Calls/Call.h>
 #include <Structure/Link.h>
 #include <Structure/Slot.h>
@@ -19,47 +18,20 @@ mapSlots RandomFit::assignSlots(std::shared_ptr<Call> C, TransparentSegment Seg)
         std::owner_less<std::weak_ptr<Link>>> Slots;
     std::vector<int> PossibleLastSlots;
 
-    bool SlotsAvailability[Link::NumSlots];
-
-    for (int i = 0; i < Link::NumSlots; i++)
+    Seg.get_FreeSlots().for_each_Run([&PossibleLastSlots, RequiredSlots](unsigned Begin,
+                                     unsigned End)
         {
-        SlotsAvailability[i] = true;
-        }
-
-    for (auto &link : Seg.Links)
-        {
-        auto locklink = link.lock();
-
-        for (auto &slot : locklink->Slots)
-            {
-            SlotsAvailability[slot->numSlot] &= slot->isFree;
-            }
-        }
-
-    int CurrentFreeSlots = 0;
-
-    for (int sf = 0; sf < Link::NumSlots; sf++)
-        {
-        if (SlotsAvailability[sf])
-            {
-            CurrentFreeSlots++;
-            }
-        else
-            {
-            CurrentFreeSlots = 0;
-            }
-
-        if (CurrentFreeSlots >= RequiredSlots)
+        for (int sf = Begin + RequiredSlots - 1; sf < (int) End; sf++)
             {
             PossibleLastSlots.push_back(sf);
             }
-        }
+        });
 
     if (!PossibleLastSlots.empty())
         {
         std::uniform_int_distribution<int> SlotChoose(0, PossibleLastSlots.size() - 1);
         auto SF = PossibleLastSlots.begin();
-        std::advance(SF, SlotChoose(random_generator));
+        std::advance(SF, SlotChoose(Stream));
 
         for (auto &link : Seg.Links)
             {
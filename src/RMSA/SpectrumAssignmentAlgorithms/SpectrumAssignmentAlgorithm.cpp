@@ -27,7 +27,8 @@ SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithmNicknames =
 SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithm(
     std::shared_ptr<Topology> T,
     SpectrumAssignmentAlgorithms WavAssAlgType) :
-    SpecAssAlgType(WavAssAlgType), T(T)
+    SpecAssAlgType(WavAssAlgType), T(T),
+    Stream(0, 0, RandomGenerator::SpectrumAssignmentStream)
 {
     for (auto &scheme : ModulationScheme::DefaultSchemes)
         {
@@ -3,6 +3,7 @@
 #include <Structure/Node.h>
 #include <Structure/Topology.h>
 #include <Calls/Call.h>
+#include <GeneralClasses/Profiler.h>
 
 using namespace RMSA;
 
@@ -31,6 +32,8 @@ TransparentSegment::TransparentSegment(const TransparentSegment &segment) :
 
 Signal TransparentSegment::bypass(Signal S)
 {
+    PROFILE_PHASE(QualityOfTransmission);
+
     S = Links.front().lock()->Origin.lock()->add(S);
 
     if(considerFilterImperfection)
@@ -59,100 +62,35 @@ Signal TransparentSegment::bypass(Signal S)
     return S;
 }
 
-unsigned int TransparentSegment::get_MaxContigSlots()
+SlotBitset TransparentSegment::get_FreeSlots() const
 {
-
-    std::vector<bool> SlotsAvailability(Link::NumSlots, true);
-
-    for (auto &link : Links)
+    if (Links.empty())
         {
-        auto linklock = link.lock();
-
-        for (int i = 0; i < Link::NumSlots; i++)
-            {
-            SlotsAvailability[i] = SlotsAvailability[i] &&
-                                   linklock->isSlotFree(i);
-            }
+        return SlotBitset(Link::DefaultNumSlots, true);
         }
 
-    unsigned MaxSlots = 0;
-    unsigned CurrentFreeSlots = 0;
+    //The links of a segment share the same grid.
+    SlotBitset FreeSlots = Links.front().lock()->get_FreeSlots();
 
-    for (bool slot : SlotsAvailability)
+    for (auto it = Links.begin() + 1; it != Links.end(); ++it)
         {
-        if (slot)
-            {
-            CurrentFreeSlots++;
-            }
-        else
-            {
-            CurrentFreeSlots = 0;
-            }
-
-        if (CurrentFreeSlots > MaxSlots)
-            {
-            MaxSlots = CurrentFreeSlots;
-            }
+        FreeSlots &= it->lock()->get_FreeSlots();
         }
 
-    return MaxSlots;
+    return FreeSlots;
 }
 
-int TransparentSegment::get_Contiguity(std::shared_ptr<Call> C) const
+unsigned int TransparentSegment::get_MaxContigSlots()
 {
-    int NumRequiredSlots = ModScheme.get_NumSlots(C->Bitrate);
-    int Contiguity = 0;
-    int CurrentFreeSlots = 0;
-
-    auto Slots = std::vector<bool>(Link::NumSlots, true);
-    for (auto &link : Links)
-        {
-        for (size_t i = 0; i < Slots.size(); ++i)
-            {
-            Slots[i] = Slots[i] && link.lock()->isSlotFree(i);
-            }
-        }
-
-    for (int s = 0; s < Link::NumSlots; s++)
-        {
-        if (Slots[s])
-            {
-            CurrentFreeSlots++;
-            }
-        else
-            {
-            CurrentFreeSlots = 0;
-            }
-
-        if (CurrentFreeSlots >= NumRequiredSlots)
-            {
-            Contiguity++;
-            }
-        }
+    return get_FreeSlots().get_LongestRun();
+}
 
-    return Contiguity;
+int TransparentSegment::get_Contiguity(std::shared_ptr<Call> C) const
+{
+    return get_FreeSlots().get_NumPositions(ModScheme.get_NumSlots(C->Bitrate));
 }
 
 int TransparentSegment::get_Availability() const
 {
-    auto Slots = std::vector<bool>(Link::NumSlots, true);
-    for (auto &link : Links)
-        {
-        for (size_t i = 0; i < Slots.size(); ++i)
-            {
-            Slots[i] = Slots[i] && link.lock()->isSlotFree(i);
-            }
-        }
-
-    int FreeSlots = 0;
-
-    for (auto slot : Slots)
-        {
-        if (slot)
-            {
-            FreeSlots++;
-            }
-        }
-
-    return FreeSlots;
+    return get_FreeSlots().count();
 }
@@ -0,0 +1,194 @@
+#include <SimulationTypes/NetworkFork.h>
+#include <RMSA/Route.h>
+#include <Structure/Link.h>
+#include <Structure/Node.h>
+#include <Structure/Slot.h>
+#include <Structure/RoutingGraph.h>
+#include <Structure/Topology.h>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <iostream>
+
+using namespace Simulations;
+
+namespace
+{
+NetworkFork::Connection get_Connection(const RMSA::Route &R)
+{
+    NetworkFork::Connection C;
+
+    for (auto &link : R.Slots)
+        {
+        unsigned int l = link.first.lock()->Index;
+        for (auto &slot : link.second)
+            {
+            C.Slots.push_back({l, (unsigned int) slot.lock()->numSlot});
+            }
+        }
+
+    for (auto &reg : R.Regenerators)
+        {
+        C.Regenerators.push_back({reg.first.lock()->Index, reg.second});
+        }
+
+    return C;
+}
+}
+
+NetworkFork::NetworkFork(std::shared_ptr<Topology> T, double Time) : T(T),
+    State(T->get_State().fork()), Time(Time),
+    SharedDepartures(std::make_shared<std::vector<Departure>>()),
+    NextSharedDeparture(0)
+{
+    //Built here, as the forks may ask for it from several threads
+    T->get_RoutingGraph();
+}
+
+std::shared_ptr<NetworkFork> NetworkFork::fork()
+{
+    share_Departures();
+
+    auto Fork = std::make_shared<NetworkFork>(*this);
+    Fork->State = State->fork();
+    Fork->Graph = nullptr;
+    return Fork;
+}
+
+void NetworkFork::add_Departure(const RMSA::Route &R, double EndingTime)
+{
+    OwnDepartures.push_back({EndingTime, std::make_shared<Connection>(get_Connection(R))});
+    std::push_heap(OwnDepartures.begin(), OwnDepartures.end(),
+                   std::greater<Departure>());
+}
+
+void NetworkFork::implement(const RMSA::Route &R, double EndingTime)
+{
+    implement(get_Connection(R), EndingTime);
+}
+
+void NetworkFork::implement(Connection C, double EndingTime)
+{
+    for (auto &slot : C.Slots)
+        {
+        State->edit_Link(slot.first).use_Slot(slot.second);
+        }
+
+    for (auto &reg : C.Regenerators)
+        {
+        NetworkState::NodeState &NState = State->edit_Node(reg.first);
+        NState.NumUsedRegenerators += reg.second;
+        NState.TotalNumRequestedRegenerators += reg.second;
+        NState.MaxSimultUsedRegenerators = std::max(NState.MaxSimultUsedRegenerators,
+                                           NState.NumUsedRegenerators);
+        }
+
+    OwnDepartures.push_back({EndingTime, std::make_shared<Connection>(std::move(C))});
+    std::push_heap(OwnDepartures.begin(), OwnDepartures.end(),
+                   std::greater<Departure>());
+}
+
+void NetworkFork::advance(double Time)
+{
+#ifdef RUN_ASSERTIONS
+    if (Time < this->Time)
+        {
+        std::cerr << "A fork can not go back in time." << std::endl;
+        abort();
+        }
+#endif
+
+    while (true)
+        {
+        bool hasShared = NextSharedDeparture < SharedDepartures->size() &&
+                         (*SharedDepartures)[NextSharedDeparture].t <= Time;
+        bool hasOwn = !OwnDepartures.empty() && OwnDepartures.front().t <= Time;
+
+        if (hasShared && (!hasOwn ||
+                          (*SharedDepartures)[NextSharedDeparture].t <= OwnDepartures.front().t))
+            {
+            release(*(*SharedDepartures)[NextSharedDeparture++].Resources);
+            }
+        else if (hasOwn)
+            {
+            release(*OwnDepartures.front().Resources);
+            std::pop_heap(OwnDepartures.begin(), OwnDepartures.end(),
+                          std::greater<Departure>());
+            OwnDepartures.pop_back();
+            }
+        else
+            {
+            break;
+            }
+        }
+
+    this->Time = Time;
+}
+
+int NetworkFork::find_FirstFit(const std::vector<unsigned int> &LinkIndices,
+                               unsigned int NumSlots) const
+{
+    if (LinkIndices.empty())
+        {
+        return -1;
+        }
+
+    SlotBitset FreeSlots = State->get_Link(LinkIndices.front()).FreeSlots;
+    for (auto l : LinkIndices)
+        {
+        FreeSlots &= State->get_Link(l).FreeSlots;
+        }
+
+    return FreeSlots.find_FirstRun(NumSlots);
+}
+
+unsigned int NetworkFork::get_NumPendingDepartures() const
+{
+    return SharedDepartures->size() - NextSharedDeparture + OwnDepartures.size();
+}
+
+const RoutingGraph &NetworkFork::get_RoutingGraph()
+{
+    if (!Graph)
+        {
+        Graph = std::make_shared<RoutingGraph>(T->get_RoutingGraph(), State);
+        }
+
+    return *Graph;
+}
+
+void NetworkFork::release(const Connection &C)
+{
+    for (auto &slot : C.Slots)
+        {
+        State->edit_Link(slot.first).free_Slot(slot.second);
+        }
+
+    for (auto &reg : C.Regenerators)
+        {
+        State->edit_Node(reg.first).NumUsedRegenerators -= reg.second;
+        }
+}
+
+void NetworkFork::share_Departures()
+{
+    if (OwnDepartures.empty())
+        {
+        return;
+        }
+
+    auto isEarlier = [](const Departure & a, const Departure & b)
+        {
+        return a.t < b.t;
+        };
+    std::sort(OwnDepartures.begin(), OwnDepartures.end(), isEarlier);
+
+    auto Merged = std::make_shared<std::vector<Departure>>();
+    Merged->reserve(get_NumPendingDepartures());
+    std::merge(SharedDepartures->begin() + NextSharedDeparture, SharedDepartures->end(),
+               OwnDepartures.begin(), OwnDepartures.end(), std::back_inserter(*Merged), isEarlier);
+
+    SharedDepartures = Merged;
+    NextSharedDeparture = 0;
+    OwnDepartures.clear();
+}
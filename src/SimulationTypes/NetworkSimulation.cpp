@@ -1,10 +1,30 @@
 #include <SimulationTypes/NetworkSimulation.h>
+#include <SimulationTypes/NetworkFork.h>
 #include <Structure/Slot.h>
 #include <RMSA/Route.h>
 #include <Calls.h>
 #include <RMSA/RoutingWavelengthAssignment.h>
-#include <iostream>
+#include <RMSA/RoutingAlgorithms/RoutingAlgorithm.h>
+#include <RMSA/SpectrumAssignmentAlgorithms/SpectrumAssignmentAlgorithm.h>
 #include <Structure/Link.h>
+#include <GeneralClasses/BinaryStream.h>
+#include <GeneralClasses/Profiler.h>
+#include <GeneralClasses/MetricsStream.h>
+#include <Structure/Node.h>
+#include <Structure/RoutingGraph.h>
+#include <Structure/Topology.h>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+const char CheckpointMagic[8] = {'S', 'I', 'M', 'E', 'O', 'N', 'C', 'K'};
+constexpr uint32_t CheckpointVersion = 5;
+}
 
 using namespace Simulations;
 using namespace RMSA;
@@ -20,104 +40,388 @@ NetworkSimulation::NetworkSimulation(std::shared_ptr<CallGenerator> Generator,
                 NumBlockedCalls_Spectrum =
                     NumBlockedCalls_ASE_Noise =
                         NumBlockedCalls_FilterImperfection = 0;
-    hasSimulated = false;
+    hasSimulated = hasConverged = false;
+    TargetRelativeHalfWidth = 0;
+    ConfidenceLevel = 0.95;
+    WarmupDeletion = RecordBlockingHistory = false;
+    NumWarmupCalls = WarmupTruncationPoint = 0;
+    NumOccupiedSlots = 0;
+    CheckpointInterval = 0;
+    CheckpointParametersHash = 0;
+    isResumed = false;
+    MetricsCallInterval = 0;
+    MetricsTimeInterval = NextMetricsTime = 0;
+    IntervalNumCalls = IntervalNumBlockedCalls = 0;
+    NumDisruptedCalls = NumRestoredCalls = 0;
 }
 
 void NetworkSimulation::run()
 {
-    NumCalls++;
-    Generator->generate_Call(); //Generates first call
+    if (!MetricsFileName.empty())
+        {
+        Metrics = std::make_shared<MetricsStream>(MetricsFileName,
+                  MetricsStream::DefaultCapacity, isResumed);
+
+        //A resumed simulation continues the interval of its checkpoint
+        if (!isResumed)
+            {
+            NextMetricsTime = MetricsTimeInterval > 0 ? (std::floor(
+                                  Generator->simulationTime / MetricsTimeInterval) + 1) * MetricsTimeInterval : 0;
+            IntervalNumCalls = IntervalNumBlockedCalls = 0;
+            }
+        }
+
+    if (!isResumed)
+        {
+        Connections.reset(Generator->T->Links.size(), Generator->T->Nodes.size());
+        NumCalls++;
+        Generator->generate_Call(); //Generates first call
+        }
+    isResumed = false;
 
     while (!Generator->Events.empty())
         {
-        std::shared_ptr<Event> evt(Generator->Events.top());
+        Event evt = Generator->Events.top();
         Generator->Events.pop();
 
-        if (evt->Type == Event::CallRequisition)
+        if (evt.Type == Event::CallRequisition)
             {
             implement_call(evt);
+
+            //Only implemented calls occupy resources until their ending.
+            if (Generator->get_Call(evt.Parent)->Status == Call::Implemented)
+                {
+                Generator->schedule_CallEnding(evt.Parent);
+                }
+            else
+                {
+                Generator->release_Call(evt.Parent);
+                }
+
+            if (CheckpointInterval > 0 && NumCalls % CheckpointInterval == 0)
+                {
+                save_Checkpoint(CheckpointFileName);
+                }
+
+            if (Metrics &&
+                    ((MetricsCallInterval > 0 && NumCalls % MetricsCallInterval == 0) ||
+                     (MetricsTimeInterval > 0 && evt.t >= NextMetricsTime)))
+                {
+                emit_Metrics(evt.t);
+                }
             }
-        else if (evt->Type == Event::CallEnding)
+        else if (evt.Type == Event::CallEnding)
             {
             drop_call(evt);
+            Generator->release_Call(evt.Parent);
+            }
+        else if (evt.Type == Event::LinkFailure || evt.Type == Event::NodeFailure)
+            {
+            fail_Element(evt);
+            }
+        else
+            {
+            repair_Element(evt);
             }
         }
 
+    //Waits for the remaining samples to be written
+    Metrics.reset();
     hasSimulated = true;
 }
 
-void NetworkSimulation::implement_call(std::shared_ptr<Event> evt)
+void NetworkSimulation::implement_call(const Event &evt)
 {
-    auto route = RMSA->routeCall(evt->Parent);
-    evt->Parent->CallEnding.lock()->route = evt->route = route;
+    std::shared_ptr<Call> C = Generator->get_Call(evt.Parent);
+    auto route = C->route = RMSA->routeCall(C);
 
 #ifdef RUN_ASSERTIONS
-    if (evt->Parent->Status == Call::Not_Evaluated)
+    if (C->Status == Call::Not_Evaluated)
         {
         std::cerr << "Call was neither accepted nor blocked." << std::endl;
         abort();
         }
 #endif
 
-    if (evt->Parent->Status == Call::Blocked)
+    if (C->Status == Call::Blocked)
         {
-        NumBlockedCalls_Route += (evt->Parent->blockingReason & Call::Blocking_Route) != 0;
-        NumBlockedCalls_ASE_Noise += (evt->Parent->blockingReason & Call::Blocking_ASE_Noise) != 0;
-        NumBlockedCalls_FilterImperfection += (evt->Parent->blockingReason & Call::Blocking_FilterImperfection) != 0;
-        NumBlockedCalls_Spectrum += (evt->Parent->blockingReason & Call::Blocking_Spectrum) != 0;
+        NumBlockedCalls_Route += (C->blockingReason & Call::Blocking_Route) != 0;
+        NumBlockedCalls_ASE_Noise += (C->blockingReason & Call::Blocking_ASE_Noise) != 0;
+        NumBlockedCalls_FilterImperfection += (C->blockingReason & Call::Blocking_FilterImperfection) != 0;
+        NumBlockedCalls_Spectrum += (C->blockingReason & Call::Blocking_Spectrum) != 0;
         NumBlockedCalls++;
         }
     else
         {
-        unsigned int auxCount = 0;
-        for (auto &link : route->Slots)
+        use_Route(C);
+        Connections.insert(evt.Parent, *route);
+        }
+
+    IntervalNumCalls++;
+    IntervalNumBlockedCalls += (C->Status == Call::Blocked);
+
+    if (WarmupDeletion && !Warmup.hasDetected())
+        {
+        Warmup.add(NumOccupiedSlots);
+
+        //Gives up detecting if the transient seems longer than the simulation
+        if (!Warmup.hasDetected() && Warmup.get_NumObservations() >= NumMaxCalls)
+            {
+            Warmup.force();
+            }
+
+        if (Warmup.hasDetected())
+            {
+            NumWarmupCalls = Warmup.get_NumObservations();
+            WarmupTruncationPoint = Warmup.get_TruncationPoint();
+            reset_Statistics();
+            }
+        }
+    else
+        {
+        if (RecordBlockingHistory)
             {
+            BlockingHistory.push_back(C->Status == Call::Blocked);
+            }
 
-            if(considerFilterImperfection)
-                {
-                SpectralDensity thisSpecDensity = route->Segments.begin()->opticalPathSpecDensity.at(auxCount);
-                link.first.lock()->linkSpecDens->updateLink(thisSpecDensity, link.second);
-                }
+        //Stopping rule is only evaluated when a batch is complete
+        if (BlockingIndicator.add(C->Status == Call::Blocked) &&
+                TargetRelativeHalfWidth > 0 &&
+                BlockingIndicator.get_NumBatches() >= MinNumBatches &&
+                NumBlockedCalls > 0)
+            {
+            hasConverged = BlockingIndicator.get_HalfWidth(ConfidenceLevel) <=
+                           TargetRelativeHalfWidth * BlockingIndicator.get_Mean();
+            }
+        }
+
+    if (NumCalls++ < NumMaxCalls && !hasConverged)
+        {
+        Generator->generate_Call();
+        }
+}
+
+void NetworkSimulation::reset_Statistics()
+{
+    //As in run(), the next call request is the first one counted
+    NumCalls = 1;
+    NumBlockedCalls =
+        NumBlockedCalls_Route =
+            NumBlockedCalls_Spectrum =
+                NumBlockedCalls_ASE_Noise =
+                    NumBlockedCalls_FilterImperfection = 0;
+    NumDisruptedCalls = NumRestoredCalls = 0;
+    BlockingIndicator.reset();
+    BlockingHistory.clear();
+}
+
+void NetworkSimulation::emit_Metrics(double Time)
+{
+    MetricsStream::Sample S;
+    S.SimulationTime = Time;
+    S.NumCalls = NumCalls;
+    S.IntervalBlockingProbability = IntervalNumCalls == 0 ? 0 :
+                                    1.0 * IntervalNumBlockedCalls / IntervalNumCalls;
+    S.LinkUtilisation = 1.0 * NumOccupiedSlots /
+                        (Generator->T->Links.size() * Generator->T->get_NumSlots());
+
+    S.ActiveCalls = Connections.get_NumConnections();
+
+    S.RegeneratorsInUse = 0;
+    for (auto &node : Generator->T->Nodes)
+        {
+        S.RegeneratorsInUse += node->get_NumUsedRegenerators();
+        }
+
+    Metrics->push(S);
+
+    IntervalNumCalls = IntervalNumBlockedCalls = 0;
+    if (MetricsTimeInterval > 0)
+        {
+        NextMetricsTime = (std::floor(Time / MetricsTimeInterval) + 1) *
+                          MetricsTimeInterval;
+        }
+}
+
+void NetworkSimulation::drop_call(const Event &evt)
+{
+    std::shared_ptr<Call> C = Generator->get_Call(evt.Parent);
+
+    //Calls dropped after a failure have already freed their resources
+    if (C->Status == Call::Implemented)
+        {
+        free_Route(C);
+        Connections.erase(evt.Parent);
+        }
+}
+
+void NetworkSimulation::use_Route(const std::shared_ptr<Call> &C)
+{
+    unsigned int auxCount = 0;
+    for (auto &link : C->route->Slots)
+        {
+
+        if(considerFilterImperfection)
+            {
+            SpectralDensity thisSpecDensity = C->route->Segments.begin()->opticalPathSpecDensity.at(auxCount);
+            link.first.lock()->linkSpecDens->updateLink(thisSpecDensity, link.second);
+            }
 
+            {
+            PROFILE_PHASE(SlotUse);
             for (auto &slot : link.second)
                 {
                 slot.lock()->useSlot();
                 }
-
-            auxCount++;
             }
+        NumOccupiedSlots += link.second.size();
+        RMSA->R_Alg->notify_LinkChanged(link.first.lock()->Index);
 
-        for (auto &reg : route->Regenerators)
-            {
-            reg.first.lock()->request_Regenerators(reg.second);
-            }
+        auxCount++;
         }
 
-    if (NumCalls++ < NumMaxCalls)
+    for (auto &reg : C->route->Regenerators)
         {
-        Generator->generate_Call();
+        reg.first.lock()->request_Regenerators(reg.second);
         }
 }
 
-void NetworkSimulation::drop_call(std::shared_ptr<Event> evt)
+void NetworkSimulation::free_Route(const std::shared_ptr<Call> &C)
 {
-    if (evt->Parent->Status == Call::Implemented)
+    for (auto &node : C->route->Slots)
         {
-        for (auto &node : evt->route->Slots)
             {
+            PROFILE_PHASE(SlotFree);
             for (auto &slot : node.second)
                 {
                 slot.lock()->freeSlot();
                 }
             }
+        NumOccupiedSlots -= node.second.size();
+        RMSA->R_Alg->notify_LinkChanged(node.first.lock()->Index);
+        }
+
+    for (auto &reg : C->route->Regenerators)
+        {
+        reg.first.lock()->free_Regenerators(reg.second);
+        }
+}
+
+void NetworkSimulation::fail_Element(const Event &evt)
+{
+    std::vector<unsigned> Affected;
+
+    if (evt.Type == Event::LinkFailure)
+        {
+        Generator->T->get_RoutingGraph().Links[evt.Parent]->set_LinkInactive();
+        Affected = Connections.get_LinkConnections(evt.Parent);
+        }
+    else
+        {
+        Generator->T->Nodes[evt.Parent]->set_NodeInactive();
+        Affected = Connections.get_NodeConnections(evt.Parent);
+        }
+    notify_ElementChanged(evt);
+
+    //Every affected connection is torn down before any is routed again, so that
+    //the restored ones can use the spectrum freed by the others.
+    for (auto c : Affected)
+        {
+        free_Route(Generator->get_Call(c));
+        Connections.erase(c);
+        NumDisruptedCalls++;
+        }
+
+    for (auto c : Affected)
+        {
+        std::shared_ptr<Call> C = Generator->get_Call(c);
+
+        if (!C->Origin.lock()->is_NodeActive() || !C->Destination.lock()->is_NodeActive())
+            {
+            C->Status = Call::Blocked;
+            C->route = nullptr;
+            continue;
+            }
 
-        for (auto &reg : evt->route->Regenerators)
+        C->Status = Call::Not_Evaluated;
+        C->route = RMSA->routeCall(C);
+
+        //The pending ending of a call that could not be restored finds it blocked
+        if (C->Status == Call::Implemented)
             {
-            reg.first.lock()->free_Regenerators(reg.second);
+            use_Route(C);
+            Connections.insert(c, *C->route);
+            NumRestoredCalls++;
             }
         }
 }
 
+void NetworkSimulation::repair_Element(const Event &evt)
+{
+    if (evt.Type == Event::LinkRepair)
+        {
+        Generator->T->get_RoutingGraph().Links[evt.Parent]->set_LinkActive();
+        }
+    else
+        {
+        Generator->T->Nodes[evt.Parent]->set_NodeActive();
+        }
+    notify_ElementChanged(evt);
+}
+
+void NetworkSimulation::notify_ElementChanged(const Event &evt)
+{
+    if (evt.Type == Event::LinkFailure || evt.Type == Event::LinkRepair)
+        {
+        RMSA->R_Alg->notify_LinkChanged(evt.Parent);
+        return;
+        }
+
+    //A node can not be entered while it is inactive
+    const RoutingGraph &G = Generator->T->get_RoutingGraph();
+    for (unsigned int e = G.FirstInEdge[evt.Parent]; e < G.FirstInEdge[evt.Parent + 1];
+            ++e)
+        {
+        RMSA->R_Alg->notify_LinkChanged(G.InEdgeLink[e]);
+        }
+}
+
+void NetworkSimulation::schedule_LinkFailure(unsigned LinkIndex,
+        double FailureTime, double RepairTime)
+{
+#ifdef RUN_ASSERTIONS
+    if (LinkIndex >= Generator->T->Links.size() || RepairTime < FailureTime)
+        {
+        std::cerr << "Invalid link failure." << std::endl;
+        abort();
+        }
+#endif
+
+    Generator->Events.push(Event(FailureTime, Event::LinkFailure, LinkIndex));
+    if (RepairTime != std::numeric_limits<double>::infinity())
+        {
+        Generator->Events.push(Event(RepairTime, Event::LinkRepair, LinkIndex));
+        }
+}
+
+void NetworkSimulation::schedule_NodeFailure(unsigned NodeIndex,
+        double FailureTime, double RepairTime)
+{
+#ifdef RUN_ASSERTIONS
+    if (NodeIndex >= Generator->T->Nodes.size() || RepairTime < FailureTime)
+        {
+        std::cerr << "Invalid node failure." << std::endl;
+        abort();
+        }
+#endif
+
+    Generator->Events.push(Event(FailureTime, Event::NodeFailure, NodeIndex));
+    if (RepairTime != std::numeric_limits<double>::infinity())
+        {
+        Generator->Events.push(Event(RepairTime, Event::NodeRepair, NodeIndex));
+        }
+}
+
 void NetworkSimulation::print()
 {
     if (!hasSimulated)
@@ -125,7 +429,18 @@ void NetworkSimulation::print()
         run();
         }
 
-    std::cout << get_Load() << "\t" << get_CallBlockingProbability() << std::endl;
+    std::cout << get_Load() << "\t" << get_CallBlockingProbability();
+    if (TargetRelativeHalfWidth > 0)
+        {
+        std::cout << "\t+- " << get_CallBlockingProbabilityHalfWidth()
+                  << "\t(" << NumCalls << " calls)";
+        }
+    if (WarmupDeletion)
+        {
+        std::cout << "\t(warm-up: " << NumWarmupCalls << " calls, truncation point "
+                  << WarmupTruncationPoint << ")";
+        }
+    std::cout << std::endl;
 }
 
 double NetworkSimulation::get_CallBlockingProbability()
@@ -138,7 +453,262 @@ double NetworkSimulation::get_CallBlockingProbability()
     return 1.0 * NumBlockedCalls / (1.0 * NumCalls);
 }
 
+double NetworkSimulation::get_CallBlockingProbabilityHalfWidth()
+{
+    if (!hasSimulated)
+        {
+        run();
+        }
+
+    return BlockingIndicator.get_HalfWidth(ConfidenceLevel);
+}
+
+void NetworkSimulation::set_StoppingRule(double TargetRelativeHalfWidth,
+        double ConfidenceLevel)
+{
+#ifdef RUN_ASSERTIONS
+    if (TargetRelativeHalfWidth < 0)
+        {
+        std::cerr << "The target relative half-width must be non-negative." << std::endl;
+        abort();
+        }
+    if (ConfidenceLevel <= 0 || ConfidenceLevel >= 1)
+        {
+        std::cerr << "The confidence level must be in (0, 1)." << std::endl;
+        abort();
+        }
+#endif
+
+    this->TargetRelativeHalfWidth = TargetRelativeHalfWidth;
+    this->ConfidenceLevel = ConfidenceLevel;
+}
+
+void NetworkSimulation::set_RandomStreams(uint32_t SweepPoint,
+        uint32_t Replication)
+{
+    Generator->Stream = RandomGenerator(SweepPoint, Replication,
+                                        RandomGenerator::CallsStream);
+    RMSA->WA_Alg->Stream = RandomGenerator(SweepPoint, Replication,
+                                           RandomGenerator::SpectrumAssignmentStream);
+}
+
+void NetworkSimulation::set_WarmupDeletion(bool WarmupDeletion)
+{
+    this->WarmupDeletion = WarmupDeletion;
+}
+
+void NetworkSimulation::set_BlockingHistory(bool RecordBlockingHistory)
+{
+    this->RecordBlockingHistory = RecordBlockingHistory;
+}
+
+std::shared_ptr<NetworkFork> NetworkSimulation::fork()
+{
+    auto Fork = std::make_shared<NetworkFork>(Generator->T, Generator->simulationTime);
+
+    for (auto &evt : Generator->Events.get_Events())
+        {
+        if (evt.Type == Event::CallEnding &&
+                Generator->get_Call(evt.Parent)->Status == Call::Implemented)
+            {
+            Fork->add_Departure(*Generator->get_Call(evt.Parent)->route, evt.t);
+            }
+        }
+
+    return Fork;
+}
+
 double NetworkSimulation::get_Load()
 {
     return Generator->h;
 }
+
+void NetworkSimulation::set_Checkpointing(std::string FileName,
+        unsigned long Interval, uint64_t ParametersHash)
+{
+    CheckpointFileName = FileName;
+    CheckpointInterval = Interval;
+    CheckpointParametersHash = ParametersHash;
+}
+
+void NetworkSimulation::set_MetricsStream(std::string FileName,
+        unsigned long CallInterval, double TimeInterval)
+{
+    MetricsFileName = FileName;
+    MetricsCallInterval = CallInterval;
+    MetricsTimeInterval = TimeInterval;
+}
+
+void NetworkSimulation::save_Checkpoint(std::string FileName)
+{
+    std::string TemporaryFileName = FileName + ".tmp";
+    std::ofstream File(TemporaryFileName, std::ofstream::out |
+                       std::ofstream::binary | std::ofstream::trunc);
+
+    if (!File.is_open())
+        {
+        std::cerr << "Could not open the checkpoint " << TemporaryFileName <<
+                  ". The previous checkpoint is kept." << std::endl;
+        return;
+        }
+
+    std::ostringstream State(std::ostringstream::out | std::ostringstream::binary);
+    BinaryStream::write(State, NumCalls);
+    BinaryStream::write(State, NumBlockedCalls);
+    BinaryStream::write(State, NumBlockedCalls_Route);
+    BinaryStream::write(State, NumBlockedCalls_Spectrum);
+    BinaryStream::write(State, NumBlockedCalls_ASE_Noise);
+    BinaryStream::write(State, NumBlockedCalls_FilterImperfection);
+    BinaryStream::write(State, hasConverged);
+    BinaryStream::write(State, NumOccupiedSlots);
+    BinaryStream::write(State, NumWarmupCalls);
+    BinaryStream::write(State, WarmupTruncationPoint);
+    BinaryStream::write(State, NumDisruptedCalls);
+    BinaryStream::write(State, NumRestoredCalls);
+    BinaryStream::write(State, NextMetricsTime);
+    BinaryStream::write(State, IntervalNumCalls);
+    BinaryStream::write(State, IntervalNumBlockedCalls);
+    BlockingIndicator.save_State(State);
+    Warmup.save_State(State);
+    BinaryStream::write(State, BlockingHistory);
+    BinaryStream::write(State, RMSA->WA_Alg->Stream);
+
+    Generator->T->save_State(State);
+    Generator->save_State(State);
+
+    std::string Payload = State.str();
+    File.write(CheckpointMagic, sizeof(CheckpointMagic));
+    BinaryStream::write(File, CheckpointVersion);
+    BinaryStream::write(File, CheckpointParametersHash);
+    BinaryStream::write(File, Generator->T->get_Hash());
+    BinaryStream::write(File, Generator->h);
+    BinaryStream::write(File, NumMaxCalls);
+    BinaryStream::write(File, (uint64_t) Payload.size());
+    BinaryStream::write(File, BinaryStream::hash(Payload.data(), Payload.size()));
+    File.write(Payload.data(), Payload.size());
+
+    File.close();
+
+    //A failed write must not replace the previous checkpoint
+    if (File.fail())
+        {
+        std::cerr << "Could not write the checkpoint " << FileName <<
+                  ". The previous checkpoint is kept." << std::endl;
+        std::remove(TemporaryFileName.c_str());
+        return;
+        }
+
+    std::rename(TemporaryFileName.c_str(), FileName.c_str());
+}
+
+bool NetworkSimulation::load_Checkpoint(std::string FileName)
+{
+    std::ifstream File(FileName, std::ifstream::in | std::ifstream::binary);
+
+    if (!File.is_open())
+        {
+        std::cerr << "Could not open the checkpoint " << FileName << "." << std::endl;
+        return false;
+        }
+
+    char Magic[8];
+    uint32_t Version;
+    uint64_t ParametersHash, TopologyHash;
+    double Load;
+    long unsigned SavedNumMaxCalls;
+    uint64_t PayloadSize, PayloadHash;
+    File.read(Magic, sizeof(Magic));
+    BinaryStream::read(File, Version);
+    BinaryStream::read(File, ParametersHash);
+    BinaryStream::read(File, TopologyHash);
+    BinaryStream::read(File, Load);
+    BinaryStream::read(File, SavedNumMaxCalls);
+    BinaryStream::read(File, PayloadSize);
+    BinaryStream::read(File, PayloadHash);
+
+    if (File.fail() || std::memcmp(Magic, CheckpointMagic, sizeof(Magic)) != 0 ||
+            Version != CheckpointVersion)
+        {
+        std::cerr << "Invalid checkpoint file " << FileName << "." << std::endl;
+        return false;
+        }
+    if (ParametersHash != CheckpointParametersHash ||
+            TopologyHash != Generator->T->get_Hash() || Load != Generator->h ||
+            SavedNumMaxCalls != NumMaxCalls)
+        {
+        std::cerr << "The checkpoint " << FileName <<
+                  " does not match this simulation." << std::endl;
+        return false;
+        }
+
+    //The state is only restored once the whole of it is known to be intact
+    std::streamoff HeaderSize = File.tellg();
+    File.seekg(0, std::ifstream::end);
+    if (File.tellg() - HeaderSize != (std::streamoff) PayloadSize)
+        {
+        std::cerr << "Truncated checkpoint file " << FileName << "." << std::endl;
+        return false;
+        }
+    File.seekg(HeaderSize);
+
+    std::string Payload(PayloadSize, '\0');
+    File.read(&Payload[0], PayloadSize);
+    if (File.fail() || BinaryStream::hash(Payload.data(), Payload.size()) != PayloadHash)
+        {
+        std::cerr << "Corrupt checkpoint file " << FileName << "." << std::endl;
+        return false;
+        }
+
+    std::istringstream State(Payload, std::istringstream::in |
+                             std::istringstream::binary);
+    BinaryStream::read(State, NumCalls);
+    BinaryStream::read(State, NumBlockedCalls);
+    BinaryStream::read(State, NumBlockedCalls_Route);
+    BinaryStream::read(State, NumBlockedCalls_Spectrum);
+    BinaryStream::read(State, NumBlockedCalls_ASE_Noise);
+    BinaryStream::read(State, NumBlockedCalls_FilterImperfection);
+    BinaryStream::read(State, hasConverged);
+    BinaryStream::read(State, NumOccupiedSlots);
+    BinaryStream::read(State, NumWarmupCalls);
+    BinaryStream::read(State, WarmupTruncationPoint);
+    BinaryStream::read(State, NumDisruptedCalls);
+    BinaryStream::read(State, NumRestoredCalls);
+    BinaryStream::read(State, NextMetricsTime);
+    BinaryStream::read(State, IntervalNumCalls);
+    BinaryStream::read(State, IntervalNumBlockedCalls);
+    BlockingIndicator.load_State(State);
+    Warmup.load_State(State);
+    BinaryStream::read(State, BlockingHistory);
+    BinaryStream::read(State, RMSA->WA_Alg->Stream);
+
+    Generator->T->load_State(State);
+    Generator->load_State(State);
+
+    //The state was partially overwritten, so the simulation can not go on
+    if (State.fail())
+        {
+        std::cerr << "Inconsistent checkpoint file " << FileName << "." << std::endl;
+        abort();
+        }
+
+    //The routing algorithm may keep costs computed before the state was restored
+    for (auto &link : Generator->T->Links)
+        {
+        RMSA->R_Alg->notify_LinkChanged(link.second->Index);
+        }
+
+    //The index is rebuilt from the calls that still have a pending ending
+    Connections.reset(Generator->T->Links.size(), Generator->T->Nodes.size());
+    for (auto &evt : Generator->Events.get_Events())
+        {
+        if (evt.Type == Event::CallEnding &&
+                Generator->get_Call(evt.Parent)->Status == Call::Implemented)
+            {
+            Connections.insert(evt.Parent, *Generator->get_Call(evt.Parent)->route);
+            }
+        }
+
+    hasSimulated = false;
+    isResumed = true;
+    return true;
+}
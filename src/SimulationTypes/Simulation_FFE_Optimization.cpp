@@ -36,6 +36,7 @@ void Simulation_FFE_Optimization::run()
         load();
         }
 
+    Replicas = std::make_shared<TopologyPool>(T);
     std::ofstream logFile(LogFilename);
     FFE_GA_Optimization = std::make_shared<SA::FFE::FFE_GA>(*this);
 
@@ -24,10 +24,7 @@ unsigned int Simulation_NSGA2_RegnPlac::RegnMax;
 Simulation_NSGA2_RegnPlac::Simulation_NSGA2_RegnPlac() :
     SimulationType(Simulation_Type::morp3o), hasLoaded(false)
 {
-    auto maxBitrate = std::max_element(TransmissionBitrate::DefaultBitrates.begin(),
-                                       TransmissionBitrate::DefaultBitrates.end());
-    RegnMax = Link::NumSlots * std::ceil(maxBitrate->get_Bitrate() /
-                                         RegeneratorAssignmentAlgorithm::RegeneratorBitrate);
+
 }
 
 void Simulation_NSGA2_RegnPlac::Individual::createIndividual()
@@ -338,6 +335,13 @@ void Simulation_NSGA2_RegnPlac::run()
         load();
         }
 
+    //The number of slots depends on the topology, so it is only known now.
+    auto maxBitrate = std::max_element(TransmissionBitrate::DefaultBitrates.begin(),
+                                       TransmissionBitrate::DefaultBitrates.end());
+    RegnMax = T->get_NumSlots() * std::ceil(maxBitrate->get_Bitrate() /
+                                            RegeneratorAssignmentAlgorithm::RegeneratorBitrate);
+
+    Replicas = std::make_shared<TopologyPool>(T);
     Sim_NSGA2 Optimization(*this);
 
     std::cout << std::endl << "* * RESULTS * *" << std::endl;
@@ -4,6 +4,9 @@
 #include <Structure/Node.h>
 #include <Calls/CallGenerator.h>
 #include <RMSA/RoutingWavelengthAssignment.h>
+#include <GeneralClasses/BinaryStream.h>
+#include <GeneralClasses/RandomGenerator.h>
+#include <cstdio>
 #include <iostream>
 #include <boost/assign.hpp>
 #include <boost/program_options.hpp>
@@ -20,6 +23,11 @@ Simulation_NetworkLoad::Simulation_NetworkLoad() : SimulationType(
         Simulation_Type::networkload)
 {
     hasSimulated = hasLoaded = false;
+    TargetRelativeHalfWidth = 0;
+    ConfidenceLevel = 0.95;
+    WarmupDeletion = false;
+    CheckpointInterval = 0;
+    MetricsCallInterval = MetricsTimeInterval = 0;
 
     Routing_Algorithm = (RoutingAlgorithm::RoutingAlgorithms) - 1;
     WavAssign_Algorithm =
@@ -57,14 +65,38 @@ void Simulation_NetworkLoad::run()
         {
         if (!simulations[i]->hasSimulated)
             {
+            //Resumes from the last checkpoint, if any
+            if (CheckpointInterval > 0 &&
+                    std::ifstream(simulations[i]->CheckpointFileName).good() &&
+                    !simulations[i]->load_Checkpoint(simulations[i]->CheckpointFileName))
+                {
+                std::cerr << "The simulation with load " << simulations[i]->get_Load() <<
+                          " starts afresh." << std::endl;
+                }
             simulations[i]->run();
+
+            //A finished simulation must not be resumed by a later run
+            if (CheckpointInterval > 0)
+                {
+                std::remove(simulations[i]->CheckpointFileName.c_str());
+                }
             }
 
         #pragma omp ordered
             {
             simulations[i]->print();
             OutFile << simulations[i]->get_Load() << "\t"
-                    << simulations[i]->get_CallBlockingProbability() << std::endl;
+                    << simulations[i]->get_CallBlockingProbability();
+            if (TargetRelativeHalfWidth > 0)
+                {
+                OutFile << "\t" << simulations[i]->get_CallBlockingProbabilityHalfWidth()
+                        << "\t" << simulations[i]->NumCalls;
+                }
+            if (WarmupDeletion)
+                {
+                OutFile << "\t" << simulations[i]->NumWarmupCalls;
+                }
+            OutFile << std::endl;
             }
         }
 
@@ -116,6 +148,14 @@ void Simulation_NetworkLoad::print()
                       RegAssignment_Algorithm) << std::endl;
         }
     std::cout << "-> Number of Calls = " << NumCalls << std::endl;
+    if (TargetRelativeHalfWidth > 0)
+        {
+        std::cout << "-> Target Relative Half-Width = " << TargetRelativeHalfWidth
+                  << std::endl;
+        std::cout << "-> Confidence Level = " << ConfidenceLevel << std::endl;
+        }
+    std::cout << "-> Warm-up Deletion = " << (WarmupDeletion ? "yes" : "no") <<
+              std::endl;
     std::cout << "-> Minimum Network Load = " << NetworkLoadMin << std::endl;
     std::cout << "-> Maximum Network Load = " << NetworkLoadMax << std::endl;
 
@@ -206,6 +246,80 @@ void Simulation_NetworkLoad::load()
         }
     while (1);
 
+    std::cout << std::endl << "-> Define the target relative half-width of the"
+              " call blocking probability confidence interval (0 to simulate every call)."
+              << std::endl;
+
+    do
+        {
+        std::cin >> TargetRelativeHalfWidth;
+
+        if (std::cin.fail() || TargetRelativeHalfWidth < 0)
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid relative half-width." << std::endl;
+            std::cout << std::endl << "-> Define the target relative half-width of the"
+                      " call blocking probability confidence interval (0 to simulate every call)."
+                      << std::endl;
+            }
+        else
+            {
+            break;
+            }
+        }
+    while (1);
+
+    if (TargetRelativeHalfWidth > 0)
+        {
+        std::cout << std::endl << "-> Define the confidence level." << std::endl;
+
+        do
+            {
+            std::cin >> ConfidenceLevel;
+
+            if (std::cin.fail() || ConfidenceLevel <= 0 || ConfidenceLevel >= 1)
+                {
+                std::cin.clear();
+                std::cin.ignore();
+
+                std::cerr << "Invalid confidence level." << std::endl;
+                std::cout << std::endl << "-> Define the confidence level." << std::endl;
+                }
+            else
+                {
+                break;
+                }
+            }
+        while (1);
+        }
+
+    std::cout << std::endl << "-> Automatically delete the warm-up transient?"
+              " (0 = no, 1 = yes)" << std::endl;
+
+    do
+        {
+        int Deletion;
+        std::cin >> Deletion;
+
+        if (std::cin.fail() || (Deletion != 0 && Deletion != 1))
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid option." << std::endl;
+            std::cout << std::endl << "-> Automatically delete the warm-up transient?"
+                      " (0 = no, 1 = yes)" << std::endl;
+            }
+        else
+            {
+            WarmupDeletion = Deletion;
+            break;
+            }
+        }
+    while (1);
+
     std::cout << std::endl << "-> Define the minimum network load." << std::endl;
 
     do
@@ -318,6 +432,7 @@ void Simulation_NetworkLoad::save(std::string SimConfigFileName)
     Link::save(SimConfigFileName, T);
 
     simulations.front()->RMSA->R_Alg->save(SimConfigFileName);
+    simulations.front()->RMSA->R_Alg->RCost->save(SimConfigFileName);
     simulations.front()->RMSA->WA_Alg->save(SimConfigFileName);
     if(Type == TranslucentNetwork)
         {
@@ -338,6 +453,13 @@ void Simulation_NetworkLoad::save(std::string SimConfigFileName)
 
     SimConfigFile << std::endl << "  [sim_info]" << std::endl << std::endl;
     SimConfigFile << "  NumCalls = " << NumCalls << std::endl;
+    SimConfigFile << "  TargetRelativeHalfWidth = " << TargetRelativeHalfWidth <<
+                  std::endl;
+    SimConfigFile << "  ConfidenceLevel = " << ConfidenceLevel << std::endl;
+    SimConfigFile << "  WarmupDeletion = " << WarmupDeletion << std::endl;
+    SimConfigFile << "  CheckpointInterval = " << CheckpointInterval << std::endl;
+    SimConfigFile << "  MetricsCallInterval = " << MetricsCallInterval << std::endl;
+    SimConfigFile << "  MetricsTimeInterval = " << MetricsTimeInterval << std::endl;
     SimConfigFile << "  NetworkLoadMin = " << NetworkLoadMin << std::endl;
     SimConfigFile << "  NetworkLoadMax= " << NetworkLoadMax << std::endl;
     SimConfigFile << "  NetworkLoadStep = " << NetworkLoadStep << std::endl;
@@ -365,6 +487,7 @@ void Simulation_NetworkLoad::load_file(std::string ConfigFileName)
      "Distance Between Inline Amps.")
     ("algorithms.RoutingAlgorithm", value<std::string>()->required(),
      "Routing Algorithm")
+    ("algorithms.RoutingCost", value<std::string>()->required(), "Routing Cost")
     ("algorithms.WavelengthAssignmentAlgorithm", value<std::string>()->required(),
      "Wavelength Assignment Algorithm")
     ("algorithms.RegeneratorPlacementAlgorithm", value<std::string>(),
@@ -372,6 +495,16 @@ void Simulation_NetworkLoad::load_file(std::string ConfigFileName)
     ("algorithms.RegeneratorAssignmentAlgorithm", value<std::string>(),
      "Regenerator Assignment Algorithm")
     ("sim_info.NumCalls", value<long double>()->required(), "Number of Calls")
+    ("sim_info.TargetRelativeHalfWidth", value<long double>(),
+     "Target Relative Half-Width")
+    ("sim_info.ConfidenceLevel", value<long double>(), "Confidence Level")
+    ("sim_info.WarmupDeletion", value<bool>(), "Warm-up Deletion")
+    ("sim_info.CheckpointInterval", value<long double>(),
+     "Calls Between Checkpoints")
+    ("sim_info.MetricsCallInterval", value<long double>(),
+     "Calls Between Metrics Samples")
+    ("sim_info.MetricsTimeInterval", value<long double>(),
+     "Simulated Time Between Metrics Samples")
     ("sim_info.NetworkLoadMin", value<long double>()->required(),
      "Min. Network Load")
     ("sim_info.NetworkLoadMax", value<long double>()->required(),
@@ -405,6 +538,8 @@ void Simulation_NetworkLoad::load_file(std::string ConfigFileName)
     T->set_avgSpanLength(VariablesMap["general.AvgSpanLength"].as<long double>());
     Routing_Algorithm = RoutingAlgorithm::RoutingAlgorithmNicknames.right.at(
                             VariablesMap["algorithms.RoutingAlgorithm"].as<std::string>());
+    Routing_Cost = RoutingCost::RoutingCostsNicknames.right.at(
+                       VariablesMap["algorithms.RoutingCost"].as<std::string>());
     WavAssign_Algorithm =
         SA::SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithmNicknames.right.at(
             VariablesMap["algorithms.WavelengthAssignmentAlgorithm"].as<std::string>());
@@ -422,6 +557,33 @@ void Simulation_NetworkLoad::load_file(std::string ConfigFileName)
             VariablesMap["sim_info.numReg"].as<long double>();
         }
     NumCalls = VariablesMap["sim_info.NumCalls"].as<long double>();
+    if (VariablesMap.count("sim_info.TargetRelativeHalfWidth"))
+        {
+        TargetRelativeHalfWidth =
+            VariablesMap["sim_info.TargetRelativeHalfWidth"].as<long double>();
+        }
+    if (VariablesMap.count("sim_info.ConfidenceLevel"))
+        {
+        ConfidenceLevel = VariablesMap["sim_info.ConfidenceLevel"].as<long double>();
+        }
+    if (VariablesMap.count("sim_info.WarmupDeletion"))
+        {
+        WarmupDeletion = VariablesMap["sim_info.WarmupDeletion"].as<bool>();
+        }
+    if (VariablesMap.count("sim_info.CheckpointInterval"))
+        {
+        CheckpointInterval = VariablesMap["sim_info.CheckpointInterval"].as<long double>();
+        }
+    if (VariablesMap.count("sim_info.MetricsCallInterval"))
+        {
+        MetricsCallInterval =
+            VariablesMap["sim_info.MetricsCallInterval"].as<long double>();
+        }
+    if (VariablesMap.count("sim_info.MetricsTimeInterval"))
+        {
+        MetricsTimeInterval =
+            VariablesMap["sim_info.MetricsTimeInterval"].as<long double>();
+        }
     NetworkLoadMin = VariablesMap["sim_info.NetworkLoadMin"].as<long double>();
     NetworkLoadMax = VariablesMap["sim_info.NetworkLoadMax"].as<long double>();
     NetworkLoadStep = VariablesMap["sim_info.NetworkLoadStep"].as<long double>();
@@ -461,6 +623,23 @@ void Simulation_NetworkLoad::create_Simulations()
         place_Regenerators(T);
         }
 
+    //The checkpoints of a simulation only resume simulations with the same
+    //algorithms, stopping rule and seed
+    uint64_t ParametersHash = BinaryStream::hash(&RandomGenerator::MasterSeed,
+                              sizeof(RandomGenerator::MasterSeed));
+    for (double Parameter :
+            {
+            (double) Type, (double) Routing_Algorithm, (double) Routing_Cost,
+            (double) WavAssign_Algorithm, (double) RegPlacement_Algorithm,
+            (double) RegAssignment_Algorithm, TargetRelativeHalfWidth,
+            ConfidenceLevel, (double) WarmupDeletion, T->AvgSpanLength,
+            (double) considerAseNoise, (double) considerFilterImperfection
+            })
+        {
+        ParametersHash = BinaryStream::hash(&Parameter, sizeof(Parameter),
+                                            ParametersHash);
+        }
+
     for (double load = NetworkLoadMin; load <= NetworkLoadMax;
             load += NetworkLoadStep)
         {
@@ -497,6 +676,18 @@ void Simulation_NetworkLoad::create_Simulations()
         simulations.push_back(
             std::shared_ptr<NetworkSimulation>(new NetworkSimulation(
                     Generator, RMSA, NumCalls)));
+        simulations.back()->set_RandomStreams(simulations.size() - 1);
+        simulations.back()->set_StoppingRule(TargetRelativeHalfWidth, ConfidenceLevel);
+        simulations.back()->set_WarmupDeletion(WarmupDeletion);
+        simulations.back()->set_Checkpointing(FileName + "." +
+                                              std::to_string(simulations.size() - 1) + ".ckpt", CheckpointInterval,
+                                              ParametersHash);
+        if (MetricsCallInterval > 0 || MetricsTimeInterval > 0)
+            {
+            simulations.back()->set_MetricsStream(FileName + "." +
+                                                  std::to_string(simulations.size() - 1) + ".metrics.csv",
+                                                  MetricsCallInterval, MetricsTimeInterval);
+            }
 
         }
 }
@@ -23,6 +23,7 @@ double Simulation_PSROptimization::NumCalls;
 double Simulation_PSROptimization::OptimizationLoad;
 std::vector<std::shared_ptr<Cost>> Simulation_PSROptimization::Costs;
 std::shared_ptr<Topology> Simulation_PSROptimization::Fitness::T;
+std::shared_ptr<TopologyPool> Simulation_PSROptimization::Fitness::Replicas;
 PowerSeriesRouting::Variants Simulation_PSROptimization::Fitness::Variant;
 ROUT::RoutingAlgorithm::RoutingAlgorithms
 Simulation_PSROptimization::Routing_Algorithm;
@@ -590,8 +591,8 @@ double Simulation_PSROptimization::Fitness::operator()(
     std::shared_ptr<PSO_Particle<double>> particle)
 {
 
-    //Creates a copy of the topology.
-    auto TopologyCopy = std::make_shared<Topology>(*T);
+    //Reuses a copy of the topology of a finished particle, if any.
+    auto TopologyCopy = Replicas->acquire();
 
     //Creates the RMSA Algorithms
     auto R_Alg = ROUT::RoutingAlgorithm::create_RoutingAlgorithm
@@ -673,6 +674,7 @@ void Simulation_PSROptimization::runPSR()
     if (!hasRun)
         {
         Fitness::T = T;
+        Fitness::Replicas = std::make_shared<TopologyPool>(T);
         Fitness::Variant = Variant;
 
         switch (Variant)
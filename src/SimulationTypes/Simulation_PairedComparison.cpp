@@ -0,0 +1,649 @@
+#include <SimulationTypes/Simulation_PairedComparison.h>
+#include <Structure/Topology.h>
+#include <Structure/Link.h>
+#include <Structure/Node.h>
+#include <Calls/CallGenerator.h>
+#include <RMSA/RoutingWavelengthAssignment.h>
+#include <GeneralClasses/BatchMeans.h>
+#include <iostream>
+#include <cmath>
+#include <boost/program_options.hpp>
+
+using namespace RMSA;
+using namespace Simulations;
+using namespace ROUT;
+using namespace SA;
+using namespace RA;
+using namespace RP;
+
+Simulation_PairedComparison::Simulation_PairedComparison() : SimulationType(
+        Simulation_Type::pairedcomparison)
+{
+    hasSimulated = hasLoaded = runLoadNX = false;
+    ConfidenceLevel = 0.95;
+
+    RegPlacement_Algorithm =
+        (RegeneratorPlacementAlgorithm::RegeneratorPlacementAlgorithms) - 1;
+}
+
+void Simulation_PairedComparison::help()
+{
+    std::cout << "\t\tPAIRED COMPARISON SIMULATION" << std::endl << std::endl <<
+              "This simulation compares several RMSA configurations under the"
+              " same sequence of call requests, and estimates the difference"
+              " between their call blocking probabilities with a confidence"
+              " interval over the paired observations." << std::endl;
+}
+
+void Simulation_PairedComparison::run()
+{
+    if (!hasLoaded)
+        {
+        load();
+        }
+
+    extern bool parallelism_enabled;
+    #pragma omp parallel for schedule(dynamic) if(parallelism_enabled)
+
+    for (size_t i = 0; i < simulations.size(); i++)
+        {
+        if (!simulations[i]->hasSimulated)
+            {
+            simulations[i]->run();
+            }
+        }
+
+    std::cout << std::endl << "* * RESULTS * *" << std::endl;
+    std::cout << "CONFIGURATION\tCALL BLOCKING PROBABILITY\tDIFFERENCE TO "
+              << get_ConfigurationName(0) << std::endl;
+
+    std::ofstream OutFile(FileName.c_str());
+
+    auto &Reference = simulations.front()->BlockingHistory;
+
+    for (size_t i = 0; i < simulations.size(); i++)
+        {
+        auto &History = simulations[i]->BlockingHistory;
+
+        //The histories only differ in length if some run was cut short
+        BatchMeans Difference;
+        for (size_t call = 0; call < std::min(History.size(), Reference.size());
+                call++)
+            {
+            Difference.add((double) History[call] - (double) Reference[call]);
+            }
+
+        double DiffHalfWidth = Difference.get_HalfWidth(ConfidenceLevel);
+
+        std::cout << get_ConfigurationName(i) << "\t"
+                  << simulations[i]->get_CallBlockingProbability() << " +- "
+                  << simulations[i]->get_CallBlockingProbabilityHalfWidth();
+        OutFile << i << "\t" << simulations[i]->get_CallBlockingProbability()
+                << "\t" << simulations[i]->get_CallBlockingProbabilityHalfWidth();
+
+        if (i != 0)
+            {
+            std::cout << "\t" << Difference.get_Mean() << " +- " << DiffHalfWidth;
+            if (std::fabs(Difference.get_Mean()) > DiffHalfWidth)
+                {
+                std::cout << " (*)";
+                }
+            OutFile << "\t" << Difference.get_Mean() << "\t" << DiffHalfWidth;
+            }
+        std::cout << std::endl;
+        OutFile << std::endl;
+        }
+
+    std::cout << "(*) significant at the " << ConfidenceLevel <<
+              " confidence level." << std::endl;
+
+    hasSimulated = true;
+
+    // Saving Sim. Configurations
+    std::string ConfigFileName = "SimConfigFile.ini"; // Name of the file
+    save(ConfigFileName);
+}
+
+void Simulation_PairedComparison::print()
+{
+    if (!hasLoaded)
+        {
+        load();
+        }
+
+    std::cout << std::endl <<
+              "  A Paired Comparison Simulation is about to start with the following parameters: "
+              << std::endl;
+    std::cout << "-> Metrics =" << std::endl;
+    for(auto &metric : Metrics)
+        {
+        std::cout << "\t-> " << SimulationType::MetricTypes.left.at(
+                      metric) << std::endl;
+        }
+    if(considerFilterImperfection)
+        {
+        std::cout << "-> Tx Filter Order = " << SpectralDensity::TxFilterOrder <<
+                  std::endl;
+        std::cout << "-> Gaussian Filter Order = " << SpectralDensity::GaussianOrder <<
+                  std::endl;
+        }
+    std::cout << "-> Network Type = " << NetworkTypesNicknames.left.at(
+                  Type) << std::endl;
+    std::cout << "-> Distance Between Inline Amplifiers = " << T->AvgSpanLength <<
+              std::endl;
+    std::cout << "-> Configurations =" << std::endl;
+    for (size_t i = 0; i < Configurations.size(); i++)
+        {
+        std::cout << "\t-> " << get_ConfigurationName(i) << std::endl;
+        }
+    if(Type == TranslucentNetwork)
+        {
+        std::cout << "-> Regenerator Placement Algorithm = " <<
+                  RegeneratorPlacementAlgorithm::RegeneratorPlacementNames.left.at(
+                      RegPlacement_Algorithm) << std::endl;
+        }
+    std::cout << "-> Number of Calls = " << NumCalls << std::endl;
+    std::cout << "-> Network Load = " << NetworkLoad << std::endl;
+    std::cout << "-> Confidence Level = " << ConfidenceLevel << std::endl;
+
+    T->print();
+}
+
+void Simulation_PairedComparison::load()
+{
+    //Generic readings.
+    SimulationType::load();
+
+    std::cout << std::endl << "-> Choose a network type." << std::endl;
+
+    do
+        {
+        for (auto &nettype : NetworkTypes.left)
+            {
+            std::cout << "(" << nettype.first << ")\t" << nettype.second << std::endl;
+            }
+
+        int Net_Type;
+        std::cin >> Net_Type;
+
+        if (std::cin.fail() || NetworkTypes.left.count((Network_Type) Net_Type) == 0)
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid Network Type." << std::endl;
+            std::cout << std::endl << "-> Choose a network type." << std::endl;
+            }
+        else
+            {
+            Type = (Network_Type) Net_Type;
+            break;
+            }
+        }
+    while (1);
+
+    Node::load();
+
+    Link::load(T);
+
+    std::cout << std::endl << "-> Define the number of configurations to compare."
+              << std::endl;
+
+    int NumConfigurations;
+    do
+        {
+        std::cin >> NumConfigurations;
+
+        if (std::cin.fail() || NumConfigurations < 2)
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid number of configurations." << std::endl;
+            std::cout << std::endl << "-> Define the number of configurations to compare."
+                      << std::endl;
+            }
+        else
+            {
+            break;
+            }
+        }
+    while (1);
+
+    //RMSA Algorithms
+    for (int i = 0; i < NumConfigurations; i++)
+        {
+        std::cout << std::endl << "\t* * CONFIGURATION " << i << " * *" << std::endl;
+
+        Configuration Config;
+
+        //Routing Algorithm
+        Config.Routing_Algorithm = RoutingAlgorithm::define_RoutingAlgorithm();
+
+        //Routing Cost
+        Config.Routing_Cost = RoutingCost::define_RoutingCost();
+
+        //Wavelength Assignment Algorithm
+        Config.WavAssign_Algorithm =
+            SA::SpectrumAssignmentAlgorithm::define_SpectrumAssignmentAlgorithm();
+
+        //Regenerator Assignment Algorithm
+        Config.RegAssignment_Algorithm =
+            (RegeneratorAssignmentAlgorithm::RegeneratorAssignmentAlgorithms) - 1;
+        if (Type == TranslucentNetwork)
+            {
+            Config.RegAssignment_Algorithm =
+                RegeneratorAssignmentAlgorithm::define_RegeneratorAssignmentAlgorithm();
+            }
+
+        Configurations.push_back(Config);
+        }
+
+    if (Type == TranslucentNetwork)
+        {
+        //Regenerator Placement Algorithm, common to every configuration
+        RegPlacement_Algorithm =
+            RegeneratorPlacementAlgorithm::define_RegeneratorPlacementAlgorithm();
+
+        runLoadNX = true;
+        }
+
+    std::cout << std::endl << "-> Define the number of calls." << std::endl;
+
+    do
+        {
+        std::cin >> NumCalls;
+
+        if (std::cin.fail() || NumCalls < 0)
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid number of calls." << std::endl;
+            std::cout << std::endl << "-> Define the number of calls." << std::endl;
+            }
+        else
+            {
+            break;
+            }
+        }
+    while (1);
+
+    std::cout << std::endl << "-> Define the network load." << std::endl;
+
+    do
+        {
+        std::cin >> NetworkLoad;
+
+        if (std::cin.fail() || NetworkLoad < 0)
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid network load." << std::endl;
+            std::cout << std::endl << "-> Define the network load." << std::endl;
+            }
+        else
+            {
+            break;
+            }
+        }
+    while (1);
+
+    std::cout << std::endl << "-> Define the confidence level." << std::endl;
+
+    do
+        {
+        std::cin >> ConfidenceLevel;
+
+        if (std::cin.fail() || ConfidenceLevel <= 0 || ConfidenceLevel >= 1)
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid confidence level." << std::endl;
+            std::cout << std::endl << "-> Define the confidence level." << std::endl;
+            }
+        else
+            {
+            break;
+            }
+        }
+    while (1);
+
+    std::cout << std::endl << "-> Define the file where to store the results."
+              << std::endl;
+    do
+        {
+        std::cin >> FileName;
+
+        if (std::cin.fail())
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid filename." << std::endl;
+            std::cout << std::endl << "-> Define the file where to store the results."
+                      << std::endl;
+            }
+        else
+            {
+            break;
+            }
+        }
+    while (1);
+
+    create_Simulations();
+
+    hasLoaded = true;
+}
+
+void Simulation_PairedComparison::save(std::string SimConfigFileName)
+{
+    SimulationType::save(SimConfigFileName);
+
+    std::ofstream SimConfigFile(SimConfigFileName,
+                                std::ofstream::out | std::ofstream::app);
+#ifdef RUN_ASSERTIONS
+    if (!SimConfigFile.is_open())
+        {
+        std::cerr << "Output file is not open" << std::endl;
+        abort();
+        }
+#endif
+
+    SimConfigFile << "  NetworkType = " << NetworkTypesNicknames.left.at(
+                      Type) << std::endl;
+
+    SimConfigFile.close();
+
+    Link::save(SimConfigFileName, T);
+
+    SimConfigFile.open(SimConfigFileName,
+                       std::ofstream::out | std::ofstream::app);
+
+#ifdef RUN_ASSERTIONS
+    if (!SimConfigFile.is_open())
+        {
+        std::cerr << "Output file is not open" << std::endl;
+        abort();
+        }
+#endif
+
+    //One line per configuration, in the same order, for each key
+    SimConfigFile << std::endl << "  [algorithms]" << std::endl << std::endl;
+    for (auto &Config : Configurations)
+        {
+        SimConfigFile << "  RoutingAlgorithm = " <<
+                      RoutingAlgorithm::RoutingAlgorithmNicknames.left.at(
+                          Config.Routing_Algorithm) << std::endl;
+        SimConfigFile << "  RoutingCost = " << RoutingCost::RoutingCostsNicknames.left.at(
+                          Config.Routing_Cost) << std::endl;
+        SimConfigFile << "  WavelengthAssignmentAlgorithm = " <<
+                      SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithmNicknames.left.at(
+                          Config.WavAssign_Algorithm) << std::endl;
+        if (Type == TranslucentNetwork)
+            {
+            SimConfigFile << "  RegeneratorAssignmentAlgorithm = " <<
+                          RegeneratorAssignmentAlgorithm::RegeneratorAssignmentNicknames.left.at(
+                              Config.RegAssignment_Algorithm) << std::endl;
+            }
+        }
+    if (Type == TranslucentNetwork)
+        {
+        SimConfigFile << "  RegeneratorPlacementAlgorithm = " <<
+                      RegeneratorPlacementAlgorithm::RegeneratorPlacementNicknames.left.at(
+                          RegPlacement_Algorithm) << std::endl;
+        }
+
+    SimConfigFile << std::endl << "  [sim_info]" << std::endl << std::endl;
+    SimConfigFile << "  NumCalls = " << NumCalls << std::endl;
+    SimConfigFile << "  NetworkLoad = " << NetworkLoad << std::endl;
+    SimConfigFile << "  ConfidenceLevel = " << ConfidenceLevel << std::endl;
+
+    if(Type == TranslucentNetwork)
+        {
+        SimConfigFile << "  numTranslucentNodes = " << NX_RegeneratorPlacement::NX_N <<
+                      std::endl;
+        SimConfigFile << "  numReg = " << NX_RegeneratorPlacement::NX_X << std::endl;
+        }
+
+    SimConfigFile << std::endl;
+    T->save(SimConfigFileName);
+}
+
+void Simulation_PairedComparison::load_file(std::string ConfigFileName)
+{
+    using namespace boost::program_options;
+
+    options_description ConfigDesctription("Configurations Data");
+    ConfigDesctription.add_options()("general.SimulationType",
+                                     value<std::string>()->required(), "Simulation Type")
+    ("general.NetworkType", value<std::string>()->required(), "Network Type")
+    ("general.AvgSpanLength", value<long double>()->required(),
+     "Distance Between Inline Amps.")
+    ("algorithms.RoutingAlgorithm", value<std::vector<std::string>>()->required(),
+     "Routing Algorithms")
+    ("algorithms.RoutingCost", value<std::vector<std::string>>()->required(),
+     "Routing Costs")
+    ("algorithms.WavelengthAssignmentAlgorithm",
+     value<std::vector<std::string>>()->required(),
+     "Wavelength Assignment Algorithms")
+    ("algorithms.RegeneratorPlacementAlgorithm", value<std::string>(),
+     "Regenerator Placement Algorithm")
+    ("algorithms.RegeneratorAssignmentAlgorithm", value<std::vector<std::string>>(),
+     "Regenerator Assignment Algorithms")
+    ("sim_info.NumCalls", value<long double>()->required(), "Number of Calls")
+    ("sim_info.NetworkLoad", value<long double>()->required(), "Network Load")
+    ("sim_info.ConfidenceLevel", value<long double>(), "Confidence Level")
+    ("sim_info.numTranslucentNodes", value<long double>(),
+     "Number of Translucent Nodes")
+    ("sim_info.numReg", value<long double>(), "Num. of Regenerators per Node");
+
+    variables_map VariablesMap;
+
+    std::ifstream ConfigFile(ConfigFileName, std::ifstream::in);
+#ifdef RUN_ASSERTIONS
+    if (!ConfigFile.is_open())
+        {
+        std::cerr << "Input file is not open" << std::endl;
+        abort();
+        }
+#endif
+    store(parse_config_file<char>(ConfigFile, ConfigDesctription, true),
+          VariablesMap);
+    ConfigFile.close();
+    notify(VariablesMap);
+
+    T = std::shared_ptr<Topology>(new Topology(ConfigFileName));
+    Type = NetworkTypesNicknames.right.at(
+               VariablesMap["general.NetworkType"].as<std::string>());
+    Link::DefaultAvgSpanLength =
+        VariablesMap["general.AvgSpanLength"].as<long double>();
+    T->set_avgSpanLength(VariablesMap["general.AvgSpanLength"].as<long double>());
+
+    auto RoutingAlgorithms =
+        VariablesMap["algorithms.RoutingAlgorithm"].as<std::vector<std::string>>();
+    auto RoutingCosts =
+        VariablesMap["algorithms.RoutingCost"].as<std::vector<std::string>>();
+    auto WavAssignAlgorithms =
+        VariablesMap["algorithms.WavelengthAssignmentAlgorithm"].as<std::vector<std::string>>();
+    std::vector<std::string> RegAssignAlgorithms;
+    if (Type == Network_Type::TranslucentNetwork)
+        {
+        RegAssignAlgorithms =
+            VariablesMap["algorithms.RegeneratorAssignmentAlgorithm"].as<std::vector<std::string>>();
+        }
+
+#ifdef RUN_ASSERTIONS
+    if (RoutingCosts.size() != RoutingAlgorithms.size() ||
+            WavAssignAlgorithms.size() != RoutingAlgorithms.size() ||
+            (Type == Network_Type::TranslucentNetwork &&
+             RegAssignAlgorithms.size() != RoutingAlgorithms.size()))
+        {
+        std::cerr << "Every configuration must define all of its algorithms." << std::endl;
+        abort();
+        }
+#endif
+
+    Configurations.clear();
+    for (size_t i = 0; i < RoutingAlgorithms.size(); i++)
+        {
+        Configuration Config;
+        Config.Routing_Algorithm = RoutingAlgorithm::RoutingAlgorithmNicknames.right.at(
+                                       RoutingAlgorithms[i]);
+        Config.Routing_Cost = RoutingCost::RoutingCostsNicknames.right.at(
+                                  RoutingCosts[i]);
+        Config.WavAssign_Algorithm =
+            SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithmNicknames.right.at(
+                WavAssignAlgorithms[i]);
+        Config.RegAssignment_Algorithm =
+            (RegeneratorAssignmentAlgorithm::RegeneratorAssignmentAlgorithms) - 1;
+        if (Type == Network_Type::TranslucentNetwork)
+            {
+            Config.RegAssignment_Algorithm =
+                RegeneratorAssignmentAlgorithm::RegeneratorAssignmentNicknames.right.at(
+                    RegAssignAlgorithms[i]);
+            }
+        Configurations.push_back(Config);
+        }
+
+    if(Type == Network_Type::TranslucentNetwork)
+        {
+        RegPlacement_Algorithm =
+            RegeneratorPlacementAlgorithm::RegeneratorPlacementNicknames.right.at(
+                VariablesMap["algorithms.RegeneratorPlacementAlgorithm"].as<std::string>());
+        NX_RegeneratorPlacement::NX_N =
+            VariablesMap["sim_info.numTranslucentNodes"].as<long double>();
+        NX_RegeneratorPlacement::NX_X =
+            VariablesMap["sim_info.numReg"].as<long double>();
+        }
+    NumCalls = VariablesMap["sim_info.NumCalls"].as<long double>();
+    NetworkLoad = VariablesMap["sim_info.NetworkLoad"].as<long double>();
+    if (VariablesMap.count("sim_info.ConfidenceLevel"))
+        {
+        ConfidenceLevel = VariablesMap["sim_info.ConfidenceLevel"].as<long double>();
+        }
+
+    std::cout << std::endl << "-> Define the file where to store the results."
+              << std::endl;
+    do
+        {
+        std::cin >> FileName;
+
+        if (std::cin.fail())
+            {
+            std::cin.clear();
+            std::cin.ignore();
+
+            std::cerr << "Invalid filename." << std::endl;
+            std::cout << std::endl << "-> Define the file where to store the results."
+                      << std::endl;
+            }
+        else
+            {
+            break;
+            }
+        }
+    while (1);
+
+    create_Simulations();
+
+    hasLoaded = true;
+    runLoadNX = false;
+}
+
+void Simulation_PairedComparison::create_Simulations()
+{
+    if (Type == TranslucentNetwork)
+        {
+        place_Regenerators(T);
+        }
+
+    for (auto &Config : Configurations)
+        {
+        //Creates a copy of the topology.
+        std::shared_ptr<Topology> TopologyCopy(new Topology(*T));
+
+        //Creates the RMSA Algorithms
+        std::shared_ptr<RoutingAlgorithm> R_Alg =
+            RoutingAlgorithm::create_RoutingAlgorithm
+            (Config.Routing_Algorithm, Config.Routing_Cost, TopologyCopy);
+        std::shared_ptr<SA::SpectrumAssignmentAlgorithm> WA_Alg =
+            SA::SpectrumAssignmentAlgorithm::create_SpectrumAssignmentAlgorithm(
+                Config.WavAssign_Algorithm, TopologyCopy);
+        std::shared_ptr<RegeneratorAssignmentAlgorithm> RA_Alg;
+
+        if (Type == TranslucentNetwork)
+            {
+            RA_Alg = RegeneratorAssignmentAlgorithm::create_RegeneratorAssignmentAlgorithm(
+                         Config.RegAssignment_Algorithm, TopologyCopy);
+            }
+        else
+            {
+            RA_Alg = nullptr;
+            }
+
+        //Creates the Call Generator and the RMSA Object
+        std::shared_ptr<CallGenerator> Generator(new CallGenerator(TopologyCopy,
+                NetworkLoad));
+        std::shared_ptr<RoutingWavelengthAssignment> RMSA(
+            new RoutingWavelengthAssignment(
+                R_Alg, WA_Alg, RA_Alg, ModulationScheme::DefaultSchemes, TopologyCopy));
+
+        //Push simulation into stack
+        simulations.push_back(
+            std::shared_ptr<NetworkSimulation>(new NetworkSimulation(
+                    Generator, RMSA, NumCalls)));
+
+        //Same streams for every configuration: the call requests are common.
+        //No stopping rule, so that every configuration sees the same calls.
+        simulations.back()->set_RandomStreams(0);
+        simulations.back()->set_StoppingRule(0, ConfidenceLevel);
+        simulations.back()->set_BlockingHistory(true);
+        }
+}
+
+void Simulation_PairedComparison::place_Regenerators(std::shared_ptr<Topology>
+        T)
+{
+    auto &Config = Configurations.front();
+
+    std::shared_ptr<RoutingAlgorithm> R_Alg =
+        RoutingAlgorithm::create_RoutingAlgorithm(
+            Config.Routing_Algorithm, Config.Routing_Cost, T);
+    std::shared_ptr<SA::SpectrumAssignmentAlgorithm> WA_Alg =
+        SA::SpectrumAssignmentAlgorithm::create_SpectrumAssignmentAlgorithm(
+            Config.WavAssign_Algorithm, T);
+    std::shared_ptr<RegeneratorAssignmentAlgorithm> RA_Alg =
+        RegeneratorAssignmentAlgorithm::create_RegeneratorAssignmentAlgorithm(
+            Config.RegAssignment_Algorithm, T);
+    std::shared_ptr<RoutingWavelengthAssignment> RMSA(
+        new RoutingWavelengthAssignment(
+            R_Alg, WA_Alg, RA_Alg, ModulationScheme::DefaultSchemes, T));
+
+    std::shared_ptr<RegeneratorPlacementAlgorithm> RP_Alg =
+        RegeneratorPlacementAlgorithm::create_RegeneratorPlacementAlgorithm(
+            RegPlacement_Algorithm, T, RMSA, NetworkLoad, NumCalls, runLoadNX);
+
+    RP_Alg->placeRegenerators();
+}
+
+std::string Simulation_PairedComparison::get_ConfigurationName(size_t i)
+{
+    auto &Config = Configurations.at(i);
+
+    std::string Name = "(" + std::to_string(i) + ") " +
+                       RoutingAlgorithm::RoutingAlgorithmNicknames.left.at(Config.Routing_Algorithm) +
+                       "/" + RoutingCost::RoutingCostsNicknames.left.at(Config.Routing_Cost) +
+                       "/" + SpectrumAssignmentAlgorithm::SpectrumAssignmentAlgorithmNicknames.left.at(
+                           Config.WavAssign_Algorithm);
+
+    if (Type == TranslucentNetwork)
+        {
+        Name += "/" + RegeneratorAssignmentAlgorithm::RegeneratorAssignmentNicknames.left.at(
+                    Config.RegAssignment_Algorithm);
+        }
+
+    return Name;
+}
@@ -546,6 +546,7 @@ void Simulation_PowerRatioThreshold::create_Simulations()
         simulations.push_back(
             std::shared_ptr<NetworkSimulation>(new NetworkSimulation(
                     Generator, RMSA, NumCalls)));
+        simulations.back()->set_RandomStreams(simulations.size() - 1);
 
         }
 }
@@ -482,6 +482,7 @@ void Simulation_RegeneratorNumber::createSimulations()
         simulations.push_back(
             std::shared_ptr<NetworkSimulation>(new NetworkSimulation(
                     Generator, RMSA, NumCalls)));
+        simulations.back()->set_RandomStreams(simulations.size() - 1);
         }
 }
 
@@ -218,6 +218,7 @@ void Simulation_StatisticalTrend::create_Simulations()
         //Push simulation into stack
         simulations.push_back(
             std::make_shared<NetworkSimulation>(Generator, RMSA, NumCalls));
+        simulations.back()->set_RandomStreams(0, i);
         }
 }
 
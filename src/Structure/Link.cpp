@@ -10,12 +10,15 @@
 
 using namespace Devices;
 
-int Link::NumSlots = 64;
+extern bool considerFilterImperfection;
+
+int Link::DefaultNumSlots = 64;
 double Link::DefaultAvgSpanLength = -1;
 
 Link::Link(std::weak_ptr<Node> Origin,
            std::weak_ptr<Node> Destination,
-           double Length)
+           double Length, std::shared_ptr<NetworkState> State, int NumSlots) :
+    NumSlots(NumSlots), State(State)
 {
 #ifdef RUN_ASSERTIONS
     if (Length < 0)
@@ -27,39 +30,88 @@ Link::Link(std::weak_ptr<Node> Origin,
     this->Origin = Origin;
     this->Destination = Destination;
     this->Length = Length;
-    isActive = true;
     AvgSpanLength = DefaultAvgSpanLength;
 
+    if (!this->State)
+        {
+        this->State = std::make_shared<NetworkState>();
+        }
+    Index = this->State->add_Link(NumSlots);
+
     create_Slots();
     create_Devices();
 
-    linkSpecDens = std::make_shared<LinkSpectralDensity>(Slots);
+    if (considerFilterImperfection)
+        {
+        linkSpecDens = std::make_shared<LinkSpectralDensity>(NumSlots);
+        }
 }
 
-Link::Link(const Link &link) // linkSpecDens aqui?
+Link::Link(std::weak_ptr<Node> Origin, std::weak_ptr<Node> Destination,
+           const Link &link, std::shared_ptr<NetworkState> State) :
+    AvgSpanLength(link.AvgSpanLength), Origin(Origin), Destination(Destination),
+    Length(link.Length), numLineAmplifiers(link.numLineAmplifiers),
+    NumSlots(link.NumSlots), State(State)
+{
+    Index = State->add_Link(NumSlots);
+    create_Slots();
+
+    if (link.Devices.empty())
+        {
+        create_Devices();
+        }
+    else
+        {
+        //The preamplifier is the last device, and depends on the destination node.
+        Devices.assign(link.Devices.begin(), link.Devices.end() - 1);
+        Devices.push_back(std::make_shared<PreAmplifier>((Fiber &)*Devices.back(),
+                          *Destination.lock()));
+        }
+
+    if (considerFilterImperfection)
+        {
+        linkSpecDens = std::make_shared<LinkSpectralDensity>(NumSlots);
+        }
+}
+
+Link::Link(const Link &link) : NumSlots(link.NumSlots),
+    State(std::make_shared<NetworkState>())
 {
     Length = link.Length;
     Origin = link.Origin;
     Destination = link.Destination;
     AvgSpanLength = link.AvgSpanLength;
-    isActive = link.isActive;
+    Index = State->add_Link(NumSlots);
+    State->edit_Link(Index) = link.State->get_Link(link.Index);
 
-    for (auto &slot : link.Slots)
-        {
-        Slots.push_back(std::shared_ptr<Slot>(new Slot(*slot)));
-        }
+    create_Slots();
 
     for (auto &device : link.Devices)
         {
         Devices.push_back(device->clone());
         }
+
+    if (link.linkSpecDens)
+        {
+        linkSpecDens = std::make_shared<LinkSpectralDensity>(*link.linkSpecDens);
+        }
 }
 
 void Link::create_Slots()
 {
+    //The slots are allocated in a single block, and their pointers share it.
+    auto Block = std::make_shared<std::vector<Slot>>();
+    Block->reserve(NumSlots);
+    Slots.reserve(NumSlots);
+
     for (int i = 0; i < NumSlots; i++)
         {
-        Slots.push_back(std::shared_ptr<Slot>(new Slot(i)));
+        Block->emplace_back(i, this);
+        }
+
+    for (auto &slot : *Block)
+        {
+        Slots.push_back(std::shared_ptr<Slot>(Block, &slot));
         }
 }
 
@@ -139,30 +191,20 @@ bool Link::isSlotFree(int slot) const
         abort();
         }
 #endif
-    return (Slots[slot])->isFree;
+    return get_FreeSlots().test(slot);
 }
 
 int Link::get_Availability()
 {
-    int FreeSlots = 0;
-
-    for (auto &slot : Slots)
-        {
-        if (slot->isFree)
-            {
-            FreeSlots++;
-            }
-        }
-
-    return FreeSlots;
+    return State->get_Link(Index).get_NumFreeSlots();
 }
 
 int Link::get_Occupability()
 {
-    return Link::NumSlots - get_Availability();
+    return NumSlots - get_Availability();
 }
 
-int Link::get_Contiguity(std::shared_ptr<Call> C)
+int Link::get_Contiguity(const std::shared_ptr<Call> &C)
 {
 #ifdef RUN_ASSERTIONS
     if (C->Scheme.get_M() == 0)
@@ -173,28 +215,7 @@ int Link::get_Contiguity(std::shared_ptr<Call> C)
         abort();
         }
 #endif
-    int NumRequiredSlots = C->Scheme.get_NumSlots(C->Bitrate);
-    int Contiguity = 0;
-    int CurrentFreeSlots = 0;
-
-    for (int s = 0; s < Link::NumSlots; s++)
-        {
-        if (Slots[s]->isFree)
-            {
-            CurrentFreeSlots++;
-            }
-        else
-            {
-            CurrentFreeSlots = 0;
-            }
-
-        if (CurrentFreeSlots >= NumRequiredSlots)
-            {
-            Contiguity++;
-            }
-        }
-
-    return Contiguity;
+    return State->get_Link(Index).get_NumPositions(C->Scheme.get_NumSlots(C->Bitrate));
 }
 
 void Link::load(std::shared_ptr<Topology> T)
@@ -275,12 +296,12 @@ void Link::set_AvgSpanLength(double avgSpanLength)
 
 void Link::set_LinkActive()
 {
-    isActive = true;
+    State->edit_Link(Index).set_Active(true);
 }
 
 void Link::set_LinkInactive()
 {
-    isActive = false;
+    State->edit_Link(Index).set_Active(false);
 }
 
 std::ostream& operator <<(std::ostream &out, const Link &link)
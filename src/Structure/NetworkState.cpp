@@ -0,0 +1,157 @@
+#include <Structure/NetworkState.h>
+#include <cmath>
+#include <iostream>
+
+NetworkState::LinkState::LinkState(unsigned int NumSlots) : FreeSlots(NumSlots, true),
+    isActive(true), Version(0), NumPositions(NumSlots, 0), LargestFreeBlock(0),
+    BlockEntropySum(0)
+{
+    add_FreeBlock(NumSlots);
+}
+
+void NetworkState::LinkState::use_Slot(unsigned int s)
+{
+#ifdef RUN_ASSERTIONS
+    if (!FreeSlots.test(s))
+        {
+        std::cerr << "Only free slots can be used." << std::endl;
+        abort();
+        }
+#endif
+
+    //The block containing s is split around it
+    unsigned int Begin = FreeSlots.find_Previous(s, false) + 1;
+    unsigned int End = FreeSlots.find_Next(s, false);
+    FreeSlots.reset(s);
+
+    remove_FreeBlock(End - Begin);
+    add_FreeBlock(s - Begin);
+    add_FreeBlock(End - s - 1);
+
+    while (LargestFreeBlock > 0 && NumPositions[LargestFreeBlock - 1] == 0)
+        {
+        LargestFreeBlock--;
+        }
+
+    Version++;
+}
+
+void NetworkState::LinkState::free_Slot(unsigned int s)
+{
+#ifdef RUN_ASSERTIONS
+    if (FreeSlots.test(s))
+        {
+        std::cerr << "Only used slots can be freed." << std::endl;
+        abort();
+        }
+#endif
+
+    //The blocks around s are merged with it
+    FreeSlots.set(s);
+    unsigned int Begin = FreeSlots.find_Previous(s, false) + 1;
+    unsigned int End = FreeSlots.find_Next(s, false);
+
+    remove_FreeBlock(s - Begin);
+    remove_FreeBlock(End - s - 1);
+    add_FreeBlock(End - Begin);
+
+    Version++;
+}
+
+void NetworkState::LinkState::set_Active(bool isActive)
+{
+    this->isActive = isActive;
+    Version++;
+}
+
+double NetworkState::LinkState::get_Fragmentation() const
+{
+    unsigned int NumFreeSlots = get_NumFreeSlots();
+
+    if (NumFreeSlots <= 1)
+        {
+        return 0;
+        }
+
+    double Entropy = std::log(NumFreeSlots) - BlockEntropySum / NumFreeSlots;
+    return std::min(std::max(Entropy / std::log(NumFreeSlots), 0.0), 1.0);
+}
+
+void NetworkState::LinkState::add_FreeBlock(unsigned int Length)
+{
+    for (unsigned int w = 1; w <= Length; w++)
+        {
+        NumPositions[w - 1] += Length - w + 1;
+        }
+
+    if (Length > 1)
+        {
+        BlockEntropySum += Length * std::log(Length);
+        }
+    LargestFreeBlock = std::max(LargestFreeBlock, Length);
+}
+
+void NetworkState::LinkState::remove_FreeBlock(unsigned int Length)
+{
+    for (unsigned int w = 1; w <= Length; w++)
+        {
+        NumPositions[w - 1] -= Length - w + 1;
+        }
+
+    if (Length > 1)
+        {
+        BlockEntropySum -= Length * std::log(Length);
+        }
+}
+
+NetworkState::NodeState::NodeState() : NumUsedRegenerators(0),
+    TotalNumRequestedRegenerators(0), MaxSimultUsedRegenerators(0), isActive(true)
+{
+
+}
+
+NetworkState::NetworkState() : NumLinks(0), NumNodes(0)
+{
+
+}
+
+unsigned int NetworkState::add_Link(unsigned int NumSlots)
+{
+    if (NumLinks % PageSize == 0)
+        {
+        LinkPages.push_back(std::make_shared<LinkPage>());
+        LinkPages.back()->reserve(PageSize);
+        }
+
+    own_Page(LinkPages.back())->push_back(LinkState(NumSlots));
+    return NumLinks++;
+}
+
+unsigned int NetworkState::add_Node()
+{
+    if (NumNodes % PageSize == 0)
+        {
+        NodePages.push_back(std::make_shared<NodePage>());
+        NodePages.back()->reserve(PageSize);
+        }
+
+    own_Page(NodePages.back())->push_back(NodeState());
+    return NumNodes++;
+}
+
+unsigned int NetworkState::get_NumSharedPages() const
+{
+    unsigned int NumShared = 0;
+
+    for (auto &page : LinkPages)
+        {
+        NumShared += page.use_count() > 1;
+        }
+
+    for (auto &page : NodePages)
+        {
+        NumShared += page.use_count() > 1;
+        }
+
+    return NumShared;
+}
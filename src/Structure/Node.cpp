@@ -36,23 +36,24 @@ Node::NodeArchNicknameBimap Node::NodeArchitecturesNicknames =
 #undef NODEARCH
     ;
 
-Node::Node(int ID, NodeType T, NodeArchitecture A) : ID(ID), Type(T) ,
-    Architecture(A)
+Node::Node(int ID, NodeType T, NodeArchitecture A,
+           std::shared_ptr<NetworkState> State) : ID(ID), Type(T) ,
+    Architecture(A), State(State)
 {
-    isActive = true;
+    if (!this->State)
+        {
+        this->State = std::make_shared<NetworkState>();
+        }
+    Index = this->State->add_Node();
     create_Devices();
-    TotalNumRequestedRegenerators =
-        MaxSimultUsedRegenerators =
-            NumUsedRegenerators = 0;
 }
 
-Node::Node(const Node &node) : ID(node.ID)
+Node::Node(const Node &node) : ID(node.ID), State(std::make_shared<NetworkState>())
 {
-    isActive = node.isActive;
+    Index = State->add_Node();
+    State->edit_Node(Index).isActive = node.is_NodeActive();
     Type = node.Type;
     Architecture = node.Architecture;
-    NumUsedRegenerators = 0;
-    TotalNumRequestedRegenerators = MaxSimultUsedRegenerators = 0;
 
     for (auto &link : node.Links)
         {
@@ -71,11 +72,7 @@ Node::Node(const Node &node) : ID(node.ID)
             }
         }
 
-    for (size_t i = 0; i < node.Regenerators.size(); i++)
-        {
-        Regenerators.push_back(std::shared_ptr<Device>(new Regenerator()));
-        }
-
+    Regenerators = node.Regenerators;
 }
 
 bool Node::operator ==(const Node &N) const
@@ -157,7 +154,7 @@ unsigned int Node::get_NumAvailableRegenerators()
         return std::numeric_limits<unsigned int>::max();
         }
 
-    return Regenerators.size() - NumUsedRegenerators;
+    return Regenerators.size() - State->get_Node(Index).NumUsedRegenerators;
 }
 
 void Node::create_Devices()
@@ -256,12 +253,13 @@ void Node::set_NumRegenerators(unsigned int NReg)
 {
     Regenerators.clear();
 
-    for (unsigned i = 0; i < NReg; i++)
+    //Regenerators have no state, so all of them share a single device.
+    if (NReg != 0)
         {
-        Regenerators.push_back(std::shared_ptr<Device>(new Regenerator()));
+        Regenerators.assign(NReg, std::make_shared<Regenerator>());
         }
 
-    NumUsedRegenerators = 0;
+    State->edit_Node(Index).NumUsedRegenerators = 0;
 }
 
 bool Node::hasAsNeighbour(std::weak_ptr<Node> N)
@@ -284,20 +282,22 @@ void Node::set_NodeType(NodeType T)
 
 void Node::request_Regenerators(unsigned int NReg)
 {
+    NetworkState::NodeState &NState = State->edit_Node(Index);
+
 #ifdef RUN_ASSERTIONS
-    if ((Type != OpaqueNode) && (NReg + NumUsedRegenerators > Regenerators.size()))
+    if ((Type != OpaqueNode) && (NReg + NState.NumUsedRegenerators > Regenerators.size()))
         {
         std::cerr << "Request to more regenerators than available." << std::endl;
         abort();
         }
 #endif
 
-    NumUsedRegenerators += NReg;
-    TotalNumRequestedRegenerators += NReg;
+    NState.NumUsedRegenerators += NReg;
+    NState.TotalNumRequestedRegenerators += NReg;
 
-    if (MaxSimultUsedRegenerators < NumUsedRegenerators)
+    if (NState.MaxSimultUsedRegenerators < NState.NumUsedRegenerators)
         {
-        MaxSimultUsedRegenerators = NumUsedRegenerators;
+        NState.MaxSimultUsedRegenerators = NState.NumUsedRegenerators;
         }
 
 }
@@ -305,22 +305,37 @@ void Node::request_Regenerators(unsigned int NReg)
 void Node::free_Regenerators(unsigned int NReg)
 {
 #ifdef RUN_ASSERTIONS
-    if (NumUsedRegenerators < NReg) {
+    if (State->get_Node(Index).NumUsedRegenerators < NReg) {
         std::cerr << "Freed more regenerators than available." << std::endl;
         abort();
     }
 #endif
-    NumUsedRegenerators -= NReg;
+    State->edit_Node(Index).NumUsedRegenerators -= NReg;
 }
 
 unsigned int Node::get_NumMaxSimultUsedRegenerators()
 {
-    return MaxSimultUsedRegenerators;
+    return State->get_Node(Index).MaxSimultUsedRegenerators;
 }
 
 unsigned long long Node::get_TotalNumRequestedRegenerators()
 {
-    return TotalNumRequestedRegenerators;
+    return State->get_Node(Index).TotalNumRequestedRegenerators;
+}
+
+unsigned int Node::get_NumUsedRegenerators()
+{
+    return State->get_Node(Index).NumUsedRegenerators;
+}
+
+void Node::set_RegeneratorUsage(unsigned int NumUsed,
+                                unsigned long long TotalNumRequested,
+                                unsigned int MaxSimultUsed)
+{
+    NetworkState::NodeState &NState = State->edit_Node(Index);
+    NState.NumUsedRegenerators = NumUsed;
+    NState.TotalNumRequestedRegenerators = TotalNumRequested;
+    NState.MaxSimultUsedRegenerators = MaxSimultUsed;
 }
 
 double Node::get_CapEx()
@@ -363,12 +378,12 @@ double Node::get_OpEx()
 
 void Node::set_NodeActive()
 {
-    isActive = true;
+    State->edit_Node(Index).isActive = true;
 }
 
 void Node::set_NodeInactive()
 {
-    isActive = false;
+    State->edit_Node(Index).isActive = false;
 }
 
 std::shared_ptr<SpectralDensity> Node::evalCrosstalk(Signal &S)
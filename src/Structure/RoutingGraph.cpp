@@ -0,0 +1,80 @@
+#include <Structure/RoutingGraph.h>
+#include <Structure/Link.h>
+#include <Structure/Node.h>
+#include <Structure/Topology.h>
+
+RoutingGraph::RoutingGraph(const Topology &T,
+                           std::shared_ptr<const NetworkState> State) :
+    NumNodes(T.Nodes.size()), NumLinks(T.Links.size()), LengthLongestLink(0),
+    State(State)
+{
+    Nodes.resize(NumNodes);
+    for (auto &node : T.Nodes)
+        {
+        Nodes[node->Index] = node;
+        }
+
+    Links.resize(NumLinks);
+    LinkOrigin.resize(NumLinks);
+    LinkDestination.resize(NumLinks);
+    LinkLength.resize(NumLinks);
+    LinkNumSpans.resize(NumLinks);
+
+    for (auto &link : T.Links)
+        {
+        unsigned int l = link.second->Index;
+        Links[l] = link.second;
+        LinkOrigin[l] = link.second->Origin.lock()->Index;
+        LinkDestination[l] = link.second->Destination.lock()->Index;
+        LinkLength[l] = link.second->Length;
+        LinkNumSpans[l] = link.second->numLineAmplifiers + 1;
+
+        if (LengthLongestLink < link.second->Length)
+            {
+            LengthLongestLink = link.second->Length;
+            }
+        }
+
+    FirstEdge.reserve(NumNodes + 1);
+    EdgeTarget.reserve(NumLinks);
+    EdgeLink.reserve(NumLinks);
+
+    for (auto &node : Nodes)
+        {
+        FirstEdge.push_back(EdgeLink.size());
+
+        for (auto &link : node->Links)
+            {
+            EdgeTarget.push_back(LinkDestination[link->Index]);
+            EdgeLink.push_back(link->Index);
+            }
+        }
+
+    FirstEdge.push_back(EdgeLink.size());
+
+    FirstInEdge.assign(NumNodes + 1, 0);
+    for (unsigned int l = 0; l < NumLinks; l++)
+        {
+        FirstInEdge[LinkDestination[l] + 1]++;
+        }
+    for (unsigned int n = 0; n < NumNodes; n++)
+        {
+        FirstInEdge[n + 1] += FirstInEdge[n];
+        }
+
+    InEdgeSource.resize(NumLinks);
+    InEdgeLink.resize(NumLinks);
+    std::vector<unsigned int> NextInEdge(FirstInEdge.begin(), FirstInEdge.end() - 1);
+    for (unsigned int l = 0; l < NumLinks; l++)
+        {
+        unsigned int e = NextInEdge[LinkDestination[l]]++;
+        InEdgeSource[e] = LinkOrigin[l];
+        InEdgeLink[e] = l;
+        }
+}
+
+RoutingGraph::RoutingGraph(const RoutingGraph &Graph,
+                           std::shared_ptr<const NetworkState> State) : RoutingGraph(Graph)
+{
+    this->State = State;
+}
@@ -3,44 +3,73 @@
 #include <GeneralClasses/LinkSpectralDensity.h>
 #include <GeneralClasses/PhysicalConstants.h>
 
-Slot::Slot(int numSlot) : numSlot(numSlot), isFree(true)
+Slot::Slot(int numSlot, Link *Owner) : numSlot(numSlot), Owner(Owner),
+    isFreeWithoutOwner(true)
 {
-    double centerFreq = PhysicalConstants::freq +
-                        BSlot * (numSlot - (Link::NumSlots / 2));
-    S = std::make_shared<SpectralDensity>(centerFreq - BSlot / 2.0,
-                                          centerFreq + BSlot / 2.0,
-                                          (int) samplesPerSlot, true);
+
+}
+
+double Slot::get_CenterFreq() const
+{
+    int NumSlots = Owner ? Owner->get_NumSlots() : Link::DefaultNumSlots;
+    return PhysicalConstants::freq + BSlot * (numSlot - (NumSlots / 2));
+}
+
+bool Slot::isFree() const
+{
+    return Owner != nullptr ? Owner->get_FreeSlots().test(numSlot) : isFreeWithoutOwner;
+}
+
+double Slot::get_FreqMin() const
+{
+    return get_CenterFreq() - BSlot / 2.0;
+}
+
+double Slot::get_FreqMax() const
+{
+    return get_CenterFreq() + BSlot / 2.0;
 }
 
 void Slot::freeSlot()
 {
 #ifdef RUN_ASSERTIONS
-    if (isFree)
+    if (isFree())
         {
         std::cerr << "Only occupied slots can be freed." << std::endl;
         abort();
         }
 #endif
-    isFree = true;
-    S->specDensity.zeros();
+    isFreeWithoutOwner = true;
+    if (Owner != nullptr)
+        {
+        Owner->State->edit_Link(Owner->Index).free_Slot(numSlot);
+        if (Owner->linkSpecDens)
+            {
+            Owner->linkSpecDens->clear_Slot(numSlot);
+            }
+        }
 }
 
 void Slot::useSlot()
 {
 #ifdef RUN_ASSERTIONS
-    if (!isFree)
+    if (!isFree())
         {
         std::cerr << "Only occupied slots can be used." << std::endl;
         abort();
         }
 #endif
-    isFree = false;
+    isFreeWithoutOwner = false;
+    if (Owner != nullptr)
+        {
+        Owner->State->edit_Link(Owner->Index).use_Slot(numSlot);
+        }
 }
 
-Slot::Slot(const Slot &slot)
+Slot::Slot(const Slot &slot) : Owner(nullptr)
 {
     numSlot = slot.numSlot;
-    isFree = slot.isFree;
+    isFreeWithoutOwner = slot.isFree();
 }
 
 Slot &Slot::operator =(const Slot &slot)
@@ -48,7 +77,20 @@ Slot &Slot::operator =(const Slot &slot)
     if (this != &slot)
         {
         numSlot = slot.numSlot;
-        isFree = slot.isFree;
+        isFreeWithoutOwner = slot.isFree();
+
+        if (Owner != nullptr)
+            {
+            auto &LState = Owner->State->edit_Link(Owner->Index);
+            if (isFreeWithoutOwner && !LState.FreeSlots.test(numSlot))
+                {
+                LState.free_Slot(numSlot);
+                }
+            else if (!isFreeWithoutOwner && LState.FreeSlots.test(numSlot))
+                {
+                LState.use_Slot(numSlot);
+                }
+            }
         }
 
     return *this;
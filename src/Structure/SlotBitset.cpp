@@ -0,0 +1,280 @@
+#include <Structure/SlotBitset.h>
+#include <algorithm>
+#include <iostream>
+
+SlotBitset::SlotBitset(unsigned NumSlots, bool isSet) : NumSlots(NumSlots)
+{
+    if (NumSlots > MaxSlots)
+        {
+        std::cerr << "Too many slots for a SlotBitset." << std::endl;
+        abort();
+        }
+
+    std::fill(InlineWords, InlineWords + NumInlineWords, 0);
+    if (NumSlots > InlineSlots)
+        {
+        HeapWords.assign((NumSlots + WordSize - 1) / WordSize, 0);
+        }
+
+    Word *Words = get_Words();
+    unsigned NumWords = HeapWords.empty() ? NumInlineWords : HeapWords.size();
+
+    for (unsigned w = 0; w < NumWords && isSet; w++)
+        {
+        unsigned FirstSlot = w * WordSize;
+
+        if (FirstSlot >= NumSlots)
+            {
+            break;
+            }
+        else if (NumSlots - FirstSlot >= WordSize)
+            {
+            Words[w] = ~Word(0);
+            }
+        else
+            {
+            Words[w] = (Word(1) << (NumSlots - FirstSlot)) - 1;
+            }
+        }
+}
+
+bool SlotBitset::operator==(const SlotBitset &Other) const
+{
+    return NumSlots == Other.NumSlots && HeapWords == Other.HeapWords &&
+           std::equal(InlineWords, InlineWords + NumInlineWords, Other.InlineWords);
+}
+
+namespace
+{
+typedef SlotBitset::Word Word;
+constexpr unsigned WordSize = SlotBitset::WordSize;
+
+/*
+ * The kernels take the width of the set as a template parameter, so that the
+ * number of words is a compile time constant and their loops are unrolled.
+ * Width 0 instantiates the generic kernels, that read the width at run time.
+ */
+template<unsigned Width>
+inline unsigned get_Width(unsigned NumSlots)
+{
+    return Width ? Width : NumSlots;
+}
+
+template<unsigned Width>
+inline unsigned get_NumWords(unsigned NumSlots)
+{
+    return (get_Width<Width>(NumSlots) + WordSize - 1) / WordSize;
+}
+
+template<unsigned Width>
+unsigned count(const Word *Words, unsigned NumSlots)
+{
+    const unsigned NumWords = get_NumWords<Width>(NumSlots);
+    unsigned Count = 0;
+
+    for (unsigned w = 0; w < NumWords; w++)
+        {
+        Count += __builtin_popcountll(Words[w]);
+        }
+
+    return Count;
+}
+
+template<unsigned Width>
+unsigned find_Next(const Word *Words, unsigned NumSlots, unsigned s, bool isSet)
+{
+    const unsigned Size = get_Width<Width>(NumSlots);
+    const unsigned NumWords = get_NumWords<Width>(NumSlots);
+
+    if (s >= Size)
+        {
+        return Size;
+        }
+
+    unsigned w = s / WordSize;
+    //Complemented when looking for unset bits, and with the bits before s cleared
+    Word Current = (isSet ? Words[w] : ~Words[w]) & (~Word(0) << (s % WordSize));
+
+    while (Current == 0)
+        {
+        if (++w == NumWords)
+            {
+            return Size;
+            }
+        Current = isSet ? Words[w] : ~Words[w];
+        }
+
+    return std::min(w * WordSize + __builtin_ctzll(Current), Size);
+}
+
+/*
+ * get_RunStarts sets in Starts the bit of each slot that begins a run of at
+ * least Length set bits. Each step intersects the starts found so far with
+ * themselves shifted towards the lower slots, so the length covered doubles,
+ * without a branch on the bits.
+ */
+template<unsigned Width>
+void get_RunStarts(const Word *Words, unsigned NumSlots, unsigned Length,
+                   Word *Starts)
+{
+    const unsigned NumWords = get_NumWords<Width>(NumSlots);
+    std::copy(Words, Words + NumWords, Starts);
+
+    for (unsigned Covered = 1; Covered < Length;)
+        {
+        unsigned Shift = std::min(Covered, Length - Covered);
+        unsigned WordShift = Shift / WordSize;
+        unsigned BitShift = Shift % WordSize;
+
+        //In increasing order, so that only the words not yet updated are read
+        for (unsigned w = 0; w < NumWords; w++)
+            {
+            Word Shifted = 0;
+            if (w + WordShift < NumWords)
+                {
+                Shifted = Starts[w + WordShift] >> BitShift;
+                if (BitShift != 0 && w + WordShift + 1 < NumWords)
+                    {
+                    Shifted |= Starts[w + WordShift + 1] << (WordSize - BitShift);
+                    }
+                }
+            Starts[w] &= Shifted;
+            }
+
+        Covered += Shift;
+        }
+}
+
+template<unsigned Width>
+int find_FirstRun(const Word *Words, unsigned NumSlots, unsigned Length)
+{
+    const unsigned NumWords = get_NumWords<Width>(NumSlots);
+    Word Starts[SlotBitset::MaxWords];
+    get_RunStarts<Width>(Words, NumSlots, Length, Starts);
+
+    for (unsigned w = 0; w < NumWords; w++)
+        {
+        if (Starts[w] != 0)
+            {
+            return w * WordSize + __builtin_ctzll(Starts[w]);
+            }
+        }
+
+    return -1;
+}
+
+template<unsigned Width>
+unsigned get_NumPositions(const Word *Words, unsigned NumSlots, unsigned Length)
+{
+    Word Starts[SlotBitset::MaxWords];
+    get_RunStarts<Width>(Words, NumSlots, Length, Starts);
+    return count<Width>(Starts, NumSlots);
+}
+
+template<unsigned Width>
+unsigned get_LongestRun(const Word *Words, unsigned NumSlots)
+{
+    const unsigned Size = get_Width<Width>(NumSlots);
+    unsigned LongestRun = 0;
+
+    unsigned Begin = find_Next<Width>(Words, NumSlots, 0, true);
+    while (Begin < Size)
+        {
+        unsigned End = find_Next<Width>(Words, NumSlots, Begin, false);
+        LongestRun = std::max(LongestRun, End - Begin);
+        Begin = find_Next<Width>(Words, NumSlots, End, true);
+        }
+
+    return LongestRun;
+}
+}
+
+unsigned SlotBitset::count() const
+{
+    switch (NumSlots)
+        {
+#define X(w) case w: return ::count<w>(get_Words(), NumSlots);
+            SLOTBITSET_WIDTHS
+#undef X
+        default:
+            return ::count<0>(get_Words(), NumSlots);
+        }
+}
+
+unsigned SlotBitset::find_Next(unsigned s, bool isSet) const
+{
+    switch (NumSlots)
+        {
+#define X(w) case w: return ::find_Next<w>(get_Words(), NumSlots, s, isSet);
+            SLOTBITSET_WIDTHS
+#undef X
+        default:
+            return ::find_Next<0>(get_Words(), NumSlots, s, isSet);
+        }
+}
+
+int SlotBitset::find_Previous(unsigned s, bool isSet) const
+{
+    if (NumSlots == 0)
+        {
+        return -1;
+        }
+    s = std::min(s, NumSlots - 1);
+
+    const Word *Words = get_Words();
+    int w = s / WordSize;
+    //Complemented when looking for unset bits, and with the bits after s cleared
+    Word Current = (isSet ? Words[w] : ~Words[w]) &
+                   (~Word(0) >> (WordSize - 1 - s % WordSize));
+
+    while (Current == 0)
+        {
+        if (--w < 0)
+            {
+            return -1;
+            }
+        Current = isSet ? Words[w] : ~Words[w];
+        }
+
+    return w * WordSize + WordSize - 1 - __builtin_clzll(Current);
+}
+
+int SlotBitset::find_FirstRun(unsigned Length) const
+{
+    Length = std::max(Length, 1u);
+
+    switch (NumSlots)
+        {
+#define X(w) case w: return ::find_FirstRun<w>(get_Words(), NumSlots, Length);
+            SLOTBITSET_WIDTHS
+#undef X
+        default:
+            return ::find_FirstRun<0>(get_Words(), NumSlots, Length);
+        }
+}
+
+unsigned SlotBitset::get_LongestRun() const
+{
+    switch (NumSlots)
+        {
+#define X(w) case w: return ::get_LongestRun<w>(get_Words(), NumSlots);
+            SLOTBITSET_WIDTHS
+#undef X
+        default:
+            return ::get_LongestRun<0>(get_Words(), NumSlots);
+        }
+}
+
+unsigned SlotBitset::get_NumPositions(unsigned Length) const
+{
+    Length = std::max(Length, 1u);
+
+    switch (NumSlots)
+        {
+#define X(w) case w: return ::get_NumPositions<w>(get_Words(), NumSlots, Length);
+            SLOTBITSET_WIDTHS
+#undef X
+        default:
+            return ::get_NumPositions<0>(get_Words(), NumSlots, Length);
+        }
+}
@@ -1,10 +1,23 @@
 #include <Structure/Topology.h>
 #include <boost/assign.hpp>
-#include <boost/program_options.hpp>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstring>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <Structure/Link.h>
+#include <Structure/RoutingGraph.h>
+#include <Structure/Slot.h>
+#include <GeneralClasses/BinaryStream.h>
+#include <GeneralClasses/SpectralDensity.h>
+
+extern bool considerFilterImperfection;
+
+const char Topology::BinaryMagic[8] = {'S', 'I', 'M', 'E', 'O', 'N', 'T', 'B'};
 
 Topology::DefaultTopNamesBimap Topology::DefaultTopologiesNames =
     boost::assign::list_of<Topology::DefaultTopNamesBimap::relation>
@@ -21,14 +34,16 @@ Topology::DefaultTopPathsBimap Topology::DefaultTopologiesPaths =
 #undef DEFAULT_TOPOLOGIES
     ;
 
-Topology::Topology() : PowerRatioThreshold(0.6, Gain::Linear)
+Topology::Topology() : PowerRatioThreshold(0.6, Gain::Linear),
+    NumSlots(Link::DefaultNumSlots), State(std::make_shared<NetworkState>())
 {
     Nodes.clear();
     Links.clear();
     AvgSpanLength = LongestLink = -1;
 }
 
-Topology::Topology(const Topology &topology) : PowerRatioThreshold(0.6, Gain::Linear)
+Topology::Topology(const Topology &topology) : PowerRatioThreshold(0.6, Gain::Linear),
+    NumSlots(topology.NumSlots), State(std::make_shared<NetworkState>())
 {
     Nodes.clear();
     Links.clear();
@@ -37,119 +52,249 @@ Topology::Topology(const Topology &topology) : PowerRatioThreshold(0.6, Gain::Li
 
     for (auto &node : topology.Nodes)
         {
-        add_Node(node->ID,
-                 node->get_NodeType(),
-                 node->get_NodeArch(),
-                 node->get_NumRegenerators());
+        Nodes.push_back(std::make_shared<Node>(node->ID, node->get_NodeType(),
+                                               node->get_NodeArch(), State));
+        Nodes.back()->Regenerators = node->Regenerators;
         }
 
+    //The links are added in the same order, so that they have the same indices.
+    std::vector<std::shared_ptr<Link>> LinksByIndex(topology.Links.size());
     for (auto &link : topology.Links)
         {
-        std::weak_ptr<Node> orig = Nodes.front();
-        std::weak_ptr<Node> dest = Nodes.front();
-
-        for (auto node = Nodes.begin(); node != Nodes.end(); ++node)
-            {
-            if (*(*node) == *(link.second->Origin.lock()))
-                {
-                orig = *node;
-                }
+        LinksByIndex[link.second->Index] = link.second;
+        }
 
-            if (*(*node) == *(link.second->Destination.lock()))
-                {
-                dest = *node;
-                }
-            }
+    for (auto &link : LinksByIndex)
+        {
+        std::shared_ptr<Node> orig = Nodes[link->Origin.lock()->Index];
+        std::shared_ptr<Node> dest = Nodes[link->Destination.lock()->Index];
 
-        add_Link(orig, dest, link.second->Length);
+        auto newLink = std::make_shared<Link>(orig, dest, *link, State);
+        Links.emplace(std::make_pair(orig->ID, dest->ID), newLink);
+        orig->insert_Link(dest, newLink);
         }
 }
 
-Topology::Topology(std::string TopologyFileName) : PowerRatioThreshold(0.6, Gain::Linear)
+Topology::Topology(std::string TopologyFileName) : PowerRatioThreshold(0.6, Gain::Linear),
+    NumSlots(Link::DefaultNumSlots), State(std::make_shared<NetworkState>())
 {
-    using namespace boost::program_options;
-
     Nodes.clear();
     Links.clear();
     AvgSpanLength = LongestLink = -1;
 
-    options_description TopologyDescription("Topology");
-    TopologyDescription.add_options()
-    ("nodes.node", value<std::vector<std::string>>()->multitoken(),
-     "Node Description")
-    ("links.->", value<std::vector<std::string>>()->multitoken(),
-     "Unidirectional Link Description");
+    char Magic[sizeof(BinaryMagic)];
+    std::ifstream TopologyFile(TopologyFileName, std::ifstream::in | std::ifstream::binary);
+    TopologyFile.read(Magic, sizeof(Magic));
+    bool isBinary = TopologyFile.gcount() == sizeof(Magic) &&
+                    std::memcmp(Magic, BinaryMagic, sizeof(Magic)) == 0;
+    TopologyFile.close();
 
-    variables_map VariablesMap;
+    if (isBinary)
+        {
+        if (!load_Binary(TopologyFileName))
+            {
+            std::cerr << "Invalid topology file " << TopologyFileName << "." << std::endl;
+            abort();
+            }
+        }
+    else
+        {
+        load_Text(TopologyFileName);
+        }
+}
 
-    store(parse_config_file<char>(TopologyFileName.c_str(), TopologyDescription,
-                                  true), VariablesMap);
+void Topology::load_Text(std::string TopologyFileName)
+{
+    std::ifstream TopologyFile(TopologyFileName, std::ifstream::in);
+#ifdef RUN_ASSERTIONS
+    if (!TopologyFile.is_open())
+        {
+        std::cerr << "Input file is not open" << std::endl;
+        abort();
+        }
+#endif
 
-    //Reads nodes from configuration file.
-    std::vector<std::string> NodesList =
-        VariablesMap.find("nodes.node")->second.as<std::vector<std::string>>();
+    //The links are only added after the whole file is read, as the number of
+    //slots and the nodes may come after them.
+    struct LinkDescription
+    {
+        int OriginID, DestinationID;
+        double Length;
+    };
+    std::vector<LinkDescription> LinksList;
+    std::unordered_map<int, std::shared_ptr<Node>> NodesByID;
 
-    for (auto &node : NodesList)
+    auto trim = [](const std::string & Str, size_t Begin, size_t End)
         {
-        int NodeId, NumReg;
-        std::string StrType, StrArch;
+        Begin = Str.find_first_not_of(" \t\r", Begin);
+        if (Begin >= End)
+            {
+            return std::string();
+            }
+        End = Str.find_last_not_of(" \t\r", End - 1);
+        return Str.substr(Begin, End - Begin + 1);
+        };
 
-        std::istringstream NodeParameters(node);
-        NodeParameters >> NodeId >> StrType >> StrArch >> NumReg;
+    std::string Line, Section;
+    while (std::getline(TopologyFile, Line))
+        {
+        //Anything after a # is a comment.
+        Line = trim(Line, 0, std::min(Line.find('#'), Line.size()));
 
-        Node::NodeType Type = Node::NodeTypes.right.at(StrType);
-        Node::NodeArchitecture Arch = Node::NodeArchitecturesNicknames.
-                                      right.at(StrArch);
+        if (Line.empty())
+            {
+            continue;
+            }
+
+        if (Line.front() == '[')
+            {
+            Section = trim(Line, 1, std::min(Line.find(']'), Line.size()));
+            continue;
+            }
+
+        size_t Equal = Line.find('=');
+        if (Equal == std::string::npos)
+            {
+            continue;
+            }
+        std::string Key = trim(Line, 0, Equal);
+        std::istringstream Parameters(Line.substr(Equal + 1));
 
-        add_Node(NodeId, Type, Arch, NumReg);
+        if (Section == "nodes" && Key == "node")
+            {
+            int NodeId, NumReg;
+            std::string StrType, StrArch;
+            Parameters >> NodeId >> StrType >> StrArch >> NumReg;
+
+            Node::NodeType Type = Node::NodeTypes.right.at(StrType);
+            Node::NodeArchitecture Arch = Node::NodeArchitecturesNicknames.
+                                          right.at(StrArch);
+
+            NodesByID[NodeId] = add_Node(NodeId, Type, Arch, NumReg).lock();
+            }
+        else if (Section == "links" && Key == "slots")
+            {
+            int NumSlots;
+            Parameters >> NumSlots;
+            set_NumSlots(NumSlots);
+            }
+        else if (Section == "links" && Key == "->")
+            {
+            LinkDescription Description;
+            Parameters >> Description.OriginID >> Description.DestinationID >>
+                       Description.Length;
+            LinksList.push_back(Description);
+            }
         }
 
-    //Reads links from configuration file.
-    std::vector<std::string> LinksList =
-        VariablesMap.find("links.->")->second.as<std::vector<std::string>>();
+#ifdef RUN_ASSERTIONS
+    if (Nodes.empty())
+        {
+        std::cerr << "The topology has no nodes." << std::endl;
+        abort();
+        }
+#endif
 
     for (auto &link : LinksList)
         {
-        int OriginID, DestinationID;
-        double length;
-        std::weak_ptr<Node> Origin, Destination;
-
-        std::istringstream LinkParameters(link);
-        LinkParameters >> OriginID >> DestinationID >> length;
 #ifdef RUN_ASSERTIONS
-        if (OriginID == DestinationID)
+        if (link.OriginID == link.DestinationID)
             {
             std::cerr << "Link can't have the same Origin and Destination." << std::endl;
             abort();
             }
+
+        if (!NodesByID.count(link.OriginID) || !NodesByID.count(link.DestinationID))
+            {
+            std::cerr << "Link with invalid origin and/or destination." << std::endl;
+            abort();
+            }
 #endif
 
-        int NodesFound = 0;
+        add_Link(NodesByID[link.OriginID], NodesByID[link.DestinationID], link.Length);
+        }
+}
 
-        for (auto &node : Nodes)
-            {
-            if (node->ID == OriginID)
-                {
-                Origin = node;
-                NodesFound++;
-                }
+bool Topology::load_Binary(std::string TopologyFileName)
+{
+    int FileDescriptor = open(TopologyFileName.c_str(), O_RDONLY);
+    if (FileDescriptor < 0)
+        {
+        return false;
+        }
 
-            if (node->ID == DestinationID)
-                {
-                Destination = node;
-                NodesFound++;
-                }
-            }
+    struct stat FileStatus;
+    if (fstat(FileDescriptor, &FileStatus) != 0 ||
+            (size_t) FileStatus.st_size < sizeof(BinaryHeader))
+        {
+        ::close(FileDescriptor);
+        return false;
+        }
 
-#ifdef RUN_ASSERTIONS
-        if (NodesFound != 2) {
-            std::cerr << "Link with invalid origin and/or destination." << std::endl;
-            abort();
+    size_t MappingSize = FileStatus.st_size;
+    void *Mapping = mmap(nullptr, MappingSize, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+    ::close(FileDescriptor);
+    if (Mapping == MAP_FAILED)
+        {
+        return false;
+        }
+
+    //The whole file is validated before the topology is changed
+    const BinaryHeader *Header = static_cast<const BinaryHeader *>(Mapping);
+    size_t RecordsSize = MappingSize - sizeof(BinaryHeader);
+    bool isValid = std::memcmp(Header->Magic, BinaryMagic, sizeof(BinaryMagic)) == 0 &&
+                   Header->Version == BinaryVersion &&
+                   Header->NumSlots > 0 && Header->NumSlots <= SlotBitset::MaxSlots &&
+                   Header->NumNodes <= RecordsSize / sizeof(NodeRecord) &&
+                   Header->NumLinks <= (RecordsSize - Header->NumNodes * sizeof(NodeRecord)) /
+                   sizeof(LinkRecord);
+
+    const NodeRecord *NodeRecords = reinterpret_cast<const NodeRecord *>(
+                                        static_cast<const char *>(Mapping) + sizeof(BinaryHeader));
+    const LinkRecord *LinkRecords = isValid ? reinterpret_cast<const LinkRecord *>(
+                                        NodeRecords + Header->NumNodes) : nullptr;
+
+    isValid = isValid && Header->Hash == get_Hash(Header->NumSlots, NodeRecords,
+              Header->NumNodes, LinkRecords, Header->NumLinks);
+
+    for (uint64_t n = 0; isValid && n < Header->NumNodes; n++)
+        {
+        isValid = Node::NodeTypes.left.count((Node::NodeType) NodeRecords[n].Type) &&
+                  Node::NodeArchitecturesNicknames.left.count(
+                      (Node::NodeArchitecture) NodeRecords[n].Architecture) &&
+                  NodeRecords[n].NumRegenerators >= 0;
         }
-#endif
 
-        add_Link(Origin, Destination, length);
+    for (uint64_t l = 0; isValid && l < Header->NumLinks; l++)
+        {
+        isValid = LinkRecords[l].Origin < Header->NumNodes &&
+                  LinkRecords[l].Destination < Header->NumNodes;
+        }
+
+    if (!isValid)
+        {
+        munmap(Mapping, MappingSize);
+        return false;
+        }
+
+    set_NumSlots(Header->NumSlots);
+
+    Nodes.reserve(Header->NumNodes);
+    for (uint64_t n = 0; n < Header->NumNodes; n++)
+        {
+        add_Node(NodeRecords[n].ID, (Node::NodeType) NodeRecords[n].Type,
+                 (Node::NodeArchitecture) NodeRecords[n].Architecture,
+                 NodeRecords[n].NumRegenerators);
+        }
+
+    for (uint64_t l = 0; l < Header->NumLinks; l++)
+        {
+        add_Link(Nodes[LinkRecords[l].Origin], Nodes[LinkRecords[l].Destination],
+                 LinkRecords[l].Length);
         }
+
+    munmap(Mapping, MappingSize);
+    return true;
 }
 
 std::weak_ptr<Node> Topology::add_Node(int NodeID, Node::NodeType Type,
@@ -160,19 +305,22 @@ std::weak_ptr<Node> Topology::add_Node(int NodeID, Node::NodeType Type,
         NodeID = Nodes.size() + 1;
         }
 
-    Nodes.push_back(std::make_shared<Node>(NodeID, Type, Arch));
+    Nodes.push_back(std::make_shared<Node>(NodeID, Type, Arch, State));
     Nodes.back()->set_NumRegenerators(NumReg);
+    Graph.reset();
     return (std::weak_ptr<Node>) Nodes.back();
 }
 
 std::weak_ptr<Link> Topology::add_Link(std::weak_ptr<Node> Origin,
                                        std::weak_ptr<Node> Destination, double Length)
 {
-    std::shared_ptr<Link> link = std::make_shared<Link>(Origin, Destination, Length);
+    std::shared_ptr<Link> link = std::make_shared<Link>(Origin, Destination, Length,
+                                 State, NumSlots);
 
     Links.emplace(std::make_pair(Origin.lock()->ID, Destination.lock()->ID), link);
     Origin.lock()->insert_Link(Destination, link);
     LongestLink = -1;
+    Graph.reset();
     if (AvgSpanLength != -1)
         {
         link->set_AvgSpanLength(AvgSpanLength);
@@ -209,15 +357,135 @@ void Topology::save(std::string TopologyFileName)
     TopologyFile << std::endl;
 
     TopologyFile << "  [links]" << std::endl << std::endl;
+    TopologyFile << "# slots = NUMBER OF FREQUENCY SLOTS PER LINK" << std::endl;
+    TopologyFile << "  slots = " << NumSlots << std::endl << std::endl;
     TopologyFile << "# -> = ORIGIN DESTINATION LENGTH" << std::endl;
 
-    for (auto it : Links)
+    //The links are saved in the order they were added, so that they keep their
+    //indices when loaded.
+    std::vector<std::shared_ptr<Link>> LinksByIndex(Links.size());
+    for (auto &link : Links)
+        {
+        LinksByIndex[link.second->Index] = link.second;
+        }
+
+    for (auto &link : LinksByIndex)
         {
-        TopologyFile << "  -> = " << it.second->Origin.lock().get()->ID << " " <<
-                     it.second->Destination.lock().get()->ID << " " <<
-                     it.second->Length << std::endl;
+        TopologyFile << "  -> = " << link->Origin.lock()->ID << " " <<
+                     link->Destination.lock()->ID << " " <<
+                     link->Length << std::endl;
+        }
+
+}
+
+void Topology::save_Binary(std::string TopologyFileName)
+{
+    std::ofstream TopologyFile(TopologyFileName, std::ofstream::out |
+                               std::ofstream::binary | std::ofstream::trunc);
+
+#ifdef RUN_ASSERTIONS
+    if (!TopologyFile.is_open())
+        {
+        std::cerr << "Output file is not open" << std::endl;
+        abort();
         }
+#endif
+
+    std::vector<NodeRecord> NodeRecords;
+    std::vector<LinkRecord> LinkRecords;
+    get_Records(NodeRecords, LinkRecords);
+
+    BinaryHeader Header;
+    std::memcpy(Header.Magic, BinaryMagic, sizeof(BinaryMagic));
+    Header.Version = BinaryVersion;
+    Header.NumSlots = NumSlots;
+    Header.NumNodes = NodeRecords.size();
+    Header.NumLinks = LinkRecords.size();
+    Header.Hash = get_Hash(NumSlots, NodeRecords.data(), NodeRecords.size(),
+                           LinkRecords.data(), LinkRecords.size());
+
+    BinaryStream::write(TopologyFile, Header);
+    TopologyFile.write(reinterpret_cast<const char *>(NodeRecords.data()),
+                       NodeRecords.size() * sizeof(NodeRecord));
+    TopologyFile.write(reinterpret_cast<const char *>(LinkRecords.data()),
+                       LinkRecords.size() * sizeof(LinkRecord));
+}
 
+uint64_t Topology::get_Hash() const
+{
+    std::vector<NodeRecord> NodeRecords;
+    std::vector<LinkRecord> LinkRecords;
+    get_Records(NodeRecords, LinkRecords);
+
+    return get_Hash(NumSlots, NodeRecords.data(), NodeRecords.size(),
+                    LinkRecords.data(), LinkRecords.size());
+}
+
+void Topology::get_Records(std::vector<NodeRecord> &NodeRecords,
+                           std::vector<LinkRecord> &LinkRecords) const
+{
+    NodeRecords.assign(Nodes.size(), NodeRecord());
+    for (auto &node : Nodes)
+        {
+        NodeRecord &Record = NodeRecords[node->Index];
+        Record.ID = node->ID;
+        Record.NumRegenerators = node->get_NumRegenerators();
+        Record.Type = node->get_NodeType();
+        Record.Architecture = node->get_NodeArch();
+        Record.Reserved = 0;
+        }
+
+    LinkRecords.assign(Links.size(), LinkRecord());
+    for (auto &link : Links)
+        {
+        LinkRecord &Record = LinkRecords[link.second->Index];
+        Record.Origin = link.second->Origin.lock()->Index;
+        Record.Destination = link.second->Destination.lock()->Index;
+        Record.Length = link.second->Length;
+        }
+}
+
+uint64_t Topology::get_Hash(uint32_t NumSlots,
+                            const NodeRecord *NodeRecords, uint64_t NumNodes,
+                            const LinkRecord *LinkRecords, uint64_t NumLinks)
+{
+    uint64_t Hash = 14695981039346656037ULL;
+
+    auto hash = [&Hash](const void *Data, size_t Size)
+        {
+        const unsigned char *Bytes = static_cast<const unsigned char *>(Data);
+        for (size_t i = 0; i < Size; i++)
+            {
+            Hash = (Hash ^ Bytes[i]) * 1099511628211ULL;
+            }
+        };
+
+    hash(&NumSlots, sizeof(NumSlots));
+    hash(NodeRecords, NumNodes * sizeof(NodeRecord));
+    hash(LinkRecords, NumLinks * sizeof(LinkRecord));
+
+    return Hash;
+}
+
+void Topology::set_NumSlots(int NumSlots)
+{
+#ifdef RUN_ASSERTIONS
+    if (!Links.empty())
+        {
+        std::cerr << "The number of slots must be set before the links are added."
+                  << std::endl;
+        abort();
+        }
+#endif
+
+    if (NumSlots <= 0 || NumSlots > (int) SlotBitset::MaxSlots)
+        {
+        std::cerr << "Invalid number of slots: " << NumSlots << ". It must be between 1 and "
+                  << SlotBitset::MaxSlots << "." << std::endl;
+        abort();
+        }
+
+    this->NumSlots = NumSlots;
 }
 
 double Topology::get_LengthLongestLink()
@@ -313,6 +581,17 @@ void Topology::set_avgSpanLength(double avgSpanLength)
         link.second->set_AvgSpanLength(avgSpanLength);
         }
     AvgSpanLength = avgSpanLength;
+    Graph.reset();
+}
+
+const RoutingGraph &Topology::get_RoutingGraph()
+{
+    if (!Graph)
+        {
+        Graph = std::make_shared<RoutingGraph>(*this, State);
+        }
+
+    return *Graph;
 }
 
 Gain Topology::get_PowerRatioThreshold()
@@ -338,3 +617,191 @@ void Topology::print()
 
     std::cout << std::endl;
 }
+
+void Topology::save_State(std::ostream &Stream)
+{
+    BinaryStream::write(Stream, (uint64_t) Nodes.size());
+    BinaryStream::write(Stream, (uint64_t) Links.size());
+
+    for (auto &node : Nodes)
+        {
+        BinaryStream::write(Stream, node->ID);
+        BinaryStream::write(Stream, node->get_NumUsedRegenerators());
+        BinaryStream::write(Stream, node->get_TotalNumRequestedRegenerators());
+        BinaryStream::write(Stream, node->get_NumMaxSimultUsedRegenerators());
+        BinaryStream::write(Stream, (uint8_t) node->is_NodeActive());
+        }
+
+    for (auto &link : Links)
+        {
+        BinaryStream::write(Stream, link.first.first);
+        BinaryStream::write(Stream, link.first.second);
+        BinaryStream::write(Stream, (uint64_t) link.second->Slots.size());
+        BinaryStream::write(Stream, (uint8_t) link.second->is_LinkActive());
+
+        for (auto &slot : link.second->Slots)
+            {
+            BinaryStream::write(Stream, (uint8_t) slot->isFree());
+
+            if (considerFilterImperfection)
+                {
+                auto &PSD = link.second->linkSpecDens;
+                BinaryStream::write(Stream, PSD->get_DensityScaling(slot->numSlot).in_dB());
+                const double *Samples = PSD->get_Samples(slot->numSlot);
+                for (unsigned long j = 0; j < Slot::samplesPerSlot; j++)
+                    {
+                    BinaryStream::write(Stream, Samples[j]);
+                    }
+                }
+            }
+        }
+}
+
+void Topology::load_State(std::istream &Stream)
+{
+    uint64_t NumNodes, NumLinks;
+    BinaryStream::read(Stream, NumNodes);
+    BinaryStream::read(Stream, NumLinks);
+
+#ifdef RUN_ASSERTIONS
+    if (NumNodes != Nodes.size() || NumLinks != Links.size())
+        {
+        std::cerr << "The saved state does not match the topology." << std::endl;
+        abort();
+        }
+#endif
+
+    for (auto &node : Nodes)
+        {
+        int ID;
+        unsigned int NumUsed, MaxSimultUsed;
+        unsigned long long TotalNumRequested;
+        uint8_t isActive;
+        BinaryStream::read(Stream, ID);
+        BinaryStream::read(Stream, NumUsed);
+        BinaryStream::read(Stream, TotalNumRequested);
+        BinaryStream::read(Stream, MaxSimultUsed);
+        BinaryStream::read(Stream, isActive);
+
+#ifdef RUN_ASSERTIONS
+        if (ID != node->ID)
+            {
+            std::cerr << "The saved state does not match the topology." << std::endl;
+            abort();
+            }
+#endif
+
+        node->set_RegeneratorUsage(NumUsed, TotalNumRequested, MaxSimultUsed);
+        isActive ? node->set_NodeActive() : node->set_NodeInactive();
+        }
+
+    for (auto &link : Links)
+        {
+        std::pair<int, int> Key;
+        uint64_t NumSlots;
+        uint8_t isActive;
+        BinaryStream::read(Stream, Key.first);
+        BinaryStream::read(Stream, Key.second);
+        BinaryStream::read(Stream, NumSlots);
+        BinaryStream::read(Stream, isActive);
+
+#ifdef RUN_ASSERTIONS
+        if (Key != link.first || NumSlots != link.second->Slots.size())
+            {
+            std::cerr << "The saved state does not match the topology." << std::endl;
+            abort();
+            }
+#endif
+
+        isActive ? link.second->set_LinkActive() : link.second->set_LinkInactive();
+
+        for (auto &slot : link.second->Slots)
+            {
+            uint8_t isFree;
+            BinaryStream::read(Stream, isFree);
+
+            if (isFree && !slot->isFree())
+                {
+                slot->freeSlot();
+                }
+            else if (!isFree && slot->isFree())
+                {
+                slot->useSlot();
+                }
+
+            if (considerFilterImperfection)
+                {
+                double densityScaling;
+                BinaryStream::read(Stream, densityScaling);
+                auto &PSD = link.second->linkSpecDens;
+                PSD->set_DensityScaling(slot->numSlot, Gain(densityScaling, Gain::dB));
+                double *Samples = PSD->get_Samples(slot->numSlot);
+                for (unsigned long j = 0; j < Slot::samplesPerSlot; j++)
+                    {
+                    BinaryStream::read(Stream, Samples[j]);
+                    }
+                }
+            }
+        }
+}
+
+void Topology::set_State(const NetworkState &State)
+{
+#ifdef RUN_ASSERTIONS
+    if (State.get_NumLinks() != Links.size() || State.get_NumNodes() != Nodes.size())
+        {
+        std::cerr << "The state does not match the topology." << std::endl;
+        abort();
+        }
+#endif
+
+    for (auto &link : Links)
+        {
+        const NetworkState::LinkState &LState = State.get_Link(link.second->Index);
+
+        //Only the links whose free slots differ are walked
+        if (!(link.second->get_FreeSlots() == LState.FreeSlots))
+            {
+            for (auto &slot : link.second->Slots)
+                {
+                bool isFree = LState.FreeSlots.test(slot->numSlot);
+
+                if (isFree && !slot->isFree())
+                    {
+                    slot->freeSlot();
+                    }
+                else if (!isFree && slot->isFree())
+                    {
+                    slot->useSlot();
+                    }
+                }
+            }
+
+        if (LState.isActive)
+            {
+            link.second->set_LinkActive();
+            }
+        else
+            {
+            link.second->set_LinkInactive();
+            }
+        }
+
+    for (auto &node : Nodes)
+        {
+        const NetworkState::NodeState &NState = State.get_Node(node->Index);
+
+        node->set_RegeneratorUsage(NState.NumUsedRegenerators,
+                                   NState.TotalNumRequestedRegenerators,
+                                   NState.MaxSimultUsedRegenerators);
+
+        if (NState.isActive)
+            {
+            node->set_NodeActive();
+            }
+        else
+            {
+            node->set_NodeInactive();
+            }
+        }
+}
@@ -0,0 +1,302 @@
+#include <Structure/TopologyGenerator.h>
+#include <Structure/Topology.h>
+#include <boost/assign.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <set>
+#include <vector>
+
+TopologyGenerator::TopologyModelsBimap TopologyGenerator::TopologyModelsNames =
+    boost::assign::list_of<TopologyGenerator::TopologyModelsBimap::relation>
+#define X(a,b,c) (a,b)
+    TOPOLOGY_MODELS
+#undef X
+    ;
+
+TopologyGenerator::TopologyModelsBimap TopologyGenerator::TopologyModelsNicknames =
+    boost::assign::list_of<TopologyGenerator::TopologyModelsBimap::relation>
+#define X(a,b,c) (a,c)
+    TOPOLOGY_MODELS
+#undef X
+    ;
+
+namespace
+{
+typedef std::pair<double, double> Position;
+
+void add_BidirectionalLink(Topology &T, unsigned int a, unsigned int b,
+                           double Length)
+{
+    T.add_Link(T.Nodes[a], T.Nodes[b], Length);
+    T.add_Link(T.Nodes[b], T.Nodes[a], Length);
+}
+
+std::vector<Position> create_Positions(unsigned int NumNodes, double AreaSide,
+                                       RandomGenerator &Stream)
+{
+    std::uniform_real_distribution<double> Coordinate(0, AreaSide);
+    std::vector<Position> Positions(NumNodes);
+
+    for (auto &position : Positions)
+        {
+        position.first = Coordinate(Stream);
+        position.second = Coordinate(Stream);
+        }
+
+    return Positions;
+}
+
+double get_Distance(const Position &a, const Position &b)
+{
+    return std::hypot(a.first - b.first, a.second - b.second);
+}
+
+/*
+ * Components is a disjoint set forest over the nodes, used to find out whether
+ * the generated topology is connected.
+ */
+class Components
+{
+public:
+    Components(unsigned int NumNodes) : Parent(NumNodes)
+    {
+        std::iota(Parent.begin(), Parent.end(), 0);
+    }
+
+    unsigned int find(unsigned int n)
+    {
+        while (Parent[n] != n)
+            {
+            n = Parent[n] = Parent[Parent[n]];
+            }
+        return n;
+    }
+
+    void join(unsigned int a, unsigned int b)
+    {
+        Parent[find(a)] = find(b);
+    }
+
+private:
+    std::vector<unsigned int> Parent;
+};
+
+/*
+ * add_Ring links the nodes First, First + Step, ..., in a ring of NumNodes
+ * nodes. Two nodes are joined by a single pair of links.
+ */
+void add_Ring(Topology &T, unsigned int First, unsigned int Step,
+              unsigned int NumNodes, double Length)
+{
+    for (unsigned int n = 0; n + 1 < NumNodes; n++)
+        {
+        add_BidirectionalLink(T, First + n * Step, First + (n + 1) * Step, Length);
+        }
+
+    if (NumNodes > 2)
+        {
+        add_BidirectionalLink(T, First + (NumNodes - 1) * Step, First, Length);
+        }
+}
+}
+
+TopologyGenerator::TopologyGenerator(TopologyModels Model, unsigned int NumNodes,
+                                     uint64_t Seed) :
+    Model(Model), NumNodes(NumNodes), Seed(Seed), AreaSide(2000),
+    MinLinkLength(10), AvgDegree(3), Alpha(0.15), NumAttachments(2),
+    LinkLength(100), RingSize(8), BackboneLinkLength(500)
+{
+
+}
+
+std::shared_ptr<Topology> TopologyGenerator::create() const
+{
+#ifdef RUN_ASSERTIONS
+    if (NumNodes == 0)
+        {
+        std::cerr << "A topology must have at least one node." << std::endl;
+        abort();
+        }
+#endif
+
+    auto T = std::make_shared<Topology>();
+    for (unsigned int n = 0; n < NumNodes; n++)
+        {
+        T->add_Node();
+        }
+
+    RandomGenerator Stream(0, 0, RandomGenerator::TopologyStream, Seed);
+
+    switch (Model)
+        {
+        case Waxman:
+            create_Waxman(*T, Stream);
+            break;
+
+        case BarabasiAlbert:
+            create_BarabasiAlbert(*T, Stream);
+            break;
+
+        case Grid:
+            create_Grid(*T);
+            break;
+
+        case RingOfRings:
+            create_RingOfRings(*T);
+            break;
+        }
+
+    return T;
+}
+
+void TopologyGenerator::create_Waxman(Topology &T, RandomGenerator &Stream) const
+{
+    std::vector<Position> Positions = create_Positions(NumNodes, AreaSide, Stream);
+    double MaxDistance = AreaSide * std::sqrt(2);
+
+    //Beta is chosen so that the expected average degree is AvgDegree.
+    double SumWeights = 0;
+    for (unsigned int a = 0; a < NumNodes; a++)
+        {
+        for (unsigned int b = a + 1; b < NumNodes; b++)
+            {
+            SumWeights += std::exp(-get_Distance(Positions[a], Positions[b]) /
+                                   (Alpha * MaxDistance));
+            }
+        }
+    double Beta = SumWeights == 0 ? 0 :
+                  std::min(1.0, AvgDegree * NumNodes / 2.0 / SumWeights);
+
+    std::uniform_real_distribution<double> Uniform(0, 1);
+    Components Comp(NumNodes);
+
+    for (unsigned int a = 0; a < NumNodes; a++)
+        {
+        for (unsigned int b = a + 1; b < NumNodes; b++)
+            {
+            double Distance = get_Distance(Positions[a], Positions[b]);
+
+            if (Uniform(Stream) < Beta * std::exp(-Distance / (Alpha * MaxDistance)))
+                {
+                add_BidirectionalLink(T, a, b, std::max(Distance, MinLinkLength));
+                Comp.join(a, b);
+                }
+            }
+        }
+
+    //Joins each node out of the component of the first node to its nearest node in it.
+    for (unsigned int a = 1; a < NumNodes; a++)
+        {
+        if (Comp.find(a) == Comp.find(0))
+            {
+            continue;
+            }
+
+        unsigned int Nearest = 0;
+        for (unsigned int b = 1; b < NumNodes; b++)
+            {
+            if (Comp.find(b) == Comp.find(0) &&
+                    get_Distance(Positions[a], Positions[b]) <
+                    get_Distance(Positions[a], Positions[Nearest]))
+                {
+                Nearest = b;
+                }
+            }
+
+        add_BidirectionalLink(T, a, Nearest,
+                              std::max(get_Distance(Positions[a], Positions[Nearest]), MinLinkLength));
+        Comp.join(a, Nearest);
+        }
+}
+
+void TopologyGenerator::create_BarabasiAlbert(Topology &T,
+        RandomGenerator &Stream) const
+{
+#ifdef RUN_ASSERTIONS
+    if (NumAttachments == 0)
+        {
+        std::cerr << "Each new node must attach to at least one node." << std::endl;
+        abort();
+        }
+#endif
+
+    std::vector<Position> Positions = create_Positions(NumNodes, AreaSide, Stream);
+    unsigned int NumInitialNodes = std::min(NumAttachments + 1, NumNodes);
+
+    //Each node appears once for each of its links, so that sampling from this
+    //vector chooses a node with probability proportional to its degree.
+    std::vector<unsigned int> Endpoints;
+
+    auto link = [&](unsigned int a, unsigned int b)
+        {
+        add_BidirectionalLink(T, a, b,
+                              std::max(get_Distance(Positions[a], Positions[b]), MinLinkLength));
+        Endpoints.push_back(a);
+        Endpoints.push_back(b);
+        };
+
+    for (unsigned int a = 0; a < NumInitialNodes; a++)
+        {
+        for (unsigned int b = 0; b < a; b++)
+            {
+            link(a, b);
+            }
+        }
+
+    for (unsigned int a = NumInitialNodes; a < NumNodes; a++)
+        {
+        std::uniform_int_distribution<size_t> Endpoint(0, Endpoints.size() - 1);
+        std::set<unsigned int> Targets;
+
+        while (Targets.size() < NumAttachments)
+            {
+            Targets.insert(Endpoints[Endpoint(Stream)]);
+            }
+
+        for (auto b : Targets)
+            {
+            link(a, b);
+            }
+        }
+}
+
+void TopologyGenerator::create_Grid(Topology &T) const
+{
+    unsigned int NumColumns = std::ceil(std::sqrt(NumNodes));
+
+    for (unsigned int n = 0; n < NumNodes; n++)
+        {
+        if ((n + 1) % NumColumns != 0 && n + 1 < NumNodes)
+            {
+            add_BidirectionalLink(T, n, n + 1, LinkLength);
+            }
+
+        if (n + NumColumns < NumNodes)
+            {
+            add_BidirectionalLink(T, n, n + NumColumns, LinkLength);
+            }
+        }
+}
+
+void TopologyGenerator::create_RingOfRings(Topology &T) const
+{
+#ifdef RUN_ASSERTIONS
+    if (RingSize == 0)
+        {
+        std::cerr << "The rings must have at least one node." << std::endl;
+        abort();
+        }
+#endif
+
+    unsigned int NumRings = (NumNodes + RingSize - 1) / RingSize;
+
+    for (unsigned int r = 0; r < NumRings; r++)
+        {
+        add_Ring(T, r * RingSize, 1, std::min(RingSize, NumNodes - r * RingSize),
+                 LinkLength);
+        }
+
+    add_Ring(T, 0, RingSize, NumRings, BackboneLinkLength);
+}
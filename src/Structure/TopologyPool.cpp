@@ -0,0 +1,74 @@
+#include <Structure/TopologyPool.h>
+#include <Structure/Topology.h>
+
+TopologyPool::TopologyPool(std::shared_ptr<const Topology> Prototype) :
+    Prototype(Prototype), Free(std::make_shared<Shelf>())
+{
+
+}
+
+std::shared_ptr<Topology> TopologyPool::acquire()
+{
+    std::unique_ptr<Topology> Copy;
+
+        {
+        std::lock_guard<std::mutex> Lock(Free->Mutex);
+        if (!Free->Copies.empty())
+            {
+            Copy = std::move(Free->Copies.back());
+            Free->Copies.pop_back();
+            }
+        else
+            {
+            Free->NumCopies++;
+            }
+        }
+
+    if (Copy)
+        {
+        reset(*Copy);
+        }
+    else
+        {
+        Copy.reset(new Topology(*Prototype));
+
+        //The state of the first copy is every slot free, and is kept to reset
+        //the copies that return
+        std::lock_guard<std::mutex> Lock(Free->Mutex);
+        if (!CleanState)
+            {
+            CleanState = Copy->get_State().fork();
+            }
+        }
+
+    std::weak_ptr<Shelf> Owner = Free;
+    return std::shared_ptr<Topology>(Copy.release(), [Owner](Topology * T)
+        {
+        auto Shelf = Owner.lock();
+        if (!Shelf)
+            {
+            delete T;
+            return;
+            }
+
+        std::lock_guard<std::mutex> Lock(Shelf->Mutex);
+        Shelf->Copies.emplace_back(T);
+        });
+}
+
+unsigned int TopologyPool::get_NumCopies() const
+{
+    std::lock_guard<std::mutex> Lock(Free->Mutex);
+    return Free->NumCopies;
+}
+
+void TopologyPool::reset(Topology &Copy) const
+{
+    for (size_t n = 0; n < Copy.Nodes.size(); n++)
+        {
+        Copy.Nodes[n]->set_NodeType(Prototype->Nodes[n]->get_NodeType());
+        Copy.Nodes[n]->Regenerators = Prototype->Nodes[n]->Regenerators;
+        }
+
+    Copy.set_State(*CleanState);
+}
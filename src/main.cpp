@@ -1,4 +1,5 @@
 #include "SimulationTypes.h"
+#include <GeneralClasses/Profiler.h>
 #include <gtest/gtest.h>
 
 namespace Simulations
@@ -29,5 +30,10 @@ int main()
     simulation->print();
     simulation->run();
 
+#ifdef RUN_PROFILER
+    Profiler::dump_JSON("SimProfile.json");
+    std::cout << std::endl << "Profiling data written to SimProfile.json." << std::endl;
+#endif
+
     return 0;
 }
@@ -51,17 +51,33 @@ TEST_F(CallGeneratorTest, CallGeneration)
     //Tests whether the generated events make sense
     for (unsigned c = 0; c < numCalls; ++c)
         {
-        EXPECT_GT(*(Calls[c]->CallEnding.lock()), *(Calls[c]->CallRequisition.lock())) << "Call " << c << " should end after it starts.";
+        EXPECT_GT(Calls[c]->EndingTime, Calls[c]->ArrivalTime) << "Call " << c << " should end after it starts.";
         EXPECT_NE(*(Calls[c]->Origin.lock()), *(Calls[c]->Destination.lock())) << "Call " << c << " must be stablished between different source and destination nodes.";
         if (c != 0)
             {
-            EXPECT_LT(*(Calls[c - 1]->CallRequisition.lock()), *(Calls[c]->CallRequisition.lock())) << "Call " << c - 1 << " should start before Call " << c << ".";
+            EXPECT_LT(Calls[c - 1]->ArrivalTime, Calls[c]->ArrivalTime) << "Call " << c - 1 << " should start before Call " << c << ".";
             }
         }
 
-    //Tests whether the events are being correctly being saved into the priority queue
-    EXPECT_EQ(CG->Events.size(), 2 * numCalls) << "There should be two events per generated call.";
-    EXPECT_EQ(*(Calls[0]->CallRequisition.lock()), *(CG->Events.top())) << "The first event should be the beginning of the first call";
+    //Tests whether the events are being correctly being saved into the calendar
+    EXPECT_EQ(CG->Events.size(), (size_t) numCalls) << "There should be one event per generated call.";
+    EXPECT_EQ(Calls[0]->ArrivalTime, CG->Events.top().t) << "The first event should be the beginning of the first call";
+    EXPECT_EQ(Calls[0], CG->get_Call(CG->Events.top().Parent)) << "The first event should belong to the first call";
+}
+
+TEST_F(CallGeneratorTest, CallPool)
+{
+    //Call endings are only scheduled on demand
+    unsigned index = CG->Events.top().Parent;
+    CG->schedule_CallEnding(index);
+    EXPECT_EQ(CG->Events.size(), numCalls + 1) << "Call ending was not scheduled.";
+
+    //Released calls have their slots reused
+    std::shared_ptr<Call> released = CG->get_Call(index);
+    CG->release_Call(index);
+    std::shared_ptr<Call> reused = CG->generate_Call();
+    EXPECT_EQ(released, reused) << "Released call slot should be reused.";
+    EXPECT_GT(reused->ArrivalTime, Calls[numCalls - 1]->ArrivalTime) << "Reused slot should hold the new call.";
 }
 
 #endif
@@ -0,0 +1,157 @@
+#ifdef RUN_TESTS
+
+#include "include/Calls/CallGenerator.h"
+#include "include/Calls/CallTrace.h"
+#include "include/Calls/Call.h"
+#include "include/Structure/Node.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+class CallTraceTest : public ::testing::Test
+{
+public:
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<Topology> T;
+    const std::string TraceFile = "CallTraceTest.trace";
+    const std::string CSVFile = "CallTraceTest.csv";
+};
+
+void CallTraceTest::SetUp()
+{
+    T = std::make_shared<Topology>();
+
+    T->add_Node(1);
+    T->add_Node(2);
+    T->add_Node(3);
+}
+
+void CallTraceTest::TearDown()
+{
+    std::remove(TraceFile.c_str());
+    std::remove(CSVFile.c_str());
+}
+
+TEST_F(CallTraceTest, RecordAndReplay)
+{
+    const unsigned numCalls = 100;
+
+    auto Recorder = std::make_shared<CallGenerator>(T, 10);
+    auto Sampler = std::make_shared<CallGenerator>(T, 10);
+    Recorder->record_Trace(TraceFile);
+
+    std::vector<Call> Calls;
+    for (unsigned c = 0; c < numCalls; ++c)
+        {
+        Calls.push_back(*Recorder->generate_Call());
+        Sampler->generate_Call();
+        }
+    Recorder->Trace->close();
+    EXPECT_EQ(Recorder->Trace->get_NumRecords(), numCalls) << "Every call should be recorded.";
+
+    auto Player = std::make_shared<CallGenerator>(T, 10);
+    Player->replay_Trace(TraceFile);
+    EXPECT_EQ(Player->Trace->get_NumRecords(), numCalls) << "Every call should be replayed.";
+
+    for (unsigned c = 0; c < numCalls; ++c)
+        {
+        auto C = Player->generate_Call();
+        ASSERT_NE(C, nullptr) << "Trace ended too early.";
+        EXPECT_EQ(C->ArrivalTime, Calls[c].ArrivalTime) << "Replayed call differs.";
+        EXPECT_EQ(C->EndingTime, Calls[c].EndingTime) << "Replayed call differs.";
+        EXPECT_EQ(C->Origin.lock(), Calls[c].Origin.lock()) << "Replayed call differs.";
+        EXPECT_EQ(C->Destination.lock(), Calls[c].Destination.lock()) << "Replayed call differs.";
+        EXPECT_EQ(C->Bitrate, Calls[c].Bitrate) << "Replayed call differs.";
+        }
+    EXPECT_EQ(Player->generate_Call(), nullptr) << "Trace should be over.";
+
+    //Recording does not change the sampled calls.
+    EXPECT_EQ(Sampler->simulationTime, Recorder->simulationTime) << "Recording should not affect sampling.";
+}
+
+TEST_F(CallTraceTest, ImportCSV)
+{
+    std::ofstream CSV(CSVFile);
+    CSV << "arrival,holding,origin,destination,bitrate" << std::endl;
+    CSV << "0.5,1.5,1,3,100e9" << std::endl;
+    CSV << "0.75,0.25,3,2,10e9" << std::endl;
+    CSV.close();
+
+    EXPECT_EQ(CallTrace::import_CSV(CSVFile, TraceFile, T), 2u) << "Every connection should be imported.";
+
+    auto Player = std::make_shared<CallGenerator>(T, 10);
+    Player->replay_Trace(TraceFile);
+
+    auto C = Player->generate_Call();
+    EXPECT_EQ(C->ArrivalTime, 0.5) << "Imported call differs.";
+    EXPECT_EQ(C->EndingTime, 2) << "Imported call differs.";
+    EXPECT_EQ(C->Origin.lock()->ID, 1) << "Imported call differs.";
+    EXPECT_EQ(C->Destination.lock()->ID, 3) << "Imported call differs.";
+    EXPECT_EQ(C->Bitrate, TransmissionBitrate(100E9)) << "Imported call differs.";
+
+    C = Player->generate_Call();
+    EXPECT_EQ(C->Origin.lock()->ID, 3) << "Imported call differs.";
+    EXPECT_EQ(C->Bitrate, TransmissionBitrate(10E9)) << "Imported call differs.";
+    EXPECT_EQ(Player->generate_Call(), nullptr) << "Trace should be over.";
+}
+
+TEST_F(CallTraceTest, InvalidCSV)
+{
+    //Unknown node, unknown bitrate, decreasing arrivals and a missing field
+    std::vector<std::string> Invalid = {"0.5,1.5,1,4,100e9", "0.5,1.5,1,3,123e9",
+                                        "0.5,1.5,1,3,100e9\n0.25,1,2,3,10e9",
+                                        "0.5,1.5,1,3"
+                                       };
+
+    for (auto &Rows : Invalid)
+        {
+        std::ofstream(CSVFile) << "arrival,holding,origin,destination,bitrate" <<
+                               std::endl << Rows << std::endl;
+        EXPECT_DEATH(CallTrace::import_CSV(CSVFile, TraceFile, T), "Invalid connection on line") <<
+                "Invalid connections should be rejected.";
+        EXPECT_FALSE(std::ifstream(TraceFile).good()) << "No trace should be left behind.";
+        }
+}
+
+TEST_F(CallTraceTest, InvalidTrace)
+{
+    auto Recorder = std::make_shared<CallGenerator>(T, 10);
+    Recorder->record_Trace(TraceFile);
+    for (unsigned c = 0; c < 10; ++c)
+        {
+        Recorder->generate_Call();
+        }
+    Recorder->Trace->close();
+
+    std::ifstream File(TraceFile, std::ifstream::binary);
+    std::string Contents((std::istreambuf_iterator<char>(File)),
+                         std::istreambuf_iterator<char>());
+    File.close();
+
+    //Truncated, with another magic, and without a whole header
+    std::vector<std::string> Invalid = {Contents.substr(0, Contents.size() - 1),
+                                        Contents, Contents.substr(0, 8)
+                                       };
+    Invalid[1][0] ^= 1;
+
+    for (auto &Bytes : Invalid)
+        {
+        std::ofstream(TraceFile, std::ofstream::binary) << Bytes;
+        EXPECT_DEATH(CallTrace(TraceFile, CallTrace::Replaying), "Invalid trace file") <<
+                "Invalid traces should be rejected.";
+        }
+
+    //A trace of a larger topology
+    std::ofstream(TraceFile, std::ofstream::binary) << Contents;
+    auto Smaller = std::make_shared<Topology>();
+    Smaller->add_Node(1);
+    auto Player = std::make_shared<CallGenerator>(Smaller, 10);
+    Player->replay_Trace(TraceFile);
+    EXPECT_DEATH(Player->generate_Call(), "does not match the topology") <<
+            "A trace of another topology should be rejected.";
+}
+
+#endif
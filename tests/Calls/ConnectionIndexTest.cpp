@@ -0,0 +1,59 @@
+#ifdef RUN_TESTS
+
+#include "include/Calls/ConnectionIndex.h"
+#include "include/RMSA/Route.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+TEST(ConnectionIndexTest, InsertErase)
+{
+    //Line 1 -> 2 -> 3 -> 4
+    auto T = std::make_shared<Topology>();
+    for (int n = 1; n <= 4; n++)
+        {
+        T->add_Node(n);
+        }
+    std::vector<std::weak_ptr<Link>> L;
+    for (int n = 0; n < 3; n++)
+        {
+        L.push_back(T->add_Link(T->Nodes[n], T->Nodes[n + 1], 100));
+        }
+
+    auto create_Route = [](std::vector<std::weak_ptr<Link>> Links)
+        {
+        std::vector<RMSA::TransparentSegment> Segments;
+        Segments.push_back(RMSA::TransparentSegment(Links,
+                           *ModulationScheme::DefaultSchemes.begin()));
+        return RMSA::Route(Segments, {});
+        };
+
+    ConnectionIndex Index(T->Links.size(), T->Nodes.size());
+    Index.insert(0, create_Route({L[0], L[1]}));
+    Index.insert(7, create_Route({L[1], L[2]}));
+    Index.insert(3, create_Route({L[0]}));
+    EXPECT_EQ(Index.get_NumConnections(), 3u) << "Three connections were inserted.";
+
+    auto OnLink = Index.get_LinkConnections(L[1].lock()->Index);
+    std::sort(OnLink.begin(), OnLink.end());
+    EXPECT_EQ(OnLink, std::vector<unsigned>({0, 7})) << "Wrong connections on the second link.";
+    EXPECT_EQ(Index.get_NodeConnections(0).size(), 2u) << "Two connections start on node 1.";
+    EXPECT_EQ(Index.get_NodeConnections(3), std::vector<unsigned>({7})) <<
+            "One connection ends on node 4.";
+
+    Index.erase(0);
+    EXPECT_FALSE(Index.contains(0)) << "The connection should be erased.";
+    EXPECT_EQ(Index.get_LinkConnections(L[0].lock()->Index), std::vector<unsigned>({3})) <<
+            "The erased connection should leave every list.";
+    EXPECT_EQ(Index.get_LinkConnections(L[1].lock()->Index), std::vector<unsigned>({7})) <<
+            "The erased connection should leave every list.";
+
+    Index.erase(0);
+    EXPECT_EQ(Index.get_NumConnections(), 2u) << "Erasing twice should do nothing.";
+
+    Index.insert(0, create_Route({L[2]}));
+    EXPECT_EQ(Index.get_LinkConnections(L[2].lock()->Index).size(), 2u) <<
+            "A call index can be reused.";
+}
+
+#endif
@@ -0,0 +1,46 @@
+#ifdef RUN_TESTS
+
+#include "include/Calls/EventCalendar.h"
+#include <gtest/gtest.h>
+#include <random>
+
+TEST(EventCalendarTest, Ordering)
+{
+    EventCalendar Events;
+    EXPECT_TRUE(Events.empty()) << "Calendar should start empty.";
+
+    std::default_random_engine engine(0);
+    std::uniform_real_distribution<double> distribution(0, 1000);
+
+    const unsigned numEvents = 1000;
+    for (unsigned e = 0; e < numEvents; ++e)
+        {
+        Events.push(Event(distribution(engine), Event::CallRequisition, e));
+        }
+    EXPECT_EQ(Events.size(), numEvents) << "Calendar size is wrong.";
+
+    double lastTime = 0;
+    while (!Events.empty())
+        {
+        EXPECT_LE(lastTime, Events.top().t) << "Events should be popped in increasing order of their times.";
+        lastTime = Events.top().t;
+        Events.pop();
+        }
+}
+
+TEST(EventCalendarTest, Payload)
+{
+    EventCalendar Events;
+    Events.push(Event(0.3, Event::CallEnding, 3));
+    Events.push(Event(0.1, Event::CallRequisition, 1));
+    Events.push(Event(0.2, Event::CallRequisition, 2));
+
+    EXPECT_EQ(Events.top().Parent, 1u) << "Event payload was not kept.";
+    Events.pop();
+    EXPECT_EQ(Events.top().Parent, 2u) << "Event payload was not kept.";
+    Events.pop();
+    EXPECT_EQ(Events.top().Parent, 3u) << "Event payload was not kept.";
+    EXPECT_EQ(Events.top().Type, Event::CallEnding) << "Event payload was not kept.";
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifdef RUN_TESTS
+
+#include <gtest/gtest.h>
+#include "GeneralClasses/BatchMeans.h"
+#include <cmath>
+#include <limits>
+
+TEST(BatchMeansTest, Batching)
+{
+    BatchMeans BM(10, 4);
+    EXPECT_EQ(BM.get_NumBatches(), 0u) << "There should be no batches at start.";
+
+    for (unsigned i = 0; i < 9; ++i)
+        {
+        EXPECT_FALSE(BM.add(i % 2)) << "Batch should not be complete.";
+        }
+    EXPECT_TRUE(BM.add(1)) << "Batch should be complete.";
+    EXPECT_EQ(BM.get_NumBatches(), 1u) << "There should be one batch.";
+
+    for (unsigned i = 0; i < 30; ++i)
+        {
+        BM.add(i % 2);
+        }
+    EXPECT_EQ(BM.get_NumBatches(), 2u) << "Batches should have been merged.";
+    EXPECT_EQ(BM.get_BatchSize(), 20u) << "Batch size should have doubled.";
+    EXPECT_EQ(BM.get_NumObservations(), 40u) << "Every observation should be counted.";
+
+    BM.reset();
+    EXPECT_EQ(BM.get_NumObservations(), 0u) << "Reset not working as it should.";
+    EXPECT_EQ(BM.get_BatchSize(), 10u) << "Reset not working as it should.";
+}
+
+TEST(BatchMeansTest, ConfidenceInterval)
+{
+    BatchMeans BM(100, 64);
+    EXPECT_EQ(BM.get_HalfWidth(0.95), std::numeric_limits<double>::infinity())
+            << "Half-width should be infinite without batches.";
+
+    //Constant sequence: null half-width
+    for (unsigned i = 0; i < 1000; ++i)
+        {
+        BM.add(0.5);
+        }
+    EXPECT_DOUBLE_EQ(BM.get_Mean(), 0.5) << "Mean is wrong.";
+    EXPECT_DOUBLE_EQ(BM.get_HalfWidth(0.95), 0) << "Half-width should be null.";
+
+    //Alternating batches: means 0 and 1
+    BatchMeans BM2(10, 64);
+    for (unsigned b = 0; b < 10; ++b)
+        {
+        for (unsigned i = 0; i < 10; ++i)
+            {
+            BM2.add(b % 2);
+            }
+        }
+    //Sample std. dev. of batch means is sqrt(10 / 36), t(9, 0.975) = 2.262157
+    EXPECT_NEAR(BM2.get_HalfWidth(0.95), 2.262157 * std::sqrt(10.0 / 36.0) / std::sqrt(10.0), 1E-5)
+            << "Half-width is wrong.";
+    EXPECT_LT(BM2.get_HalfWidth(0.90), BM2.get_HalfWidth(0.95)) << "Higher confidence should widen the interval.";
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifdef RUN_TESTS
+
+#include <gtest/gtest.h>
+#include "GeneralClasses/Profiler.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+TEST(ProfilerTest, Buckets)
+{
+    EXPECT_EQ(Profiler::get_Bucket(0), 0u) << "Null durations go to the first bucket.";
+    EXPECT_EQ(Profiler::get_Bucket(1), 1u) << "Bucket i counts durations below 2^i ns.";
+    EXPECT_EQ(Profiler::get_Bucket(1023), 10u) << "Bucket i counts durations below 2^i ns.";
+    EXPECT_EQ(Profiler::get_Bucket(1024), 11u) << "Bucket i counts durations below 2^i ns.";
+    EXPECT_EQ(Profiler::get_Bucket(UINT64_MAX), Profiler::NumBuckets - 1) <<
+            "The last bucket counts every longer duration.";
+}
+
+TEST(ProfilerTest, Statistics)
+{
+    Profiler::reset();
+
+    Profiler::record(Profiler::Routing, 100);
+    Profiler::record(Profiler::Routing, 300);
+    std::thread([]()
+        {
+        Profiler::record(Profiler::Routing, 2000);
+        }).join();
+
+    auto Statistics = Profiler::get_Statistics(Profiler::Routing);
+    EXPECT_EQ(Statistics.Count, 3u) << "Statistics should be merged over threads.";
+    EXPECT_EQ(Statistics.TotalTime, 2400u) << "Statistics should be merged over threads.";
+    EXPECT_EQ(Statistics.MinTime, 100u) << "Minimum duration not working as it should.";
+    EXPECT_EQ(Statistics.MaxTime, 2000u) << "Maximum duration not working as it should.";
+    EXPECT_EQ(Statistics.Histogram[Profiler::get_Bucket(300)], 1u) <<
+            "Histogram not working as it should.";
+    EXPECT_EQ(Profiler::get_Statistics(Profiler::SlotFree).Count, 0u) <<
+            "Phases should be independent.";
+
+        {
+        Profiler::ScopedTimer Timer(Profiler::SlotFree);
+        }
+    EXPECT_EQ(Profiler::get_Statistics(Profiler::SlotFree).Count, 1u) <<
+            "Scoped timers should record an occurrence.";
+
+    Profiler::reset();
+    EXPECT_EQ(Profiler::get_Statistics(Profiler::Routing).Count, 0u) <<
+            "Reset not working as it should.";
+}
+
+TEST(ProfilerTest, JSON)
+{
+    Profiler::reset();
+    Profiler::record(Profiler::SpectrumAssignment, 500);
+
+    std::string FileName = "ProfilerTest.json";
+    Profiler::dump_JSON(FileName);
+
+    std::ifstream File(FileName);
+    std::stringstream Contents;
+    Contents << File.rdbuf();
+    std::remove(FileName.c_str());
+
+    EXPECT_NE(Contents.str().find("\"phase\": \"spectrumassignment\""), std::string::npos)
+            << "Every phase should be dumped.";
+    EXPECT_NE(Contents.str().find("{\"below_ns\": 512, \"count\": 1}"), std::string::npos)
+            << "Histogram should be dumped.";
+
+    Profiler::reset();
+}
+
+#endif // RUN_TESTS
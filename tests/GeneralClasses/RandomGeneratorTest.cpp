@@ -0,0 +1,64 @@
+#ifdef RUN_TESTS
+
+#include <gtest/gtest.h>
+#include "GeneralClasses/RandomGenerator.h"
+#include <vector>
+
+TEST(RandomGeneratorTest, KnownAnswers)
+{
+    //Known answer tests of the Philox4x32-10 reference implementation.
+    uint32_t Counter1[4] = {0, 0, 0, 0};
+    uint32_t Key1[2] = {0, 0};
+    RandomGenerator::philox(Counter1, Key1);
+    EXPECT_EQ(Counter1[0], 0x6627e8d5U) << "Philox bijection is wrong.";
+    EXPECT_EQ(Counter1[1], 0xe169c58dU) << "Philox bijection is wrong.";
+    EXPECT_EQ(Counter1[2], 0xbc57ac4cU) << "Philox bijection is wrong.";
+    EXPECT_EQ(Counter1[3], 0x9b00dbd8U) << "Philox bijection is wrong.";
+
+    uint32_t Counter2[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+    uint32_t Key2[2] = {0xa4093822, 0x299f31d0};
+    RandomGenerator::philox(Counter2, Key2);
+    EXPECT_EQ(Counter2[0], 0xd16cfe09U) << "Philox bijection is wrong.";
+    EXPECT_EQ(Counter2[1], 0x94fdccebU) << "Philox bijection is wrong.";
+    EXPECT_EQ(Counter2[2], 0x5001e420U) << "Philox bijection is wrong.";
+    EXPECT_EQ(Counter2[3], 0x24126ea1U) << "Philox bijection is wrong.";
+}
+
+TEST(RandomGeneratorTest, Reproducibility)
+{
+    RandomGenerator G1(3, 7), G2(3, 7), G3(3, 8), G4(3, 7, RandomGenerator::OptimizerStream);
+
+    bool differentReplication = false, differentSubstream = false;
+    for (unsigned i = 0; i < 100; ++i)
+        {
+        auto x1 = G1(), x2 = G2(), x3 = G3(), x4 = G4();
+        EXPECT_EQ(x1, x2) << "Streams with the same identifiers should be equal.";
+        differentReplication |= (x1 != x3);
+        differentSubstream |= (x1 != x4);
+        }
+
+    EXPECT_TRUE(differentReplication) << "Replications should have different streams.";
+    EXPECT_TRUE(differentSubstream) << "Substreams should be different.";
+}
+
+TEST(RandomGeneratorTest, JumpAhead)
+{
+    RandomGenerator G1(1, 2), G2(1, 2);
+
+    std::vector<uint32_t> Sequence;
+    for (unsigned i = 0; i < 1000; ++i)
+        {
+        Sequence.push_back(G1());
+        }
+    EXPECT_EQ(G1.get_Position(), 1000u) << "Position is wrong.";
+
+    G2.discard(123);
+    EXPECT_EQ(G2.get_Position(), 123u) << "Position is wrong.";
+    EXPECT_EQ(G2(), Sequence[123]) << "Jumping ahead is not working.";
+
+    G2.set_Position(998);
+    EXPECT_EQ(G2(), Sequence[998]) << "Setting the position is not working.";
+    EXPECT_EQ(G2(), Sequence[999]) << "Setting the position is not working.";
+}
+
+#endif
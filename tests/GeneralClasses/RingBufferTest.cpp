@@ -0,0 +1,60 @@
+#ifdef RUN_TESTS
+
+#include <gtest/gtest.h>
+#include "GeneralClasses/RingBuffer.h"
+#include <thread>
+
+TEST(RingBufferTest, Capacity)
+{
+    RingBuffer<int> Buffer(5);
+    EXPECT_EQ(Buffer.capacity(), 8u) << "Capacity should be rounded up to a power of two.";
+
+    int Element;
+    EXPECT_FALSE(Buffer.pop(Element)) << "An empty buffer should have nothing to pop.";
+
+    for (int i = 0; i < 8; i++)
+        {
+        EXPECT_TRUE(Buffer.push(i)) << "A buffer should accept up to its capacity.";
+        }
+    EXPECT_FALSE(Buffer.push(8)) << "A full buffer should refuse new elements.";
+
+    EXPECT_TRUE(Buffer.pop(Element));
+    EXPECT_EQ(Element, 0) << "Elements should be popped in order.";
+    EXPECT_TRUE(Buffer.push(8)) << "Popping should free space.";
+}
+
+TEST(RingBufferTest, SingleProducerSingleConsumer)
+{
+    constexpr unsigned NumElements = 10000;
+    RingBuffer<unsigned> Buffer(64);
+
+    std::thread Producer([&Buffer]()
+        {
+        for (unsigned i = 0; i < NumElements; i++)
+            {
+            while (!Buffer.push(i))
+                {
+                std::this_thread::yield();
+                }
+            }
+        });
+
+    unsigned Expected = 0;
+    while (Expected < NumElements)
+        {
+        unsigned Element;
+        if (Buffer.pop(Element))
+            {
+            ASSERT_EQ(Element, Expected) << "Elements should be received in order.";
+            Expected++;
+            }
+        else
+            {
+            std::this_thread::yield();
+            }
+        }
+
+    Producer.join();
+}
+
+#endif // RUN_TESTS
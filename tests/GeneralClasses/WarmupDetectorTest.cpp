@@ -0,0 +1,40 @@
+#ifdef RUN_TESTS
+
+#include <gtest/gtest.h>
+#include "GeneralClasses/WarmupDetector.h"
+#include <cmath>
+#include <random>
+
+TEST(WarmupDetectorTest, StationarySequence)
+{
+    WarmupDetector WD;
+
+    bool detected = false;
+    for (unsigned i = 0; i < 1000 && !detected; ++i)
+        {
+        detected = WD.add(1);
+        }
+
+    EXPECT_TRUE(detected) << "A constant sequence should be detected as stationary.";
+    EXPECT_EQ(WD.get_TruncationPoint(), 0u) << "A constant sequence has no transient.";
+}
+
+TEST(WarmupDetectorTest, Transient)
+{
+    WarmupDetector WD;
+    std::default_random_engine engine(0);
+    std::uniform_real_distribution<double> noise(-0.1, 0.1);
+
+    //Exponential approach to the steady state, as the network occupancy.
+    for (unsigned i = 0; i < 100000 && !WD.hasDetected(); ++i)
+        {
+        WD.add(1 - std::exp(-1.0 * i / 200) + noise(engine));
+        }
+
+    EXPECT_TRUE(WD.hasDetected()) << "The steady state should have been detected.";
+    EXPECT_GE(WD.get_TruncationPoint(), 400u) << "The transient was truncated too early.";
+    EXPECT_LE(WD.get_TruncationPoint(), 1000u) << "The transient was truncated too late.";
+    EXPECT_FALSE(WD.add(0)) << "No observation is accepted after the detection.";
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifdef RUN_TESTS
+
+#include "include/RMSA/RoutingAlgorithms.h"
+#include "include/Calls/Call.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+
+using namespace RMSA::ROUT;
+
+namespace
+{
+/**
+ * Appends to \a Costs the lengths of every loopless path from \a Node to \a
+ * Destination that does not visit the nodes in \a Visited.
+ */
+void find_PathLengths(const RoutingGraph &G, unsigned int Node,
+                      unsigned int Destination, double Length,
+                      std::vector<bool> &Visited, std::vector<double> &Costs)
+{
+    if (Node == Destination)
+        {
+        Costs.push_back(Length);
+        return;
+        }
+
+    Visited[Node] = true;
+    for (unsigned int e = G.FirstEdge[Node]; e < G.FirstEdge[Node + 1]; e++)
+        {
+        if (!Visited[G.EdgeTarget[e]])
+            {
+            find_PathLengths(G, G.EdgeTarget[e], Destination,
+                             Length + G.LinkLength[G.EdgeLink[e]], Visited, Costs);
+            }
+        }
+    Visited[Node] = false;
+}
+
+double get_Length(const std::vector<std::weak_ptr<Link>> &Route)
+{
+    double Length = 0;
+    for (auto &link : Route)
+        {
+        Length += link.lock()->Length;
+        }
+    return Length;
+}
+}
+
+TEST(Yen_RoutingAlgorithmTest, ShortestPaths)
+{
+    Yen_RoutingAlgorithm::useRouteTable = false;
+
+    auto T = TopologyGenerator(TopologyGenerator::Waxman, 8).create();
+    const RoutingGraph &G = T->get_RoutingGraph();
+    auto Yen = std::make_shared<Yen_RoutingAlgorithm>(T, RoutingCost::SP, false, 6);
+
+    for (auto &orig : T->Nodes)
+        {
+        for (auto &dest : T->Nodes)
+            {
+            if (orig == dest)
+                {
+                continue;
+                }
+
+            std::vector<bool> Visited(G.NumNodes, false);
+            std::vector<double> Lengths;
+            find_PathLengths(G, orig->Index, dest->Index, 0, Visited, Lengths);
+            std::sort(Lengths.begin(), Lengths.end());
+
+            auto C = std::make_shared<Call>(orig, dest,
+                                            *TransmissionBitrate::DefaultBitrates.begin(),
+                                            *ModulationScheme::DefaultSchemes.begin());
+            auto Routes = Yen->route(C);
+            ASSERT_EQ(Routes.size(), std::min<size_t>(Lengths.size(), 6)) <<
+                    "Yen's algorithm should find k routes, or every route.";
+
+            for (unsigned int r = 0; r < Routes.size(); r++)
+                {
+                EXPECT_NEAR(get_Length(Routes[r]), Lengths[r], 1E-6) <<
+                        "The routes should be the k shortest loopless routes.";
+                }
+            }
+        }
+
+    EXPECT_EQ(Yen->k, 6u) << "Routing should keep the k of the constructor.";
+}
+
+TEST(Yen_RoutingAlgorithmTest, Reentrancy)
+{
+    Yen_RoutingAlgorithm::useRouteTable = false;
+
+    auto T = TopologyGenerator(TopologyGenerator::Grid, 64).create();
+    T->get_RoutingGraph();
+    auto Yen3 = std::make_shared<Yen_RoutingAlgorithm>(T, RoutingCost::SP, false, 3);
+    auto Yen5 = std::make_shared<Yen_RoutingAlgorithm>(T, RoutingCost::SP, false, 5);
+
+    std::vector<std::shared_ptr<Call>> Calls;
+    for (unsigned int n = 1; n < T->Nodes.size(); n += 7)
+        {
+        Calls.push_back(std::make_shared<Call>(T->Nodes[0], T->Nodes[n],
+                                               *TransmissionBitrate::DefaultBitrates.begin(),
+                                               *ModulationScheme::DefaultSchemes.begin()));
+        }
+
+    //Each thread routes every call, with both algorithms
+    const unsigned int NumThreads = 4;
+    std::vector<std::vector<std::vector<std::vector<std::weak_ptr<Link>>>>>
+    Results(NumThreads);
+    std::vector<std::thread> Threads;
+    for (unsigned int t = 0; t < NumThreads; t++)
+        {
+        Threads.emplace_back([&, t]()
+            {
+            for (auto &call : Calls)
+                {
+                Results[t].push_back((t % 2 ? Yen5 : Yen3)->route(call));
+                }
+            });
+        }
+    for (auto &thread : Threads)
+        {
+        thread.join();
+        }
+
+    for (unsigned int t = 0; t < NumThreads; t++)
+        {
+        auto Yen = (t % 2 ? Yen5 : Yen3);
+        for (unsigned int c = 0; c < Calls.size(); c++)
+            {
+            auto Routes = Yen->route(Calls[c]);
+            ASSERT_EQ(Results[t][c].size(), Yen->k) << "Each algorithm should have its k.";
+            for (unsigned int r = 0; r < Routes.size(); r++)
+                {
+                ASSERT_EQ(Results[t][c][r].size(), Routes[r].size()) <<
+                        "Concurrent searches should not interfere.";
+                for (unsigned int l = 0; l < Routes[r].size(); l++)
+                    {
+                    EXPECT_EQ(Results[t][c][r][l].lock(), Routes[r][l].lock()) <<
+                            "Concurrent searches should not interfere.";
+                    }
+                }
+            }
+        }
+
+    for (auto &link : T->Links)
+        {
+        EXPECT_TRUE(link.second->is_LinkActive()) << "The search should not change the topology.";
+        }
+    for (auto &node : T->Nodes)
+        {
+        EXPECT_TRUE(node->is_NodeActive()) << "The search should not change the topology.";
+        }
+}
+
+#endif
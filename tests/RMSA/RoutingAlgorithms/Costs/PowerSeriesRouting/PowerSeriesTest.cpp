@@ -0,0 +1,185 @@
+#ifdef RUN_TESTS
+
+#include "include/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeries.h"
+#include "include/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/PowerSeriesRouting.h"
+#include "include/RMSA/RoutingAlgorithms/Costs/PowerSeriesRouting/Costs.h"
+#include "include/Calls/Call.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+using namespace RMSA::ROUT;
+
+TEST(PowerSeriesTest, Evaluate)
+{
+    const int NMin = 1, NMax = 3, N = NMax - NMin + 1;
+    std::mt19937 Stream(0);
+    std::uniform_real_distribution<double> Distribution(-1, 1);
+
+    std::vector<double> Coefficients(N * N * N);
+    for (auto &coef : Coefficients)
+        {
+        coef = Distribution(Stream);
+        }
+    PSR::PowerSeries Series(Coefficients.data(), 3, NMin, NMax);
+
+    for (unsigned int it = 0; it < 20; it++)
+        {
+        double X[3] = {Distribution(Stream), Distribution(Stream), Distribution(Stream)};
+
+        double Expected = 0;
+        for (int i = 0; i < N; i++)
+            {
+            for (int j = 0; j < N; j++)
+                {
+                for (int k = 0; k < N; k++)
+                    {
+                    Expected += Coefficients[(i * N + j) * N + k] * std::pow(X[0], NMin + i) *
+                                std::pow(X[1], NMin + j) * std::pow(X[2], NMin + k);
+                    }
+                }
+            }
+
+        EXPECT_NEAR(Series.evaluate(X), Expected, 1E-12) <<
+                "The series should be the sum of its terms.";
+        }
+}
+
+TEST(PowerSeriesTest, Variants)
+{
+    const int NMin = 0, NMax = 2;
+    auto T = TopologyGenerator(TopologyGenerator::Waxman, 8).create();
+    std::mt19937 Stream(0);
+    std::uniform_real_distribution<double> Distribution(0, 1);
+
+    for (auto &link : T->Links)
+        {
+        for (auto &slot : link.second->Slots)
+            {
+            if (Distribution(Stream) < 0.4)
+                {
+                slot->useSlot();
+                }
+            }
+        }
+
+    std::vector<std::shared_ptr<PSR::Cost>> Costs;
+    for (auto cost : {PSR::Cost::availability, PSR::Cost::contiguity, PSR::Cost::linklength})
+        {
+        Costs.push_back(PSR::Cost::createCost(cost, NMin, NMax, T));
+        }
+    const unsigned int N = NMax - NMin + 1, NumTerms = N * N * N;
+    const unsigned int NumPairs = T->Nodes.size() * (T->Nodes.size() - 1);
+
+    for (auto Variant : {PSR::PowerSeriesRouting::Variant_AWR,
+                         PSR::PowerSeriesRouting::Variant_LocalPSR,
+                         PSR::PowerSeriesRouting::Variant_MatricialPSR,
+                         PSR::PowerSeriesRouting::Variant_TensorialPSR})
+        {
+        auto RCost = PSR::PowerSeriesRouting::createPSR(T, Costs, Variant);
+
+        unsigned int NumCoefficients =
+            (Variant == PSR::PowerSeriesRouting::Variant_AWR) ? Costs.size() - 1 :
+            (Variant == PSR::PowerSeriesRouting::Variant_LocalPSR) ? NumTerms * NumPairs :
+            (Variant == PSR::PowerSeriesRouting::Variant_MatricialPSR) ? NumTerms :
+            Costs.size() * N;
+        std::vector<double> Coefficients(NumCoefficients);
+        for (auto &coef : Coefficients)
+            {
+            coef = Distribution(Stream);
+            }
+        RCost->initCoefficients(Coefficients);
+
+        for (auto &link : T->Links)
+            {
+            auto C = std::make_shared<Call>(link.second->Origin, link.second->Destination,
+                                            TransmissionBitrate::DefaultBitrates.front(),
+                                            *ModulationScheme::DefaultSchemes.begin());
+
+            //The costs as defined by the Kronecker products of the variants
+            arma::mat Powers = arma::ones(1);
+            for (auto &cost : Costs)
+                {
+                Powers = arma::kron(Powers, cost->getCost(link.second, C));
+                }
+
+            double Expected = 0;
+            switch (Variant)
+                {
+                case PSR::PowerSeriesRouting::Variant_AWR:
+                        {
+                        double Sines = 1;
+                        for (size_t n = 0; n < Costs.size(); n++)
+                            {
+                            double Cosine = (n < NumCoefficients) ? std::cos(Coefficients[n]) : 1;
+                            Expected += Costs[n]->getUnitCost(link.second, C) * Cosine * Sines;
+                            Sines *= (n < NumCoefficients) ? std::sin(Coefficients[n]) : 1;
+                            }
+                        }
+                    break;
+
+                case PSR::PowerSeriesRouting::Variant_LocalPSR:
+                        {
+                        //The pairs are sorted by the IDs of their nodes
+                        unsigned int Origin = link.second->Origin.lock()->ID;
+                        unsigned int Destination = link.second->Destination.lock()->ID;
+                        unsigned int Pos = (Origin - 1) * (T->Nodes.size() - 1) + Destination - 1 -
+                                           (Destination > Origin);
+                        for (unsigned int t = 0; t < NumTerms; t++)
+                            {
+                            Expected += Coefficients[Pos + t] * Powers(t);
+                            }
+                        }
+                    break;
+
+                case PSR::PowerSeriesRouting::Variant_MatricialPSR:
+                    for (unsigned int t = 0; t < NumTerms; t++)
+                        {
+                        Expected += Coefficients[t] * Powers(t);
+                        }
+                    break;
+
+                case PSR::PowerSeriesRouting::Variant_TensorialPSR:
+                    for (unsigned int t = 0; t < NumTerms; t++)
+                        {
+                        Expected += Coefficients[t / (N * N)] * Coefficients[N + t / N % N] *
+                                    Coefficients[2 * N + t % N] * Powers(t);
+                        }
+                    break;
+                }
+
+            EXPECT_NEAR(RCost->get_Cost(link.second, C), Expected, 1E-12) <<
+                    "The compiled cost of the " <<
+                    PSR::PowerSeriesRouting::VariantNames.left.at(Variant) <<
+                    " should be its power series.";
+            }
+        }
+}
+
+TEST(PowerSeriesTest, WrongNumberOfCoefficients)
+{
+    auto T = TopologyGenerator(TopologyGenerator::Waxman, 8).create();
+    std::vector<std::shared_ptr<PSR::Cost>> Costs;
+    for (auto cost : {PSR::Cost::availability, PSR::Cost::linklength})
+        {
+        Costs.push_back(PSR::Cost::createCost(cost, 0, 2, T));
+        }
+
+    auto link = T->Links.begin()->second;
+    auto C = std::make_shared<Call>(link->Origin, link->Destination,
+                                    TransmissionBitrate::DefaultBitrates.front(),
+                                    *ModulationScheme::DefaultSchemes.begin());
+
+    for (auto Variant : {PSR::PowerSeriesRouting::Variant_MatricialPSR,
+                         PSR::PowerSeriesRouting::Variant_TensorialPSR})
+        {
+        auto RCost = PSR::PowerSeriesRouting::createPSR(T, Costs, Variant);
+        RCost->initCoefficients(std::vector<double>(4, 1));
+        EXPECT_DEATH(RCost->get_Cost(link, C), "does not match the costs") <<
+                "The " << PSR::PowerSeriesRouting::VariantNames.left.at(Variant) <<
+                " should reject a wrong number of coefficients.";
+        }
+}
+
+#endif
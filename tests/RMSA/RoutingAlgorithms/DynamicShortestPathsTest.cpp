@@ -0,0 +1,88 @@
+#ifdef RUN_TESTS
+
+#include "include/RMSA/RoutingAlgorithms/DynamicShortestPaths.h"
+#include "include/RMSA/RoutingAlgorithms/ShortestPathSearch.h"
+#include "include/Calls/Call.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace RMSA::ROUT;
+
+TEST(DynamicShortestPathsTest, Repair)
+{
+    for (auto Cost : {RoutingCost::LORa, RoutingCost::LORc})
+        {
+        auto T = TopologyGenerator(TopologyGenerator::Waxman, 30).create();
+        const RoutingGraph &G = T->get_RoutingGraph();
+        auto RCost = RoutingCost::create_RoutingCost(Cost, T, false);
+        DynamicShortestPaths Trees(T, RCost);
+
+        std::mt19937 Stream(0);
+        std::uniform_int_distribution<unsigned int> Node(0, G.NumNodes - 1);
+        std::uniform_int_distribution<unsigned int> Link(0, G.NumLinks - 1);
+        std::uniform_int_distribution<unsigned int> Slot(0, T->get_NumSlots() - 1);
+        std::vector<unsigned int> Path, ExpectedPath;
+
+        for (unsigned int it = 0; it < 2000; it++)
+            {
+            //The occupation of a few links changes, and now and then a link or a
+            //node fails or is repaired
+            for (unsigned int change = 0; change < 3; change++)
+                {
+                unsigned int l = Link(Stream);
+                auto &slot = G.Links[l]->Slots[Slot(Stream)];
+                slot->isFree() ? slot->useSlot() : slot->freeSlot();
+                Trees.notify_LinkChanged(l);
+                }
+            if (it % 50 == 0)
+                {
+                unsigned int l = Link(Stream);
+                G.is_LinkActive(l) ? G.Links[l]->set_LinkInactive() :
+                G.Links[l]->set_LinkActive();
+                Trees.notify_LinkChanged(l);
+                }
+            if (it % 70 == 0)
+                {
+                unsigned int n = Node(Stream);
+                G.is_NodeActive(n) ? G.Nodes[n]->set_NodeInactive() :
+                G.Nodes[n]->set_NodeActive();
+                for (unsigned int e = G.FirstInEdge[n]; e < G.FirstInEdge[n + 1]; e++)
+                    {
+                    Trees.notify_LinkChanged(G.InEdgeLink[e]);
+                    }
+                }
+
+            auto C = std::make_shared<Call>(G.Nodes[Node(Stream) % 6], G.Nodes[Node(Stream)],
+                                            TransmissionBitrate::DefaultBitrates[it % 2],
+                                            *ModulationScheme::DefaultSchemes.begin());
+            auto LinkCost = [&](unsigned int l)
+                {
+                return RCost->get_Cost(G, l, C);
+                };
+
+            bool hasPath = Trees.find_Path(C, Path);
+            ASSERT_EQ(hasPath, ShortestPathSearch::get_ThreadSearch().find_Path(G, LinkCost,
+                      C->Origin.lock()->Index, C->Destination.lock()->Index, ExpectedPath)) <<
+                              "A path should be found iff there is one.";
+
+            double PathCost = 0, ExpectedCost = 0;
+            for (auto l : Path)
+                {
+                PathCost += LinkCost(l);
+                }
+            for (auto l : ExpectedPath)
+                {
+                ExpectedCost += LinkCost(l);
+                }
+            ASSERT_NEAR(PathCost, ExpectedCost, 1E-9) <<
+                    "The repaired tree should have a shortest path.";
+            }
+
+        EXPECT_LE(Trees.get_NumTrees(), Cost == RoutingCost::LORa ? 6 : 12) <<
+                "The calls of a class should share the trees.";
+        EXPECT_GT(Trees.get_NumRepairedNodes(), 0) << "The trees should have been repaired.";
+        }
+}
+
+#endif
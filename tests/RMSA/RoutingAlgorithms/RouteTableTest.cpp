@@ -0,0 +1,172 @@
+#ifdef RUN_TESTS
+
+#include "include/RMSA/RoutingAlgorithms.h"
+#include "include/Calls/Call.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <unistd.h>
+
+using namespace RMSA::ROUT;
+
+namespace
+{
+std::vector<std::vector<unsigned int>> get_Indices(
+    const std::vector<std::vector<std::weak_ptr<Link>>> &Routes)
+{
+    std::vector<std::vector<unsigned int>> Indices;
+
+    for (auto &route : Routes)
+        {
+        Indices.push_back({});
+        for (auto &link : route)
+            {
+            Indices.back().push_back(link.lock()->Index);
+            }
+        }
+
+    return Indices;
+}
+}
+
+TEST(RouteTableTest, LookupAndPersistence)
+{
+    Yen_RoutingAlgorithm::useRouteTable = true;
+
+    auto T = TopologyGenerator(TopologyGenerator::Waxman, 20).create();
+    auto Yen = std::make_shared<Yen_RoutingAlgorithm>(T, RoutingCost::SP, false, 3);
+
+    for (auto &orig : T->Nodes)
+        {
+        for (auto &dest : T->Nodes)
+            {
+            if (orig == dest)
+                {
+                continue;
+                }
+
+            auto C = std::make_shared<Call>(orig, dest,
+                                            *TransmissionBitrate::DefaultBitrates.begin(),
+                                            *ModulationScheme::DefaultSchemes.begin());
+            ASSERT_EQ(get_Indices(Yen->route(C)), get_Indices(Yen->search(C))) <<
+                    "The table should have the routes found by Yen's algorithm.";
+            }
+        }
+
+    //A route through a failed link is searched again
+    auto C = std::make_shared<Call>(T->Nodes[0], T->Nodes[19],
+                                    *TransmissionBitrate::DefaultBitrates.begin(),
+                                    *ModulationScheme::DefaultSchemes.begin());
+    auto FailedLink = Yen->route(C).front().front().lock();
+    FailedLink->set_LinkInactive();
+    auto Routes = get_Indices(Yen->route(C));
+    EXPECT_EQ(Routes, get_Indices(Yen->search(C))) << "The routes should be searched again.";
+    for (auto &route : Routes)
+        {
+        for (auto l : route)
+            {
+            EXPECT_NE(l, FailedLink->Index) << "The failed link should be avoided.";
+            }
+        }
+    FailedLink->set_LinkActive();
+
+    auto Table = RouteTable::get_RouteTable(T, RoutingCost::SP, 3);
+    EXPECT_EQ(Table, RouteTable::get_RouteTable(std::make_shared<Topology>(*T),
+              RoutingCost::SP, 3)) << "Copies of a topology should share the table.";
+
+    const std::string FileName = "RouteTableTest.routes";
+    Table->save(FileName);
+    auto Loaded = RouteTable::load(FileName, T, RoutingCost::SP, 3);
+    ASSERT_NE(Loaded, nullptr) << "The table should be read back.";
+    EXPECT_EQ(RouteTable::load(FileName, T, RoutingCost::MH, 3), nullptr) <<
+            "A table should not be read for another cost.";
+
+    for (unsigned int o = 0; o < T->Nodes.size(); o++)
+        {
+        for (unsigned int d = 0; d < T->Nodes.size(); d++)
+            {
+            ASSERT_EQ(Loaded->get_NumRoutes(o, d), Table->get_NumRoutes(o, d)) <<
+                    "The table read should be the same.";
+            for (unsigned int r = 0; r < Table->get_NumRoutes(o, d); r++)
+                {
+                auto Route = Table->get_Route(o, d, r);
+                auto LoadedRoute = Loaded->get_Route(o, d, r);
+                ASSERT_TRUE(std::equal(Route.first, Route.second, LoadedRoute.first)) <<
+                        "The table read should be the same.";
+                }
+            }
+        }
+
+    //A failed write keeps the previous table
+    const std::string TempFileName = FileName + ".tmp";
+    ASSERT_EQ(symlink("/dev/full", TempFileName.c_str()), 0);
+    Table->save(FileName);
+    EXPECT_NE(RouteTable::load(FileName, T, RoutingCost::SP, 3), nullptr) <<
+            "A failed write should keep the previous table.";
+    EXPECT_NE(unlink(TempFileName.c_str()), 0) << "A failed write should remove its file.";
+
+    std::remove(FileName.c_str());
+}
+
+TEST(RouteTableTest, DamagedTable)
+{
+    auto T = TopologyGenerator(TopologyGenerator::Waxman, 20).create();
+    RouteTable Table(T, RoutingCost::SP, 2);
+
+    std::ostringstream Name;
+    Name << "./" << std::hex << T->get_Hash() << std::dec << "_SP_2.routes";
+    const std::string FileName = Name.str();
+    Table.save(FileName);
+
+    std::ifstream File(FileName, std::ifstream::binary);
+    std::string Contents((std::istreambuf_iterator<char>(File)),
+                         std::istreambuf_iterator<char>());
+    File.close();
+
+    //The header is followed by FirstRoute, FirstLink and RouteLinks, each
+    //with its size
+    const size_t FirstLinkOffset = 32 + 8 + 4 * (T->Nodes.size() * T->Nodes.size() + 1);
+    const uint32_t Damaged = 0xFFFFFFFF;
+
+    //A link index past the links, and an offset of FirstLink that decreases
+    std::vector<std::string> Invalid = {Contents, Contents};
+    std::memcpy(&Invalid[0][Contents.size() - 4], &Damaged, sizeof(Damaged));
+    std::memcpy(&Invalid[1][FirstLinkOffset + 8 + 4], &Damaged, sizeof(Damaged));
+
+    for (auto &Bytes : Invalid)
+        {
+        std::ofstream(FileName, std::ofstream::binary) << Bytes;
+        EXPECT_EQ(RouteTable::load(FileName, T, RoutingCost::SP, 2), nullptr) <<
+                "A damaged table should be rejected.";
+        }
+
+    //The damaged table is computed again
+    RouteTable::Directory = ".";
+    auto Recomputed = RouteTable::get_RouteTable(T, RoutingCost::SP, 2);
+    RouteTable::Directory = "";
+    for (unsigned int o = 0; o < T->Nodes.size(); o++)
+        {
+        for (unsigned int d = 0; d < T->Nodes.size(); d++)
+            {
+            ASSERT_EQ(Recomputed->get_NumRoutes(o, d), Table.get_NumRoutes(o, d)) <<
+                    "A damaged table should be computed again.";
+            for (unsigned int r = 0; r < Table.get_NumRoutes(o, d); r++)
+                {
+                auto Route = Table.get_Route(o, d, r);
+                auto RecomputedRoute = Recomputed->get_Route(o, d, r);
+                ASSERT_TRUE(std::equal(Route.first, Route.second, RecomputedRoute.first)) <<
+                        "A damaged table should be computed again.";
+                }
+            }
+        }
+    EXPECT_NE(RouteTable::load(FileName, T, RoutingCost::SP, 2), nullptr) <<
+            "The table computed again should replace the damaged one.";
+
+    std::remove(FileName.c_str());
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifdef RUN_TESTS
+
+#include "include/RMSA/RoutingAlgorithms/ShortestPathSearch.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+
+using namespace RMSA::ROUT;
+
+namespace
+{
+/**
+ * Returns the distances from \a Origin to every node, by Bellman-Ford's
+ * algorithm, over the links of finite cost and the active nodes.
+ */
+std::vector<double> get_Distances(const RoutingGraph &G,
+                                  const std::vector<double> &Costs, unsigned int Origin)
+{
+    const double Max = std::numeric_limits<double>::max();
+    std::vector<double> Distances(G.NumNodes, Max);
+    Distances[Origin] = 0;
+
+    for (unsigned int it = 0; it < G.NumNodes; it++)
+        {
+        for (unsigned int l = 0; l < G.NumLinks; l++)
+            {
+            if (Costs[l] == Max || Distances[G.LinkOrigin[l]] == Max ||
+                    !G.is_NodeActive(G.LinkDestination[l]))
+                {
+                continue;
+                }
+            Distances[G.LinkDestination[l]] = std::min(Distances[G.LinkDestination[l]],
+                                                       Distances[G.LinkOrigin[l]] + Costs[l]);
+            }
+        }
+
+    return Distances;
+}
+
+double get_Cost(const std::vector<unsigned int> &Path, const std::vector<double> &Costs)
+{
+    double Cost = 0;
+    for (auto l : Path)
+        {
+        Cost += Costs[l];
+        }
+    return Cost;
+}
+}
+
+TEST(ShortestPathSearchTest, Distances)
+{
+    auto T = TopologyGenerator(TopologyGenerator::Waxman, 30).create();
+    const RoutingGraph &G = T->get_RoutingGraph();
+
+    //Fractional costs, some links blocked and one node inactive
+    std::vector<double> Costs(G.NumLinks);
+    for (unsigned int l = 0; l < G.NumLinks; l++)
+        {
+        Costs[l] = (l % 7 == 3) ? std::numeric_limits<double>::max() :
+                   G.LinkLength[l] * (1 + 0.37 * (l % 5)) / 1000;
+        }
+    T->Nodes[5]->set_NodeInactive();
+
+    ShortestPathSearch &Search = ShortestPathSearch::get_ThreadSearch();
+    auto Cost = [&](unsigned int l)
+        {
+        return Costs[l];
+        };
+    std::vector<unsigned int> Path;
+
+    for (unsigned int o = 0; o < G.NumNodes; o++)
+        {
+        auto Distances = get_Distances(G, Costs, o);
+
+        Search.find_Tree(G, Cost, o);
+        for (unsigned int d = 0; d < G.NumNodes; d++)
+            {
+            ASSERT_NEAR(Search.get_Distance(d), Distances[d], 1E-9) <<
+                    "The tree should have the shortest distances.";
+            }
+
+        for (unsigned int d = 0; d < G.NumNodes; d++)
+            {
+            if (o == d)
+                {
+                continue;
+                }
+
+            for (bool isBidirectional : {false, true})
+                {
+                bool hasPath = Search.find_Path(G, Cost, o, d, Path, isBidirectional);
+                ASSERT_EQ(hasPath, Distances[d] != std::numeric_limits<double>::max()) <<
+                        "A path should be found iff the destination is reachable.";
+                if (!hasPath)
+                    {
+                    EXPECT_TRUE(Path.empty()) << "There should be no path.";
+                    continue;
+                    }
+
+                ASSERT_FALSE(Path.empty()) << "There should be a path.";
+                EXPECT_EQ(G.LinkOrigin[Path.front()], o) << "The path should leave the origin.";
+                EXPECT_EQ(G.LinkDestination[Path.back()], d) << "The path should reach the destination.";
+                for (unsigned int l = 1; l < Path.size(); l++)
+                    {
+                    ASSERT_EQ(G.LinkOrigin[Path[l]], G.LinkDestination[Path[l - 1]]) <<
+                            "The links of the path should be contiguous.";
+                    }
+                EXPECT_NEAR(get_Cost(Path, Costs), Distances[d], 1E-9) <<
+                        "The path should be a shortest path.";
+                }
+            }
+        }
+}
+
+#endif
@@ -0,0 +1,171 @@
+#ifdef RUN_TESTS
+
+#include "include/SimulationTypes/NetworkFork.h"
+#include "include/SimulationTypes/NetworkSimulation.h"
+#include "include/Calls.h"
+#include "include/RMSA.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace Simulations;
+
+namespace
+{
+/**
+ * Implements a connection of two slots over the links of \a Path every time
+ * unit, each lasting three time units, for \a NumEvents time units.
+ */
+void simulate_Ahead(std::shared_ptr<NetworkFork> Fork,
+                    const std::vector<unsigned int> &Path, unsigned int NumEvents)
+{
+    for (unsigned int e = 0; e < NumEvents; e++)
+        {
+        Fork->advance(Fork->get_Time() + 1);
+
+        int Slot = Fork->find_FirstFit(Path, 2);
+        if (Slot != -1)
+            {
+            NetworkFork::Connection C;
+            for (auto l : Path)
+                {
+                C.Slots.push_back({l, (unsigned int) Slot});
+                C.Slots.push_back({l, (unsigned int) Slot + 1});
+                }
+            Fork->implement(C, Fork->get_Time() + 3);
+            }
+        }
+}
+}
+
+TEST(NetworkForkTest, CopyOnWrite)
+{
+    auto T = TopologyGenerator(TopologyGenerator::Grid, 100).create();
+    unsigned int NumPages = (T->Links.size() + NetworkState::PageSize - 1) /
+                            NetworkState::PageSize +
+                            (T->Nodes.size() + NetworkState::PageSize - 1) / NetworkState::PageSize;
+
+    auto Root = std::make_shared<NetworkFork>(T, 0);
+    NetworkFork::Connection C;
+    C.Slots = {{0, 0}, {0, 1}};
+    C.Regenerators = {{0, 2}};
+    Root->implement(C, 10);
+    EXPECT_TRUE(T->get_State().get_Link(0).FreeSlots.test(0)) <<
+            "The fork should not change the topology.";
+    EXPECT_EQ(T->get_State().get_Node(0).NumUsedRegenerators, 0) <<
+            "The fork should not change the topology.";
+
+    auto Fork = Root->fork();
+    EXPECT_EQ(Fork->get_State().get_NumSharedPages(), NumPages) <<
+            "A new fork should share every page.";
+    EXPECT_EQ(Fork->get_NumPendingDepartures(), 1) << "The departures should be forked.";
+
+    C.Slots = {{0, 5}};
+    C.Regenerators.clear();
+    Fork->implement(C, 5);
+    EXPECT_EQ(Fork->get_State().get_NumSharedPages(), NumPages - 1) <<
+            "Only the changed page should be copied.";
+    EXPECT_FALSE(Fork->get_RoutingGraph().get_FreeSlots(0).test(5)) <<
+            "The routing graph of the fork should read its state.";
+    EXPECT_TRUE(Root->get_State().get_Link(0).FreeSlots.test(5)) <<
+            "A fork should not change its parent.";
+
+    Fork->advance(6);
+    EXPECT_TRUE(Fork->get_State().get_Link(0).FreeSlots.test(5)) << "The connection should have departed.";
+    EXPECT_FALSE(Fork->get_State().get_Link(0).FreeSlots.test(0)) << "The connection should not have departed.";
+
+    Fork->advance(10);
+    EXPECT_EQ(Fork->get_State().get_Link(0).get_NumFreeSlots(), T->get_NumSlots()) <<
+            "Every connection should have departed.";
+    EXPECT_EQ(Fork->get_State().get_Node(0).NumUsedRegenerators, 0) <<
+            "The regenerators should have been freed.";
+    EXPECT_EQ(Root->get_NumPendingDepartures(), 1) << "A fork should not change its parent.";
+    EXPECT_FALSE(Root->get_State().get_Link(0).FreeSlots.test(0)) <<
+            "A fork should not change its parent.";
+}
+
+TEST(NetworkForkTest, Lookahead)
+{
+    class ForkingSimulation : public NetworkSimulation
+    {
+    public:
+        using NetworkSimulation::NetworkSimulation;
+        std::shared_ptr<NetworkFork> Fork;
+        unsigned int NumConnections = 0;
+
+    protected:
+        void implement_call(const Event &evt)
+        {
+            if (NumCalls == 500)
+                {
+                Fork = fork();
+                NumConnections = Connections.get_NumConnections();
+                }
+            NetworkSimulation::implement_call(evt);
+        }
+    };
+
+    using namespace RMSA;
+    auto T = TopologyGenerator(TopologyGenerator::Grid, 16).create();
+    auto R_Alg = ROUT::RoutingAlgorithm::create_RoutingAlgorithm(
+                     ROUT::RoutingAlgorithm::dijkstra, ROUT::RoutingCost::SP, T);
+    auto WA_Alg = SA::SpectrumAssignmentAlgorithm::create_SpectrumAssignmentAlgorithm(
+                      SA::SpectrumAssignmentAlgorithm::FF, T);
+    auto RMSA = std::make_shared<RoutingWavelengthAssignment>(
+                    R_Alg, WA_Alg, nullptr, ModulationScheme::DefaultSchemes, T);
+    auto Sim = std::make_shared<ForkingSimulation>(
+                   std::make_shared<CallGenerator>(T, 200), RMSA, 1000);
+    Sim->set_RandomStreams(0);
+    Sim->run();
+
+    auto Root = Sim->Fork;
+    ASSERT_NE(Root, nullptr) << "The simulation should have been forked.";
+    ASSERT_GT(Sim->NumConnections, 0) << "There should be active connections.";
+    EXPECT_EQ(Root->get_NumPendingDepartures(), Sim->NumConnections) <<
+            "Every active connection should be a pending departure.";
+    EXPECT_EQ(T->get_State().get_Link(0).get_NumFreeSlots(), T->get_NumSlots()) <<
+            "The simulation should have freed every slot.";
+
+    //Each candidate is simulated ahead on its own thread, and again serially.
+    const unsigned int NumForks = 4;
+    std::vector<std::shared_ptr<NetworkFork>> Forks, SerialForks;
+    std::vector<std::thread> Threads;
+    for (unsigned int f = 0; f < NumForks; f++)
+        {
+        Forks.push_back(Root->fork());
+        SerialForks.push_back(Root->fork());
+        }
+    for (unsigned int f = 0; f < NumForks; f++)
+        {
+        Threads.emplace_back(simulate_Ahead, Forks[f],
+                             std::vector<unsigned int> {f, f + NumForks}, 300);
+        }
+    for (auto &thread : Threads)
+        {
+        thread.join();
+        }
+
+    for (unsigned int f = 0; f < NumForks; f++)
+        {
+        simulate_Ahead(SerialForks[f], {f, f + NumForks}, 300);
+
+        for (unsigned int l = 0; l < T->Links.size(); l++)
+            {
+            ASSERT_EQ(Forks[f]->get_State().get_Link(l).FreeSlots,
+                      SerialForks[f]->get_State().get_Link(l).FreeSlots) <<
+                              "Concurrent forks should not interfere.";
+            }
+        }
+
+    EXPECT_EQ(Root->get_NumPendingDepartures(), Sim->NumConnections) <<
+            "The forks should not change their parent.";
+
+    Root->advance(std::numeric_limits<double>::infinity());
+    for (unsigned int l = 0; l < T->Links.size(); l++)
+        {
+        ASSERT_EQ(Root->get_State().get_Link(l).get_NumFreeSlots(), T->get_NumSlots()) <<
+                "Every connection should have departed.";
+        }
+}
+
+#endif
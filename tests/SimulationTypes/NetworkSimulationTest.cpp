@@ -0,0 +1,353 @@
+#ifdef RUN_TESTS
+
+#include "include/SimulationTypes/NetworkSimulation.h"
+#include "include/Calls/CallGenerator.h"
+#include "include/RMSA.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <sys/stat.h>
+#include <vector>
+
+class NetworkSimulationTest : public ::testing::Test
+{
+public:
+    void SetUp();
+
+    std::shared_ptr<Simulations::NetworkSimulation> create_Simulation(
+        RMSA::ROUT::RoutingCost::RoutingCosts Cost = RMSA::ROUT::RoutingCost::SP);
+
+    static constexpr unsigned long numCalls = 5000;
+    std::shared_ptr<Topology> T;
+    std::string FileName = "NetworkSimulationTest.ckpt";
+};
+
+void NetworkSimulationTest::SetUp()
+{
+    T = std::make_shared<Topology>();
+
+    for (int n = 1; n <= 6; n++)
+        {
+        T->add_Node(n);
+        }
+
+    //Bidirectional ring. Lengths are powers of two, so that there are no ties
+    //between routes.
+    for (int n = 0; n < 6; n++)
+        {
+        T->add_Link(T->Nodes[n], T->Nodes[(n + 1) % 6], 100 << n);
+        T->add_Link(T->Nodes[(n + 1) % 6], T->Nodes[n], 100 << n);
+        }
+}
+
+std::shared_ptr<Simulations::NetworkSimulation>
+NetworkSimulationTest::create_Simulation(RMSA::ROUT::RoutingCost::RoutingCosts Cost)
+{
+    using namespace RMSA;
+
+    std::shared_ptr<Topology> TopologyCopy(new Topology(*T));
+
+    auto R_Alg = ROUT::RoutingAlgorithm::create_RoutingAlgorithm(
+                     ROUT::RoutingAlgorithm::dijkstra, Cost, TopologyCopy);
+    auto WA_Alg = SA::SpectrumAssignmentAlgorithm::create_SpectrumAssignmentAlgorithm(
+                      SA::SpectrumAssignmentAlgorithm::RF, TopologyCopy);
+    auto Generator = std::make_shared<CallGenerator>(TopologyCopy, 300);
+    auto RMSA = std::make_shared<RoutingWavelengthAssignment>(
+                    R_Alg, WA_Alg, nullptr, ModulationScheme::DefaultSchemes, TopologyCopy);
+
+    auto Sim = std::make_shared<Simulations::NetworkSimulation>(Generator, RMSA,
+               numCalls);
+    Sim->set_RandomStreams(0);
+    return Sim;
+}
+
+TEST_F(NetworkSimulationTest, CheckpointResume)
+{
+    auto Reference = create_Simulation();
+    Reference->run();
+    ASSERT_GT(Reference->NumBlockedCalls, 0) << "The test load should block some calls.";
+
+    auto Checkpointed = create_Simulation();
+    Checkpointed->set_Checkpointing(FileName, 2000);
+    Checkpointed->run();
+    EXPECT_EQ(Checkpointed->NumBlockedCalls, Reference->NumBlockedCalls) <<
+            "Saving checkpoints should not change the simulation.";
+
+    auto Resumed = create_Simulation();
+    ASSERT_TRUE(Resumed->load_Checkpoint(FileName)) << "The checkpoint should be valid.";
+    EXPECT_EQ(Resumed->NumCalls, 4000) << "The last checkpoint should be restored.";
+    EXPECT_GT(Resumed->NumOccupiedSlots, 0) << "The active calls should be restored.";
+
+    Resumed->run();
+    EXPECT_EQ(Resumed->NumCalls, Reference->NumCalls) <<
+            "A resumed run should match an uninterrupted run.";
+    EXPECT_EQ(Resumed->NumBlockedCalls, Reference->NumBlockedCalls) <<
+            "A resumed run should match an uninterrupted run.";
+    EXPECT_EQ(Resumed->NumBlockedCalls_Spectrum, Reference->NumBlockedCalls_Spectrum) <<
+            "A resumed run should match an uninterrupted run.";
+    EXPECT_EQ(Resumed->NumOccupiedSlots, 0) << "Every call should have been dropped.";
+    EXPECT_DOUBLE_EQ(Resumed->Generator->simulationTime,
+                     Reference->Generator->simulationTime) <<
+                             "A resumed run should match an uninterrupted run.";
+
+    std::remove(FileName.c_str());
+}
+
+TEST_F(NetworkSimulationTest, CheckpointRoutingTrees)
+{
+    using namespace RMSA::ROUT;
+    Dijkstra_RoutingAlgorithm::useDynamicTrees = true;
+
+    auto Checkpointed = create_Simulation(RoutingCost::LORa);
+    Checkpointed->set_Checkpointing(FileName, 2000);
+    Checkpointed->run();
+
+    //The trees of the resumed simulation are built over the empty network
+    auto Resumed = create_Simulation(RoutingCost::LORa);
+    auto ResumedT = Resumed->Generator->T;
+    std::vector<std::shared_ptr<Call>> Calls;
+    for (auto &orig : ResumedT->Nodes)
+        {
+        for (auto &dest : ResumedT->Nodes)
+            {
+            if (orig != dest)
+                {
+                Calls.push_back(std::make_shared<Call>(orig, dest,
+                                                       *TransmissionBitrate::DefaultBitrates.begin(),
+                                                       *ModulationScheme::DefaultSchemes.begin()));
+                Resumed->RMSA->R_Alg->route(Calls.back());
+                }
+            }
+        }
+    ASSERT_TRUE(Resumed->load_Checkpoint(FileName)) << "The checkpoint should be valid.";
+
+    auto Fresh = RoutingAlgorithm::create_RoutingAlgorithm(RoutingAlgorithm::dijkstra,
+                 RoutingCost::LORa, ResumedT, false);
+    for (auto &call : Calls)
+        {
+        auto Routes = Resumed->RMSA->R_Alg->route(call);
+        auto FreshRoutes = Fresh->route(call);
+        ASSERT_EQ(Routes.size(), FreshRoutes.size());
+        for (size_t r = 0; r < Routes.size(); r++)
+            {
+            ASSERT_EQ(Routes[r].size(), FreshRoutes[r].size()) <<
+                    "The routes should follow the state of the checkpoint.";
+            for (size_t l = 0; l < Routes[r].size(); l++)
+                {
+                EXPECT_EQ(Routes[r][l].lock(), FreshRoutes[r][l].lock()) <<
+                        "The routes should follow the state of the checkpoint.";
+                }
+            }
+        }
+
+    Dijkstra_RoutingAlgorithm::useDynamicTrees = false;
+    std::remove(FileName.c_str());
+}
+
+TEST_F(NetworkSimulationTest, CheckpointWriteFailure)
+{
+    auto Sim = create_Simulation();
+    Sim->save_Checkpoint(FileName);
+
+    std::ifstream Saved(FileName, std::ifstream::binary);
+    std::string Previous((std::istreambuf_iterator<char>(Saved)),
+                         std::istreambuf_iterator<char>());
+    Saved.close();
+    ASSERT_FALSE(Previous.empty()) << "The checkpoint should have been written.";
+
+    //The temporary file can not be created over a directory
+    std::string TemporaryFileName = FileName + ".tmp";
+    ASSERT_EQ(mkdir(TemporaryFileName.c_str(), 0700), 0);
+    Sim->NumCalls = 1;
+    Sim->save_Checkpoint(FileName);
+
+    std::ifstream Kept(FileName, std::ifstream::binary);
+    std::string Current((std::istreambuf_iterator<char>(Kept)),
+                        std::istreambuf_iterator<char>());
+    Kept.close();
+    EXPECT_EQ(Current, Previous) << "A failed write should keep the previous checkpoint.";
+
+    std::remove(TemporaryFileName.c_str());
+    std::remove(FileName.c_str());
+}
+
+TEST_F(NetworkSimulationTest, CheckpointInvalid)
+{
+    auto Checkpointed = create_Simulation();
+    Checkpointed->set_Checkpointing(FileName, 2000);
+    Checkpointed->run();
+
+    std::ifstream Saved(FileName, std::ifstream::binary);
+    std::string Contents((std::istreambuf_iterator<char>(Saved)),
+                         std::istreambuf_iterator<char>());
+    Saved.close();
+    ASSERT_GT(Contents.size(), 64u) << "The checkpoint should have been written.";
+
+    auto write = [this](const std::string &Data)
+        {
+        std::ofstream File(FileName, std::ofstream::binary | std::ofstream::trunc);
+        File.write(Data.data(), Data.size());
+        };
+
+    auto Other = create_Simulation();
+    Other->NumMaxCalls = numCalls + 1;
+    EXPECT_FALSE(Other->load_Checkpoint(FileName)) <<
+            "A checkpoint of another number of calls should be rejected.";
+
+    Other = create_Simulation();
+    Other->Generator->h += 1;
+    EXPECT_FALSE(Other->load_Checkpoint(FileName)) <<
+            "A checkpoint of another load should be rejected.";
+
+    Other = create_Simulation();
+    Other->set_Checkpointing(FileName, 2000, 1);
+    EXPECT_FALSE(Other->load_Checkpoint(FileName)) <<
+            "A checkpoint of other parameters should be rejected.";
+
+    auto Ring = T;
+    T = std::make_shared<Topology>(*Ring);
+    T->add_Link(T->Nodes[0], T->Nodes[3], 1000);
+    Other = create_Simulation();
+    EXPECT_FALSE(Other->load_Checkpoint(FileName)) <<
+            "A checkpoint of another topology should be rejected.";
+    T = Ring;
+
+    std::string Corrupt = Contents;
+    Corrupt[Corrupt.size() / 2] ^= 0x5A;
+    write(Corrupt);
+    auto Sim = create_Simulation();
+    EXPECT_FALSE(Sim->load_Checkpoint(FileName)) <<
+            "A corrupt checkpoint should be rejected.";
+
+    write(Contents.substr(0, Contents.size() - 1));
+    EXPECT_FALSE(Sim->load_Checkpoint(FileName)) <<
+            "A truncated checkpoint should be rejected.";
+
+    write(Contents.substr(0, 4));
+    EXPECT_FALSE(Sim->load_Checkpoint(FileName)) <<
+            "A file without a header should be rejected.";
+
+    std::remove(FileName.c_str());
+    EXPECT_FALSE(Sim->load_Checkpoint(FileName)) <<
+            "A missing checkpoint should be rejected.";
+
+    EXPECT_EQ(Sim->NumCalls, 0u) << "A rejected checkpoint should not be loaded.";
+    EXPECT_EQ(Sim->NumOccupiedSlots, 0) << "A rejected checkpoint should not be loaded.";
+    Sim->run();
+    EXPECT_EQ(Sim->NumBlockedCalls, Checkpointed->NumBlockedCalls) <<
+            "A simulation that rejected a checkpoint should run afresh.";
+}
+
+TEST_F(NetworkSimulationTest, MetricsStream)
+{
+    std::string MetricsFileName = "NetworkSimulationTest.metrics.csv";
+
+    auto Sim = create_Simulation();
+    Sim->set_MetricsStream(MetricsFileName, 500, 0);
+    Sim->run();
+
+    std::ifstream MetricsFile(MetricsFileName);
+    std::string Line;
+    ASSERT_TRUE(std::getline(MetricsFile, Line)) << "The file should have a header.";
+
+    unsigned NumSamples = 0;
+    double IntervalBlockingSum = 0;
+    while (std::getline(MetricsFile, Line))
+        {
+        std::istringstream Sample(Line);
+        double Time, IntervalBlocking, Utilisation;
+        unsigned long NumCalls, ActiveCalls, RegeneratorsInUse;
+        char Separator;
+        Sample >> Time >> Separator >> NumCalls >> Separator >> IntervalBlocking >>
+               Separator >> Utilisation >> Separator >> ActiveCalls >> Separator >>
+               RegeneratorsInUse;
+
+        EXPECT_EQ(NumCalls, 500 * (NumSamples + 1)) << "Samples should be periodic.";
+        EXPECT_GE(Utilisation, 0) << "Utilisation should be a fraction.";
+        EXPECT_LE(Utilisation, 1) << "Utilisation should be a fraction.";
+        EXPECT_EQ(RegeneratorsInUse, 0) << "The test network is transparent.";
+        IntervalBlockingSum += IntervalBlocking;
+        NumSamples++;
+        }
+
+    EXPECT_EQ(NumSamples, numCalls / 500) << "Every sample should be written.";
+    EXPECT_NEAR(IntervalBlockingSum / NumSamples, Sim->get_CallBlockingProbability(),
+                1.0 / 500) << "Interval blockings should average to the blocking.";
+
+    MetricsFile.close();
+    std::remove(MetricsFileName.c_str());
+}
+
+TEST_F(NetworkSimulationTest, CheckpointMetricsStream)
+{
+    //The checkpoints are not aligned with the samples, so the resumed run must
+    //continue the interval of the checkpoint.
+    std::string ReferenceFileName = "NetworkSimulationTest.reference.csv";
+    std::string ResumedFileName = "NetworkSimulationTest.resumed.csv";
+
+    auto Reference = create_Simulation();
+    Reference->set_MetricsStream(ReferenceFileName, 700, 0);
+    Reference->run();
+
+    auto Checkpointed = create_Simulation();
+    Checkpointed->set_Checkpointing(FileName, 2000);
+    Checkpointed->set_MetricsStream(ResumedFileName, 700, 0);
+    Checkpointed->run();
+    std::remove(ResumedFileName.c_str());
+
+    auto Resumed = create_Simulation();
+    Resumed->set_MetricsStream(ResumedFileName, 700, 0);
+    ASSERT_TRUE(Resumed->load_Checkpoint(FileName)) << "The checkpoint should be valid.";
+    Resumed->run();
+
+    std::vector<std::string> ReferenceSamples, ResumedSamples;
+    std::string Line;
+    std::ifstream ReferenceFile(ReferenceFileName), ResumedFile(ResumedFileName);
+    while (std::getline(ReferenceFile, Line))
+        {
+        ReferenceSamples.push_back(Line);
+        }
+    while (std::getline(ResumedFile, Line))
+        {
+        ResumedSamples.push_back(Line);
+        }
+    ReferenceFile.close();
+    ResumedFile.close();
+
+    ASSERT_EQ(ResumedSamples.size(), 2u) << "The samples after the checkpoint should be written.";
+    for (size_t s = 0; s < ResumedSamples.size(); s++)
+        {
+        EXPECT_EQ(ResumedSamples[s],
+                  ReferenceSamples[ReferenceSamples.size() - ResumedSamples.size() + s]) <<
+                          "A resumed run should write the samples of an uninterrupted run.";
+        }
+
+    std::remove(ReferenceFileName.c_str());
+    std::remove(ResumedFileName.c_str());
+    std::remove(FileName.c_str());
+}
+
+TEST_F(NetworkSimulationTest, LinkFailure)
+{
+    auto Sim = create_Simulation();
+    unsigned FailedLink = Sim->Generator->T->Links.at(std::make_pair(1, 2))->Index;
+    Sim->schedule_LinkFailure(FailedLink, 5, 10);
+    Sim->schedule_NodeFailure(3, 12);
+    Sim->run();
+
+    EXPECT_GT(Sim->NumDisruptedCalls, 0u) << "The failures should disrupt some connections.";
+    EXPECT_GT(Sim->NumRestoredCalls, 0u) << "The ring should restore some connections.";
+    EXPECT_LT(Sim->NumRestoredCalls, Sim->NumDisruptedCalls) <<
+            "The connections ending on the failed node can not be restored.";
+    EXPECT_TRUE(Sim->Generator->T->get_RoutingGraph().is_LinkActive(FailedLink)) <<
+            "The link should have been repaired.";
+    EXPECT_FALSE(Sim->Generator->T->Nodes[3]->is_NodeActive()) <<
+            "The node should never be repaired.";
+    EXPECT_EQ(Sim->Connections.get_NumConnections(), 0u) << "Every call should have ended.";
+    EXPECT_EQ(Sim->NumOccupiedSlots, 0u) << "Every call should have freed its slots.";
+}
+
+#endif // RUN_TESTS
@@ -0,0 +1,140 @@
+#ifdef RUN_TESTS
+
+#include "include/SimulationTypes/Simulation_PairedComparison.h"
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+class Simulation_PairedComparisonTest : public ::testing::Test
+{
+public:
+    void SetUp();
+    void TearDown();
+
+    /**
+     * @brief The Result struct is a line of the results file.
+     */
+    struct Result
+    {
+        double BlockingProbability;
+        double Difference;
+        double DifferenceHalfWidth;
+    };
+
+    /**
+     * @brief compare runs a paired comparison of the configurations, each given
+     * by its routing cost and spectrum assignment algorithm, and reads back
+     * its results file.
+     */
+    std::vector<Result> compare(std::vector<std::pair<std::string, std::string>>
+                                Configurations);
+
+    std::shared_ptr<Topology> T;
+    std::string ConfigFileName = "Simulation_PairedComparisonTest.ini";
+    std::string ResultsFileName = "Simulation_PairedComparisonTest.results";
+};
+
+void Simulation_PairedComparisonTest::SetUp()
+{
+    T = std::make_shared<Topology>();
+
+    for (int n = 1; n <= 6; n++)
+        {
+        T->add_Node(n);
+        }
+
+    //Bidirectional ring.
+    for (int n = 0; n < 6; n++)
+        {
+        T->add_Link(T->Nodes[n], T->Nodes[(n + 1) % 6], 100 << n);
+        T->add_Link(T->Nodes[(n + 1) % 6], T->Nodes[n], 100 << n);
+        }
+}
+
+void Simulation_PairedComparisonTest::TearDown()
+{
+    std::remove(ConfigFileName.c_str());
+    std::remove(ResultsFileName.c_str());
+    std::remove("SimConfigFile.ini");
+}
+
+std::vector<Simulation_PairedComparisonTest::Result>
+Simulation_PairedComparisonTest::compare(
+    std::vector<std::pair<std::string, std::string>> Configurations)
+{
+    std::ofstream ConfigFile(ConfigFileName);
+    ConfigFile << "  [general]" << std::endl << std::endl;
+    ConfigFile << "  SimulationType = pairedcomparison" << std::endl;
+    ConfigFile << "  NetworkType = Transparent" << std::endl;
+    ConfigFile << "  AvgSpanLength = 80" << std::endl << std::endl;
+    ConfigFile << "  [algorithms]" << std::endl << std::endl;
+    for (auto &config : Configurations)
+        {
+        ConfigFile << "  RoutingAlgorithm = dijkstra" << std::endl;
+        ConfigFile << "  RoutingCost = " << config.first << std::endl;
+        ConfigFile << "  WavelengthAssignmentAlgorithm = " << config.second << std::endl;
+        }
+    ConfigFile << std::endl << "  [sim_info]" << std::endl << std::endl;
+    ConfigFile << "  NumCalls = 20000" << std::endl;
+    ConfigFile << "  NetworkLoad = 300" << std::endl;
+    ConfigFile << "  ConfidenceLevel = 0.95" << std::endl << std::endl;
+    ConfigFile.close();
+    T->save(ConfigFileName);
+
+    //The name of the results file is read from the standard input
+    std::istringstream Input(ResultsFileName);
+    auto *InputBuffer = std::cin.rdbuf(Input.rdbuf());
+    Simulations::Simulation_PairedComparison Sim;
+    Sim.load_file(ConfigFileName);
+    std::cin.rdbuf(InputBuffer);
+    Sim.run();
+
+    std::vector<Result> Results;
+    std::ifstream ResultsFile(ResultsFileName);
+    std::string Line;
+    while (std::getline(ResultsFile, Line))
+        {
+        std::istringstream Fields(Line);
+        unsigned int Index;
+        double HalfWidth;
+        Result R = {0, 0, 0};
+        Fields >> Index >> R.BlockingProbability >> HalfWidth >> R.Difference >>
+               R.DifferenceHalfWidth;
+        Results.push_back(R);
+        }
+
+    return Results;
+}
+
+TEST_F(Simulation_PairedComparisonTest, IdenticalConfigurations)
+{
+    auto Results = compare({{"SP", "FF"}, {"SP", "FF"}});
+
+    ASSERT_EQ(Results.size(), 2u) << "There should be a result per configuration.";
+    EXPECT_GT(Results[0].BlockingProbability, 0) << "The test load should block some calls.";
+    EXPECT_EQ(Results[1].BlockingProbability, Results[0].BlockingProbability) <<
+            "Identical configurations should see the same calls.";
+    EXPECT_EQ(Results[1].Difference, 0) <<
+            "The paired difference of identical configurations should be zero.";
+    EXPECT_EQ(Results[1].DifferenceHalfWidth, 0) <<
+            "The paired difference of identical configurations should have no variance.";
+}
+
+TEST_F(Simulation_PairedComparisonTest, WorseConfiguration)
+{
+    //The link lengths double along the ring, so the shortest paths take many
+    //more hops than needed, and block far more calls than the minimum hops
+    auto Results = compare({{"MH", "FF"}, {"SP", "FF"}});
+
+    ASSERT_EQ(Results.size(), 2u) << "There should be a result per configuration.";
+    EXPECT_GT(Results[1].Difference, Results[1].DifferenceHalfWidth) <<
+            "The confidence interval of the difference should exclude zero.";
+    //The results file rounds each value to six significant digits
+    EXPECT_NEAR(Results[1].Difference,
+                Results[1].BlockingProbability - Results[0].BlockingProbability, 1E-5) <<
+                        "The paired difference should be the difference of the blockings.";
+}
+
+#endif
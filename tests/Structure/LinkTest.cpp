@@ -6,6 +6,9 @@
 #include "Calls/Call.h"
 #include "Devices/Device.h"
 #include <gtest/gtest.h>
+#include <random>
+
+extern bool considerFilterImperfection;
 
 class LinkTest : public ::testing::Test
 {
@@ -35,10 +38,10 @@ TEST_F(LinkTest, Constructor)
     EXPECT_EQ(*(link1->Destination.lock()), *(N2.lock())) << "Destination node not being correctly set.";
     EXPECT_EQ(link1->Length, 1000) << "Link length not being correctly set.";
 
-    ASSERT_EQ(link1->Slots.size(), Link::NumSlots) << "Link slots aren't being correctly created.";
-    for (int s = 0; s < Link::NumSlots; ++s)
+    ASSERT_EQ(link1->Slots.size(), Link::DefaultNumSlots) << "Link slots aren't being correctly created.";
+    for (int s = 0; s < Link::DefaultNumSlots; ++s)
         {
-        EXPECT_TRUE(link1->Slots[s]->isFree) << "Link slot should be initialized as free.";
+        EXPECT_TRUE(link1->Slots[s]->isFree()) << "Link slot should be initialized as free.";
         EXPECT_TRUE(link1->isSlotFree(s)) << "Link slot should be initialized as free.";
         }
 
@@ -70,28 +73,130 @@ TEST_F(LinkTest, AvailabilityOccupability)
 {
     std::shared_ptr<Link> link = T->add_Link(N2, N3, 1000).lock();
 
-    EXPECT_EQ(link->get_Availability(), Link::NumSlots) << "All slots should be free when creating a new link.";
+    EXPECT_EQ(link->get_Availability(), Link::DefaultNumSlots) << "All slots should be free when creating a new link.";
     EXPECT_EQ(link->get_Occupability(), 0) << "No slots should be occupied when creating a new link.";
 
     link->Slots[0]->useSlot();
     link->Slots[1]->useSlot();
-    link->Slots[Link::NumSlots - 1]->useSlot();
-    EXPECT_EQ(link->get_Availability(), Link::NumSlots - 3) << "Availability measure not working as expected.";
+    link->Slots[Link::DefaultNumSlots - 1]->useSlot();
+    EXPECT_EQ(link->get_Availability(), Link::DefaultNumSlots - 3) << "Availability measure not working as expected.";
     EXPECT_EQ(link->get_Occupability(), 3) << "Occupability measure not working as expected.";
 
     link->Slots[0]->freeSlot();
-    EXPECT_EQ(link->get_Availability(), Link::NumSlots - 2) << "Availability measure not working as expected.";
+    EXPECT_EQ(link->get_Availability(), Link::DefaultNumSlots - 2) << "Availability measure not working as expected.";
     EXPECT_EQ(link->get_Occupability(), 2) << "Occupability measure not working as expected.";
 
-    link->Slots[Link::NumSlots - 1]->freeSlot();
-    EXPECT_EQ(link->get_Availability(), Link::NumSlots - 1) << "Availability measure not working as expected.";
+    link->Slots[Link::DefaultNumSlots - 1]->freeSlot();
+    EXPECT_EQ(link->get_Availability(), Link::DefaultNumSlots - 1) << "Availability measure not working as expected.";
     EXPECT_EQ(link->get_Occupability(), 1) << "Occupability measure not working as expected.";
 
     link->Slots[1]->freeSlot();
-    EXPECT_EQ(link->get_Availability(), Link::NumSlots) << "Availability measure not working as expected.";
+    EXPECT_EQ(link->get_Availability(), Link::DefaultNumSlots) << "Availability measure not working as expected.";
     EXPECT_EQ(link->get_Occupability(), 0) << "Occupability measure not working as expected.";
 }
 
+TEST_F(LinkTest, FreeSlots)
+{
+    std::shared_ptr<Link> link = T->add_Link(N2, N3, 1000).lock();
+
+    link->Slots[3]->useSlot();
+    EXPECT_FALSE(link->get_FreeSlots().test(3)) << "Using a slot should update the link.";
+
+    std::shared_ptr<Link> copy = std::make_shared<Link>(*link);
+    EXPECT_EQ(copy->get_FreeSlots(), link->get_FreeSlots()) << "Copy constructor: free slots not copied.";
+
+    copy->Slots[3]->freeSlot();
+    copy->Slots[5]->useSlot();
+    EXPECT_TRUE(copy->get_FreeSlots().test(3)) << "Copied slots should update their own link.";
+    EXPECT_FALSE(copy->get_FreeSlots().test(5)) << "Copied slots should update their own link.";
+    EXPECT_FALSE(link->get_FreeSlots().test(3)) << "Copied slots should not update the original link.";
+    EXPECT_TRUE(link->get_FreeSlots().test(5)) << "Copied slots should not update the original link.";
+}
+
+TEST_F(LinkTest, SpectrumMetrics)
+{
+    std::shared_ptr<Link> link = T->add_Link(N2, N3, 1000).lock();
+    EXPECT_EQ(link->get_LargestFreeBlock(), Link::DefaultNumSlots) << "The whole link should start free.";
+    EXPECT_EQ(link->get_Fragmentation(), 0) << "A free link is not fragmented.";
+
+    unsigned long long Version = link->get_Version();
+    std::mt19937 Generator(1);
+    for (int i = 0; i < 1000; i++)
+        {
+        auto &slot = link->Slots[Generator() % Link::DefaultNumSlots];
+        slot->isFree() ? slot->useSlot() : slot->freeSlot();
+
+        const SlotBitset &Free = link->get_FreeSlots();
+        ASSERT_EQ(link->get_Availability(), Free.count()) << "Free slot count out of sync.";
+        ASSERT_EQ(link->get_LargestFreeBlock(), Free.get_LongestRun()) << "Largest free block out of sync.";
+        }
+
+    NetworkState::LinkState LState(100);
+    for (int i = 0; i < 1000; i++)
+        {
+        unsigned s = Generator() % 100;
+        LState.FreeSlots.test(s) ? LState.use_Slot(s) : LState.free_Slot(s);
+
+        for (unsigned w : {1, 2, 3, 5, 8})
+            {
+            ASSERT_EQ(LState.get_NumPositions(w), LState.FreeSlots.get_NumPositions(w)) <<
+                    "Contiguity out of sync.";
+            }
+        }
+    EXPECT_EQ(link->get_Version(), Version + 1000) << "Every change should bump the version.";
+
+    //Free slots 0, 2, 4, ...: no two free slots are consecutive
+    for (auto &slot : link->Slots)
+        {
+        if (slot->numSlot % 2 == slot->isFree())
+            {
+            slot->isFree() ? slot->useSlot() : slot->freeSlot();
+            }
+        }
+    EXPECT_NEAR(link->get_Fragmentation(), 1, 1E-9) << "Isolated free slots are fully fragmented.";
+    link->set_LinkInactive();
+    EXPECT_GT(link->get_Version(), Version + 1000) << "Deactivating should bump the version.";
+}
+
+TEST_F(LinkTest, SpectralDensity)
+{
+    bool backup_Filter = considerFilterImperfection;
+
+    considerFilterImperfection = false;
+    std::shared_ptr<Link> link = T->add_Link(N1, N2, 1000).lock();
+    EXPECT_FALSE(link->linkSpecDens) << "Spectral density allocated without filter imperfection.";
+
+    considerFilterImperfection = true;
+    link = T->add_Link(N2, N3, 1000).lock();
+    ASSERT_TRUE(link->linkSpecDens) << "Spectral density not allocated with filter imperfection.";
+
+    std::vector<std::weak_ptr<Slot>> Slots = {link->Slots[5], link->Slots[4], link->Slots[6]};
+    SpectralDensity PSD(link->Slots[4]->get_FreqMin(), link->Slots[6]->get_FreqMax(),
+                        3 * Slot::samplesPerSlot);
+    link->linkSpecDens->updateLink(PSD, Slots);
+    for (auto &slot : Slots)
+        {
+        slot.lock()->useSlot();
+        }
+
+    std::shared_ptr<SpectralDensity> Slice = link->linkSpecDens->slice(Slots);
+    EXPECT_EQ(Slice->freqMin, PSD.freqMin) << "Slice has the wrong bandwidth.";
+    EXPECT_EQ(Slice->freqMax, PSD.freqMax) << "Slice has the wrong bandwidth.";
+    EXPECT_EQ(*Slice, PSD) << "Slice differs from the update.";
+
+    link->Slots[5]->freeSlot();
+    const double *Samples = link->linkSpecDens->get_Samples(4);
+    EXPECT_TRUE(std::equal(Samples, Samples + Slot::samplesPerSlot, PSD.specDensity.memptr()))
+            << "Freeing a slot cleared another.";
+    EXPECT_TRUE(std::all_of(Samples + Slot::samplesPerSlot, Samples + 2 * Slot::samplesPerSlot,
+                            [](double Sample)
+        {
+        return Sample == 0;
+        })) << "Freeing a slot should clear it.";
+
+    considerFilterImperfection = backup_Filter;
+}
+
 TEST_F(LinkTest, Contiguity)
 {
     std::shared_ptr<Link> link = T->add_Link(N2, N3, 1000).lock();
@@ -102,20 +207,20 @@ TEST_F(LinkTest, Contiguity)
     std::shared_ptr<Call> C = std::make_shared<Call>(N2, N3, br, scheme);
     int reqSlots = scheme.get_NumSlots(br);
 
-    EXPECT_EQ(link->get_Contiguity(C), Link::NumSlots - reqSlots + 1) << "In a link completely free, there should be NumSlots - reqSlots + 1 possible ways of allocating a call that requires reqSlots.";
-    EXPECT_LT(reqSlots, Link::NumSlots) << "Possible requisition asks for more slots than there are available in a link.";
+    EXPECT_EQ(link->get_Contiguity(C), Link::DefaultNumSlots - reqSlots + 1) << "In a link completely free, there should be NumSlots - reqSlots + 1 possible ways of allocating a call that requires reqSlots.";
+    EXPECT_LT(reqSlots, Link::DefaultNumSlots) << "Possible requisition asks for more slots than there are available in a link.";
 
     for (int s = 1; s < reqSlots + 1; ++s) //Leaving one slot free and then reqSlot occupied slots.
         {
         link->Slots.at(s)->useSlot();
         }
-    EXPECT_EQ(link->get_Contiguity(C), Link::NumSlots - 2 * reqSlots) << "Contiguity measure not working as expected.";
+    EXPECT_EQ(link->get_Contiguity(C), Link::DefaultNumSlots - 2 * reqSlots) << "Contiguity measure not working as expected.";
 
     for (int s = 1; s < reqSlots + 1; ++s)
         {
         link->Slots.at(s)->freeSlot();
         }
-    EXPECT_EQ(link->get_Contiguity(C), Link::NumSlots - reqSlots + 1) << "In a link completely free, there should be NumSlots - reqSlots + 1 possible ways of allocating a call that requires reqSlots.";
+    EXPECT_EQ(link->get_Contiguity(C), Link::DefaultNumSlots - reqSlots + 1) << "In a link completely free, there should be NumSlots - reqSlots + 1 possible ways of allocating a call that requires reqSlots.";
 }
 
 TEST_F(LinkTest, Devices)
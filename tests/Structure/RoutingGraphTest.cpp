@@ -0,0 +1,57 @@
+#ifdef RUN_TESTS
+
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+
+TEST(RoutingGraphTest, Adjacency)
+{
+    auto T = std::make_shared<Topology>();
+    auto N1 = T->add_Node(10);
+    auto N2 = T->add_Node(20);
+    auto N3 = T->add_Node(30);
+    auto L12 = T->add_Link(N1, N2, 100);
+    auto L13 = T->add_Link(N1, N3, 300);
+    auto L32 = T->add_Link(N3, N2, 150);
+
+    const RoutingGraph &G = T->get_RoutingGraph();
+    ASSERT_EQ(G.NumNodes, 3) << "There should be three nodes.";
+    ASSERT_EQ(G.NumLinks, 3) << "There should be three links.";
+    ASSERT_EQ(G.FirstEdge.size(), 4) << "There should be one offset per node plus one.";
+
+    unsigned int n1 = N1.lock()->Index, n3 = N3.lock()->Index;
+    ASSERT_EQ(G.FirstEdge[n1 + 1] - G.FirstEdge[n1], 2) << "Node 10 has two outgoing links.";
+    EXPECT_EQ(G.EdgeLink[G.FirstEdge[n1]], L12.lock()->Index) << "Edges should follow Node::Links.";
+    EXPECT_EQ(G.EdgeTarget[G.FirstEdge[n1]], N2.lock()->Index) << "Wrong edge target.";
+    EXPECT_EQ(G.EdgeLink[G.FirstEdge[n1] + 1], L13.lock()->Index) << "Edges should follow Node::Links.";
+    EXPECT_EQ(G.FirstEdge[n3 + 1] - G.FirstEdge[n3], 1) << "Node 30 has one outgoing link.";
+
+    unsigned int n2 = N2.lock()->Index;
+    ASSERT_EQ(G.FirstInEdge[n2 + 1] - G.FirstInEdge[n2], 2) << "Node 20 has two incoming links.";
+    EXPECT_EQ(G.FirstInEdge[n1 + 1] - G.FirstInEdge[n1], 0) << "Node 10 has no incoming link.";
+    for (unsigned int e = G.FirstInEdge[n2]; e < G.FirstInEdge[n2 + 1]; e++)
+        {
+        EXPECT_EQ(G.LinkDestination[G.InEdgeLink[e]], n2) << "Wrong incoming link.";
+        EXPECT_EQ(G.LinkOrigin[G.InEdgeLink[e]], G.InEdgeSource[e]) << "Wrong edge source.";
+        }
+
+    unsigned int l32 = L32.lock()->Index;
+    EXPECT_EQ(G.LinkOrigin[l32], n3) << "Wrong link origin.";
+    EXPECT_EQ(G.LinkDestination[l32], N2.lock()->Index) << "Wrong link destination.";
+    EXPECT_EQ(G.LinkLength[l32], 150) << "Wrong link length.";
+    EXPECT_EQ(G.LinkNumSpans[l32], L32.lock()->numLineAmplifiers + 1) << "Wrong number of spans.";
+    EXPECT_EQ(G.LengthLongestLink, 300) << "Wrong longest link.";
+    EXPECT_EQ(G.Links[l32], L32.lock()) << "Wrong link pointer.";
+
+    L32.lock()->set_LinkInactive();
+    EXPECT_FALSE(G.is_LinkActive(l32)) << "The activity should be read from the state.";
+    L12.lock()->Slots[0]->useSlot();
+    EXPECT_EQ(G.get_FreeSlots(L12.lock()->Index).count(), Link::DefaultNumSlots - 1) <<
+            "The free slots should be read from the state.";
+
+    auto N4 = T->add_Node(40);
+    T->add_Link(N2, N4, 50);
+    EXPECT_EQ(T->get_RoutingGraph().NumNodes, 4) << "The graph should be rebuilt.";
+    EXPECT_EQ(T->get_RoutingGraph().NumLinks, 4) << "The graph should be rebuilt.";
+}
+
+#endif
@@ -0,0 +1,173 @@
+#ifdef RUN_TESTS
+
+#include "Structure/SlotBitset.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TEST(SlotBitsetTest, Constructor)
+{
+    SlotBitset Empty(100);
+    EXPECT_EQ(Empty.size(), 100u) << "Size not being correctly set.";
+    EXPECT_EQ(Empty.count(), 0u) << "Bits should start unset.";
+
+    SlotBitset Full(100, true);
+    EXPECT_EQ(Full.count(), 100u) << "Bits past the size should stay unset.";
+    EXPECT_TRUE(Full.test(99)) << "Bits should start set.";
+    EXPECT_EQ(Full.get_Word(1), (1ULL << 36) - 1) << "Bits past the size should stay unset.";
+}
+
+TEST(SlotBitsetTest, Operations)
+{
+    SlotBitset A(128, true), B(128, true);
+
+    A.reset(10);
+    A.reset(70);
+    B.reset(64);
+    EXPECT_FALSE(A.test(70)) << "Reset not working as it should.";
+
+    A &= B;
+    EXPECT_EQ(A.count(), 125u) << "Intersection not working as it should.";
+    EXPECT_FALSE(A.test(64)) << "Intersection not working as it should.";
+
+    A.set(10);
+    EXPECT_TRUE(A.test(10)) << "Set not working as it should.";
+    EXPECT_FALSE(A == B) << "Comparison not working as it should.";
+}
+
+TEST(SlotBitsetTest, Runs)
+{
+    //Set runs: [0, 3), [5, 65), [66, 70) and [90, 100)
+    SlotBitset Bits(100, true);
+    for (unsigned s : {3, 4, 65})
+        {
+        Bits.reset(s);
+        }
+    for (unsigned s = 70; s < 90; s++)
+        {
+        Bits.reset(s);
+        }
+
+    EXPECT_EQ(Bits.find_Next(3), 5u) << "Next set bit not found.";
+    EXPECT_EQ(Bits.find_Next(5, false), 65u) << "Next unset bit not found across words.";
+    EXPECT_EQ(Bits.find_Next(90, false), 100u) << "There is no unset bit after 90.";
+    EXPECT_EQ(Bits.find_Previous(64, false), 4) << "Previous unset bit not found across words.";
+    EXPECT_EQ(Bits.find_Previous(75), 69) << "Previous set bit not found.";
+    EXPECT_EQ(Bits.find_Previous(2, false), -1) << "There is no unset bit before 2.";
+
+    EXPECT_EQ(Bits.find_FirstRun(3), 0) << "First run not found.";
+    EXPECT_EQ(Bits.find_FirstRun(4), 5) << "First run not found.";
+    EXPECT_EQ(Bits.find_FirstRun(61), -1) << "There is no run of 61 set bits.";
+
+    EXPECT_EQ(Bits.get_LongestRun(), 60u) << "Longest run not working as it should.";
+    EXPECT_EQ(Bits.get_NumPositions(4), 57u + 1u + 7u) <<
+            "Number of positions not working as it should.";
+
+    unsigned NumRuns = 0;
+    Bits.for_each_Run([&NumRuns](unsigned, unsigned)
+        {
+        NumRuns++;
+        });
+    EXPECT_EQ(NumRuns, 4u) << "Runs not being correctly iterated.";
+}
+
+TEST(SlotBitsetTest, Widths)
+{
+    //The specialised widths must answer as the generic width that contains them.
+    std::mt19937 Generator(0);
+    std::bernoulli_distribution isFree(0.8);
+
+    for (unsigned Width : {64u, 128u, 320u, 384u})
+        {
+        SlotBitset Bits(Width), Wider(Width + 1);
+        for (unsigned s = 0; s < Width; s++)
+            {
+            if (isFree(Generator))
+                {
+                Bits.set(s);
+                Wider.set(s);
+                }
+            }
+
+        EXPECT_EQ(Bits.count(), Wider.count()) << "Count differs at width " << Width;
+        EXPECT_EQ(Bits.get_LongestRun(), Wider.get_LongestRun()) <<
+                "Longest run differs at width " << Width;
+        for (unsigned Length : {1u, 3u, 7u, 16u, 65u})
+            {
+            EXPECT_EQ(Bits.find_FirstRun(Length), Wider.find_FirstRun(Length)) <<
+                    "First run differs at width " << Width;
+            EXPECT_EQ(Bits.get_NumPositions(Length), Wider.get_NumPositions(Length)) <<
+                    "Number of positions differs at width " << Width;
+            }
+        }
+
+    SlotBitset Full(384, true);
+    EXPECT_EQ(Full.find_FirstRun(384), 0) << "The whole grid is a run.";
+    EXPECT_EQ(Full.find_FirstRun(385), -1) << "There is no run longer than the grid.";
+    EXPECT_EQ(Full.get_NumPositions(100), 285u) << "Number of positions not working as it should.";
+}
+
+TEST(SlotBitsetTest, WideGrid)
+{
+    //The S+C+L grids are wider than the inline words, and must answer as a brute force scan.
+    const unsigned Width = 1200;
+    std::mt19937 Generator(0);
+    std::bernoulli_distribution isFree(0.9);
+
+    SlotBitset Bits(Width);
+    std::vector<bool> Reference(Width, false);
+    for (unsigned s = 0; s < Width; s++)
+        {
+        if (isFree(Generator))
+            {
+            Bits.set(s);
+            Reference[s] = true;
+            }
+        }
+
+    unsigned Count = 0, LongestRun = 0, Run = 0;
+    for (unsigned s = 0; s < Width; s++)
+        {
+        Count += Reference[s];
+        Run = Reference[s] ? Run + 1 : 0;
+        LongestRun = std::max(LongestRun, Run);
+        }
+    EXPECT_EQ(Bits.count(), Count) << "Count not working on wide grids.";
+    EXPECT_EQ(Bits.get_LongestRun(), LongestRun) << "Longest run not working on wide grids.";
+
+    for (unsigned Length : {1u, 5u, 20u, 40u})
+        {
+        int FirstRun = -1;
+        unsigned NumPositions = 0;
+        for (unsigned s = 0; s + Length <= Width; s++)
+            {
+            if (std::all_of(Reference.begin() + s, Reference.begin() + s + Length,
+                            [](bool b)
+                {
+                return b;
+                }))
+                {
+                NumPositions++;
+                FirstRun = (FirstRun == -1) ? (int) s : FirstRun;
+                }
+            }
+        EXPECT_EQ(Bits.find_FirstRun(Length), FirstRun) << "First run differs at length " << Length;
+        EXPECT_EQ(Bits.get_NumPositions(Length), NumPositions) <<
+                "Number of positions differs at length " << Length;
+        }
+
+    Bits.reset(1150);
+    EXPECT_EQ(Bits.find_Next(1100, false), (unsigned) (std::find(Reference.begin() + 1100,
+              Reference.begin() + 1150, false) - Reference.begin())) <<
+                      "Next unset bit not found beyond the inline words.";
+    EXPECT_FALSE(Bits.test(1150)) << "Bits beyond the inline words not being reset.";
+
+    SlotBitset Copy(Bits);
+    EXPECT_TRUE(Copy == Bits) << "Copies of wide grids should be equal.";
+    Copy &= SlotBitset(Width);
+    EXPECT_EQ(Copy.count(), 0u) << "Intersection not working on wide grids.";
+    EXPECT_EQ(Bits.count(), Count - 1) << "Copies of wide grids should not share their words.";
+}
+
+#endif
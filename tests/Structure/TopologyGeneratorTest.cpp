@@ -0,0 +1,95 @@
+#ifdef RUN_TESTS
+
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+#include <queue>
+
+namespace
+{
+unsigned int count_ReachableNodes(std::shared_ptr<Topology> T)
+{
+    std::vector<bool> Visited(T->Nodes.size(), false);
+    std::queue<std::shared_ptr<Node>> Queue;
+
+    Visited[0] = true;
+    Queue.push(T->Nodes[0]);
+    unsigned int NumReachable = 1;
+
+    while (!Queue.empty())
+        {
+        auto node = Queue.front();
+        Queue.pop();
+
+        for (auto &neighbour : node->Neighbours)
+            {
+            if (!Visited[neighbour.lock()->Index])
+                {
+                Visited[neighbour.lock()->Index] = true;
+                Queue.push(neighbour.lock());
+                NumReachable++;
+                }
+            }
+        }
+
+    return NumReachable;
+}
+}
+
+TEST(TopologyGeneratorTest, Models)
+{
+#define X(a,b,c) TopologyGenerator::a,
+    for (auto Model : {TOPOLOGY_MODELS})
+#undef X
+        {
+        auto T = TopologyGenerator(Model, 60).create();
+        std::string Name = TopologyGenerator::TopologyModelsNames.left.at(Model);
+
+        ASSERT_EQ(T->Nodes.size(), 60u) << Name << " has the wrong number of nodes.";
+        EXPECT_EQ(count_ReachableNodes(T), 60u) << Name << " is not connected.";
+
+        for (auto &link : T->Links)
+            {
+            EXPECT_TRUE(T->Links.count({link.first.second, link.first.first})) <<
+                    Name << " has a link without the reverse one.";
+            EXPECT_GT(link.second->Length, 0) << Name << " has a link without length.";
+            }
+        }
+}
+
+TEST(TopologyGeneratorTest, NumLinks)
+{
+    EXPECT_EQ(TopologyGenerator(TopologyGenerator::Grid, 9).create()->Links.size(), 24u) <<
+            "A 3x3 grid has 12 pairs of links.";
+
+    EXPECT_EQ(TopologyGenerator(TopologyGenerator::RingOfRings, 16).create()->Links.size(),
+              34u) << "Two rings of 8 nodes joined by a backbone have 17 pairs of links.";
+
+    TopologyGenerator BA(TopologyGenerator::BarabasiAlbert, 50);
+    BA.NumAttachments = 2;
+    EXPECT_EQ(BA.create()->Links.size(), 2u * (3 + 47 * 2)) <<
+            "Each new node should attach to two nodes.";
+}
+
+TEST(TopologyGeneratorTest, Reproducibility)
+{
+    auto T1 = TopologyGenerator(TopologyGenerator::Waxman, 40, 7).create();
+    auto T2 = TopologyGenerator(TopologyGenerator::Waxman, 40, 7).create();
+    auto T3 = TopologyGenerator(TopologyGenerator::Waxman, 40, 8).create();
+
+    ASSERT_EQ(T1->Links.size(), T2->Links.size()) << "The same seed should create the same topology.";
+    for (auto &link : T1->Links)
+        {
+        EXPECT_EQ(link.second->Length, T2->Links.at(link.first)->Length) <<
+                "The same seed should create the same topology.";
+        }
+
+    bool isDifferent = T1->Links.size() != T3->Links.size();
+    for (auto &link : T1->Links)
+        {
+        isDifferent |= !T3->Links.count(link.first) ||
+                       T3->Links.at(link.first)->Length != link.second->Length;
+        }
+    EXPECT_TRUE(isDifferent) << "Different seeds should create different topologies.";
+}
+
+#endif
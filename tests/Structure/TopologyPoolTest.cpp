@@ -0,0 +1,91 @@
+#ifdef RUN_TESTS
+
+#include "include/Structure.h"
+#include <gtest/gtest.h>
+
+class TopologyPoolTest : public ::testing::Test
+{
+public:
+    void SetUp();
+
+    std::shared_ptr<Topology> T;
+};
+
+void TopologyPoolTest::SetUp()
+{
+    T = std::make_shared<Topology>();
+
+    auto N1 = T->add_Node(1, Node::TransparentNode, Node::SwitchingSelect, 0);
+    auto N2 = T->add_Node(2, Node::TranslucentNode, Node::SwitchingSelect, 20);
+    auto N3 = T->add_Node(3, Node::TransparentNode, Node::SwitchingSelect, 0);
+
+    T->add_Link(N1, N2, 120);
+    T->add_Link(N2, N3, 230);
+    T->add_Link(N3, N1, 340);
+}
+
+TEST_F(TopologyPoolTest, Reuse)
+{
+    TopologyPool Pool(T);
+
+    auto First = Pool.acquire();
+    auto Second = Pool.acquire();
+    EXPECT_NE(First, Second) << "Copies in use should not be handed out again.";
+    EXPECT_EQ(Pool.get_NumCopies(), 2u) << "Each copy in use should have been built.";
+
+    Topology *Used = First.get();
+    auto L12 = First->Links.at(std::make_pair(1, 2));
+    L12->Slots[0]->useSlot();
+    L12->Slots[10]->useSlot();
+    First->Links.at(std::make_pair(2, 3))->set_LinkInactive();
+    First->Nodes[1]->request_Regenerators(5);
+    First->Nodes[2]->set_NodeInactive();
+    First.reset();
+
+    auto Third = Pool.acquire();
+    EXPECT_EQ(Third.get(), Used) << "A released copy should be handed out again.";
+    EXPECT_EQ(Pool.get_NumCopies(), 2u) << "A released copy should be reused.";
+
+    for (auto &link : Third->Links)
+        {
+        EXPECT_EQ(link.second->get_Availability(), link.second->get_NumSlots()) <<
+                "A reused copy should have every slot free.";
+        EXPECT_TRUE(link.second->is_LinkActive()) << "A reused copy should have every link active.";
+        }
+    for (auto &node : Third->Nodes)
+        {
+        EXPECT_EQ(node->get_NumUsedRegenerators(), 0u) <<
+                "A reused copy should have no regenerator used.";
+        EXPECT_TRUE(node->is_NodeActive()) << "A reused copy should have every node active.";
+        }
+    EXPECT_EQ(Third->get_NumRegenerators(), 20u) << "The regenerators should be kept.";
+}
+
+TEST_F(TopologyPoolTest, Prototype)
+{
+    auto Pool = std::make_shared<TopologyPool>(T);
+
+    auto Copy = Pool->acquire();
+    Copy->Nodes[0]->set_NodeType(Node::TranslucentNode);
+    Copy->Nodes[0]->set_NumRegenerators(10);
+    Copy.reset();
+
+    T->Nodes[2]->set_NodeType(Node::TranslucentNode);
+    T->Nodes[2]->set_NumRegenerators(30);
+
+    Copy = Pool->acquire();
+    EXPECT_EQ(Copy->Nodes[0]->get_NodeType(), Node::TransparentNode) <<
+            "A reused copy should take the node types of the prototype.";
+    EXPECT_EQ(Copy->Nodes[0]->get_NumRegenerators(), 0u) <<
+            "A reused copy should take the regenerators of the prototype.";
+    EXPECT_EQ(Copy->Nodes[2]->get_NodeType(), Node::TranslucentNode) <<
+            "A reused copy should take the node types of the prototype.";
+    EXPECT_EQ(Copy->Nodes[2]->get_NumRegenerators(), 30u) <<
+            "A reused copy should take the regenerators of the prototype.";
+
+    //The copies in use may outlive their pool
+    Pool.reset();
+    EXPECT_EQ(Copy->Links.size(), 3u) << "A copy should outlive its pool.";
+}
+
+#endif
@@ -1,7 +1,12 @@
 #ifdef RUN_TESTS
 
 #include "include/Structure.h"
+#include "include/GeneralClasses/PhysicalConstants.h"
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
 
 class TopologyTest : public ::testing::Test
 {
@@ -99,6 +104,89 @@ TEST_F(TopologyTest, Topology_CopyConstructor)
     EXPECT_EQ(T_Copy.get_LengthLongestLink(), 810) << "Longest link not being correctly calculated.";
 }
 
+TEST_F(TopologyTest, State)
+{
+    T->set_avgSpanLength(100);
+    Topology T_Copy(*T);
+
+    for (auto &linkIterator : T->Links)
+        {
+        auto &Devices = linkIterator.second->Devices;
+        auto &CopyDevices = T_Copy.Links[linkIterator.first]->Devices;
+        ASSERT_EQ(CopyDevices.size(), Devices.size()) << "Links should have the same devices.";
+        EXPECT_EQ(CopyDevices.front(), Devices.front()) << "Fibers should be shared by the copies.";
+        EXPECT_NE(CopyDevices.back(), Devices.back()) << "Preamplifiers should not be shared by the copies.";
+        }
+
+    std::shared_ptr<Link> L12 = T->Links.at(std::make_pair(1, 2));
+    L12->Slots[3]->useSlot();
+    L12->Slots[4]->useSlot();
+    T->Links.at(std::make_pair(5, 6))->set_LinkInactive();
+    N2.lock()->request_Regenerators(5);
+    N2.lock()->free_Regenerators(2);
+
+    EXPECT_EQ(T_Copy.Links.at(std::make_pair(1, 2))->get_Availability(), Link::DefaultNumSlots) << "Copies should not share the state.";
+    EXPECT_EQ(T_Copy.Nodes[1]->get_NumUsedRegenerators(), 0) << "Copies should not share the state.";
+
+    T_Copy.set_State(T->get_State());
+    std::shared_ptr<Link> Copy12 = T_Copy.Links.at(std::make_pair(1, 2));
+    EXPECT_EQ(Copy12->get_FreeSlots(), L12->get_FreeSlots()) << "Free slots not restored.";
+    EXPECT_FALSE(Copy12->Slots[3]->isFree()) << "Slots not restored.";
+    EXPECT_FALSE(T_Copy.Links.at(std::make_pair(5, 6))->is_LinkActive()) << "Link activity not restored.";
+    EXPECT_EQ(T_Copy.Nodes[1]->get_NumUsedRegenerators(), 3) << "Regenerator usage not restored.";
+    EXPECT_EQ(T_Copy.Nodes[1]->get_TotalNumRequestedRegenerators(), 5) << "Regenerator usage not restored.";
+
+    NetworkState Empty = Topology(*T).get_State();
+    T->set_State(Empty);
+    EXPECT_EQ(L12->get_Availability(), Link::DefaultNumSlots) << "Slots not freed.";
+    EXPECT_TRUE(L12->Slots[3]->isFree()) << "Slots not freed.";
+    EXPECT_TRUE(T->Links.at(std::make_pair(5, 6))->is_LinkActive()) << "Link activity not restored.";
+    EXPECT_EQ(N2.lock()->get_NumUsedRegenerators(), 0) << "Regenerator usage not restored.";
+}
+
+TEST(TopologyNumSlotsTest, NumSlots)
+{
+    Topology T;
+    T.set_NumSlots(384);
+    auto N1 = T.add_Node(1);
+    auto N2 = T.add_Node(2);
+    auto L12 = T.add_Link(N1, N2, 100).lock();
+
+    EXPECT_EQ(L12->get_NumSlots(), 384) << "Links should take the number of slots of the topology.";
+    EXPECT_EQ(L12->Slots.size(), 384u) << "Links should take the number of slots of the topology.";
+    EXPECT_EQ(L12->get_Availability(), 384) << "All the slots should start free.";
+    EXPECT_DOUBLE_EQ(L12->Slots[192]->get_CenterFreq(), PhysicalConstants::freq) <<
+            "The grid should be centered at the reference frequency.";
+
+    Topology T_Copy(T);
+    EXPECT_EQ(T_Copy.get_NumSlots(), 384) << "Copies should have the same number of slots.";
+    EXPECT_EQ(T_Copy.Links.at(std::make_pair(1, 2))->get_NumSlots(), 384) <<
+            "Copies should have the same number of slots.";
+}
+
+TEST(TopologyNumSlotsTest, WideGrid)
+{
+    Topology T;
+    T.set_NumSlots(1200);
+    auto N1 = T.add_Node(1);
+    auto N2 = T.add_Node(2);
+    auto L12 = T.add_Link(N1, N2, 100).lock();
+
+    EXPECT_EQ(L12->get_Availability(), 1200) << "All the slots should start free.";
+    for (unsigned s = 1100; s < 1200; s++)
+        {
+        L12->Slots[s]->useSlot();
+        }
+    EXPECT_EQ(L12->get_Availability(), 1100) << "Slots beyond 512 not being used.";
+    EXPECT_EQ(L12->get_LargestFreeBlock(), 1100) << "Largest block not working on wide grids.";
+
+    Topology T_Copy(T);
+    auto L12_Copy = T_Copy.Links.at(std::make_pair(1, 2));
+    EXPECT_EQ(L12_Copy->get_Availability(), 1200) << "Copies should have the whole grid free.";
+    L12_Copy->Slots[0]->useSlot();
+    EXPECT_EQ(L12->get_Availability(), 1100) << "Copies should not share their slots.";
+}
+
 TEST_F(TopologyTest, LinkReferences)
 {
     for (auto &linkIterator : T->Links)
@@ -118,4 +206,67 @@ TEST_F(TopologyTest, LinkReferences)
     EXPECT_EQ(numNeighbourRelationships, T->Links.size()) << "There should be as many links as there are neighbour relationships in a topology.";
 }
 
+TEST(TopologyFileTest, TextAndBinary)
+{
+    const std::string TextFile = "TopologyFileTest.ini";
+    const std::string BinaryFile = "TopologyFileTest.bin";
+    auto T = TopologyGenerator(TopologyGenerator::Grid, 30).create();
+
+    //The topology can share its file with other sections.
+    std::ofstream(TextFile) << "  [general]" << std::endl << "  NetworkType = ts # comment" <<
+                            std::endl << std::endl;
+    T->save(TextFile);
+    Topology FromText(TextFile);
+    EXPECT_EQ(FromText.Nodes.size(), T->Nodes.size()) << "Nodes not read from the text file.";
+    EXPECT_EQ(FromText.Links.size(), T->Links.size()) << "Links not read from the text file.";
+    EXPECT_EQ(FromText.get_Hash(), T->get_Hash()) << "The text file should keep the structure.";
+
+    T->save_Binary(BinaryFile);
+    Topology FromBinary(BinaryFile);
+    EXPECT_EQ(FromBinary.get_NumSlots(), T->get_NumSlots()) << "Slots not read from the binary file.";
+    EXPECT_EQ(FromBinary.get_Hash(), T->get_Hash()) << "The binary file should keep the structure.";
+    for (auto &link : T->Links)
+        {
+        ASSERT_TRUE(FromBinary.Links.count(link.first)) << "Link not read from the binary file.";
+        EXPECT_EQ(FromBinary.Links.at(link.first)->Index, link.second->Index) <<
+                "The links should keep their indices.";
+        }
+
+    auto Other = TopologyGenerator(TopologyGenerator::Grid, 31).create();
+    EXPECT_NE(Other->get_Hash(), T->get_Hash()) << "Different topologies should have different hashes.";
+
+    std::remove(TextFile.c_str());
+    std::remove(BinaryFile.c_str());
+}
+
+TEST(TopologyFileTest, InvalidBinary)
+{
+    const std::string BinaryFile = "TopologyFileTest.bin";
+    const std::string InvalidFile = "TopologyFileTest.invalid.bin";
+    auto T = TopologyGenerator(TopologyGenerator::Grid, 30).create();
+    T->save_Binary(BinaryFile);
+
+    std::ifstream File(BinaryFile, std::ifstream::binary);
+    std::string Contents((std::istreambuf_iterator<char>(File)),
+                         std::istreambuf_iterator<char>());
+    File.close();
+
+    //Truncated, with another version, and with a changed link length
+    std::vector<std::string> Invalid = {Contents.substr(0, Contents.size() - 8),
+                                        Contents, Contents
+                                       };
+    Invalid[1][8] ^= 1;
+    Invalid[2][Contents.size() - 1] ^= 1;
+
+    for (auto &Bytes : Invalid)
+        {
+        std::ofstream(InvalidFile, std::ofstream::binary) << Bytes;
+        EXPECT_DEATH(Topology Loaded(InvalidFile), "Invalid topology file") <<
+                "Invalid binary files should be rejected.";
+        }
+
+    std::remove(BinaryFile.c_str());
+    std::remove(InvalidFile.c_str());
+}
+
 #endif